@@ -38,6 +38,18 @@ using namespace LAMMPS_NS;
 
 using MathSpecial::powint;
 
+/* ----------------------------------------------------------------------
+   binomial coefficient n over k
+------------------------------------------------------------------------- */
+
+static double binomial(int n, int k)
+{
+  if ((k < 0) || (k > n)) return 0.0;
+  double value = 1.0;
+  for (int i = 1; i <= k; i++) value = value * (n - k + i) / i;
+  return value;
+}
+
 enum { INDUCE, RSD, SETUP_AMOEBA, SETUP_HIPPO, KMPOLE, AMGROUP, PVAL };    // forward comm
 enum { FIELD, ZRSD, TORQUE, UFLD };                                        // reverse comm
 enum { ARITHMETIC, GEOMETRIC, CUBIC_MEAN, R_MIN, SIGMA, DIAMETER, HARMONIC, HHG, W_H };
@@ -62,6 +74,7 @@ PairAmoeba::PairAmoeba(LAMMPS *lmp) : Pair(lmp)
 
   one_coeff = 1;
   single_enable = 0;
+  restartinfo = 0;
   no_virial_fdotr_compute = 1;
 
   nextra = 6;
@@ -2006,9 +2019,28 @@ void PairAmoeba::allocate_smallsize()
   bpredp = new double[maxualt];
   bpreds = new double[maxualt];
   bpredps = new double[maxualt];
+
+  // predictor coefficients for induced dipoles, newest value first
+  // Gear = binomial coefficients of order maxualt-1
+  // ASPC = coefficients of Kolafa's always stable predictor-corrector
+  //   of order k = maxualt-3, so k+2 previous values are used
+  // the oldest stored value is only used by the least squares predictor
+
   if (use_pred) {
-    if (polpred == GEAR) gear = new double[maxualt];
-    if (polpred == ASPC) aspc = new double[maxualt];
+    if (polpred == GEAR) {
+      gear = new double[maxualt];
+      for (int i = 0; i < maxualt-1; i++)
+        gear[i] = ((i % 2) ? -1.0 : 1.0) * binomial(maxualt-1,i+1);
+      gear[maxualt-1] = 0.0;
+    }
+    if (polpred == ASPC) {
+      aspc = new double[maxualt];
+      const int k = maxualt - 3;
+      const double norm = binomial(2*k+2,k+1);
+      for (int i = 0; i < maxualt-1; i++)
+        aspc[i] = ((i % 2) ? -1.0 : 1.0) * (i+1) * binomial(2*k+4,k+1-i) / norm;
+      aspc[maxualt-1] = 0.0;
+    }
   }
 }
 
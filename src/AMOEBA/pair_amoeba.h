@@ -382,7 +382,7 @@ class PairAmoeba : public Pair {
   virtual void induce();
   void ulspred();
   virtual void ufield0c(double **, double **);
-  void uscale0b(int, double **, double **, double **, double **);
+  virtual void uscale0b(int, double **, double **, double **, double **);
   void dfield0c(double **, double **);
   virtual void umutual1(double **, double **);
   virtual void umutual2b(double **, double **);
@@ -17,6 +17,7 @@
 #include "atom.h"
 #include "atom_vec.h"
 #include "comm.h"
+#include "domain.h"
 #include "error.h"
 #include "memory.h"
 #include "modify.h"
@@ -53,6 +54,7 @@ FixDrude::FixDrude(LAMMPS *lmp, int narg, char **arg) :
   }
 
   drudeid = nullptr;
+  drudelocal = nullptr;
   FixDrude::grow_arrays(atom->nmax);
   atom->add_callback(Atom::GROW);
   atom->add_callback(Atom::RESTART);
@@ -76,6 +78,7 @@ FixDrude::~FixDrude()
   atom->delete_callback(id,Atom::GROW);
   memory->destroy(drudetype);
   memory->destroy(drudeid);
+  memory->destroy(drudelocal);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -92,9 +95,73 @@ void FixDrude::init()
 int FixDrude::setmask()
 {
   int mask = 0;
+  mask |= POST_NEIGHBOR;
+  mask |= MIN_POST_NEIGHBOR;
   return mask;
 }
 
+/* ---------------------------------------------------------------------- */
+
+void FixDrude::setup_post_neighbor()
+{
+  post_neighbor();
+}
+
+/* ----------------------------------------------------------------------
+   cache local index of closest image of Drude partner for owned and ghost
+   atoms, valid until the next reneighboring or other change of the atom
+   map. Core and Drude are bonded, so the closest image does not change
+   while atoms move less than the skin
+------------------------------------------------------------------------- */
+
+void FixDrude::post_neighbor()
+{
+  int nall = atom->nlocal + atom->nghost;
+  int *type = atom->type;
+
+  for (int i = 0; i < nall; i++) {
+    if (drudetype[type[i]] == NOPOL_TYPE)
+      drudelocal[i] = -1;
+    else
+      drudelocal[i] = domain->closest_image(i, atom->map(drudeid[i]));
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixDrude::min_post_neighbor()
+{
+  post_neighbor();
+}
+
+/* ----------------------------------------------------------------------
+   rebuild the partner cache if it does not match the current atoms.
+   called by its users before each use, since atom/swap, gcmc or the setup
+   of run 0 and rerun may change the atom map or types without reneighboring
+------------------------------------------------------------------------- */
+
+void FixDrude::check_drudelocal()
+{
+  int nlocal = atom->nlocal;
+  int nall = nlocal + atom->nghost;
+  int *type = atom->type;
+  tagint *tag = atom->tag;
+
+  for (int i = 0; i < nall; i++) {
+    if (drudetype[type[i]] == NOPOL_TYPE) continue;
+    int j = drudelocal[i];
+    int stale;
+    if (j < 0)
+      stale = (i < nlocal) || (atom->map(drudeid[i]) >= 0);
+    else
+      stale = (j >= nall) || (tag[j] != drudeid[i]);
+    if (stale) {
+      post_neighbor();
+      return;
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    look in bond lists for Drude partner tags and fill drudeid
 ------------------------------------------------------------------------- */
@@ -220,12 +287,13 @@ void FixDrude::ring_build_partner(int size, char *cbuf, void *ptr) {
 
 
 /* ----------------------------------------------------------------------
-   allocate atom-based array for drudeid
+   allocate atom-based arrays for drudeid and drudelocal
 ------------------------------------------------------------------------- */
 
 void FixDrude::grow_arrays(int nmax)
 {
   memory->grow(drudeid,nmax,"fix_drude:drudeid");
+  memory->grow(drudelocal,nmax,"fix_drude:drudelocal");
 }
 
 /* ----------------------------------------------------------------------
@@ -33,12 +33,17 @@ class FixDrude : public Fix {
  public:
   int *drudetype;
   tagint *drudeid;
+  int *drudelocal;    // local index of closest image of Drude partner or -1
   bool is_reduced;
 
   FixDrude(class LAMMPS *, int, char **);
   ~FixDrude() override;
   int setmask() override;
   void init() override;
+  void setup_post_neighbor() override;
+  void post_neighbor() override;
+  void min_post_neighbor() override;
+  void check_drudelocal();
 
   void grow_arrays(int nmax) override;
   void copy_arrays(int i, int j, int delflag) override;
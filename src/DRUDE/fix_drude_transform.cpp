@@ -154,21 +154,20 @@ void FixDrudeTransform<inverse>::real_to_reduced()
   double * rmass = atom->rmass, * mass = atom->mass;
   double mcore, mdrude, coeff;
   int icore, idrude;
-  tagint * drudeid = fix_drude->drudeid;
+  fix_drude->check_drudelocal();
+  int * drudelocal = fix_drude->drudelocal;
   int * drudetype = fix_drude->drudetype;
 
   if (!rmass) { // TODO: maybe drudetype can be used instead?
     for (int itype=1; itype<=ntypes; itype++)
       if (mcoeff[itype] < 1.5) mass[itype] *= 1. - mcoeff[itype];
   }
+
+  // single pass using the Drude partners cached by fix drude
+
   for (int i=0; i<nlocal; i++) {
     if (mask[i] & groupbit && drudetype[type[i]] != NOPOL_TYPE) {
-      drudeid[i] = (tagint) domain->closest_image(i, atom->map(drudeid[i]));
-    }
-  }
-  for (int i=0; i<nlocal; i++) {
-    if (mask[i] & groupbit && drudetype[type[i]] != NOPOL_TYPE) {
-      int j = (int) drudeid[i];
+      int j = drudelocal[i];
       if (drudetype[type[i]] == DRUDE_TYPE && j < nlocal) continue;
 
       if (drudetype[type[i]] == DRUDE_TYPE) {
@@ -212,12 +211,13 @@ void FixDrudeTransform<inverse>::reduced_to_real()
   double * rmass = atom->rmass, * mass = atom->mass;
   double mcore, mdrude, coeff;
   int icore, idrude;
-  tagint * drudeid = fix_drude->drudeid;
+  fix_drude->check_drudelocal();
+  int * drudelocal = fix_drude->drudelocal;
   int * drudetype = fix_drude->drudetype;
 
   for (int i=0; i<nlocal; i++) {
     if (mask[i] & groupbit && drudetype[type[i]] != NOPOL_TYPE) {
-      int j = (int) drudeid[i]; // local index of drude partner because drudeid is in reduced form
+      int j = drudelocal[i];
       if (drudetype[type[i]] == DRUDE_TYPE && j < nlocal) continue;
 
       if (drudetype[type[i]] == DRUDE_TYPE) {
@@ -255,11 +255,6 @@ void FixDrudeTransform<inverse>::reduced_to_real()
       }
     }
   }
-  for (int i=0; i<nlocal; i++) {
-    if (mask[i] & groupbit && drudetype[type[i]] != NOPOL_TYPE) {
-      drudeid[i] = atom->tag[(int) drudeid[i]];
-    }
-  }
   if (!rmass) {
     for (int itype=1; itype<=ntypes; itype++)
       if (mcoeff[itype] < 1.5) mass[itype] /= 1. - mcoeff[itype];
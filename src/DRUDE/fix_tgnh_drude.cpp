@@ -1571,7 +1571,8 @@ void FixTGNHDrude::compute_temp_mol_int_drude(bool end_of_step) {
   int *type = atom->type;
   int *mask = atom->mask;
   int *drudetype = fix_drude->drudetype;
-  tagint *drudeid = fix_drude->drudeid;
+  fix_drude->check_drudelocal();
+  int *drudelocal = fix_drude->drudelocal;
   int imol, ci, di;
   double mass_com, mass_reduced, mass_core, mass_drude;
   double vint, vcom, vrel;
@@ -1631,7 +1632,7 @@ void FixTGNHDrude::compute_temp_mol_int_drude(bool end_of_step) {
          * but the bias velocity may depends on it's position like in compute vis/pp
          */
         ci = i;
-        di = domain->closest_image(i, atom->map(drudeid[i]));
+        di = drudelocal[i];
         if (which == BIAS) {
           temperature->remove_bias(ci, v[ci]);
           temperature->remove_bias(di, v[di]);
@@ -1956,7 +1957,8 @@ void FixTGNHDrude::nh_v_temp()
   int *type = atom->type;
   tagint *molecule = atom->molecule;
   int *drudetype = fix_drude->drudetype;
-  tagint *drudeid = fix_drude->drudeid;
+  fix_drude->check_drudelocal();
+  int *drudelocal = fix_drude->drudelocal;
 
   int imol, i, j, ci, di, itype;
   double mass_com, mass_core, mass_drude;
@@ -1982,7 +1984,7 @@ void FixTGNHDrude::nh_v_temp()
           temperature->restore_bias(i, v[i]);
       } else {
         // have to use closest_image() because we are manipulating the velocity
-        j = domain->closest_image(i, atom->map(drudeid[i]));
+        j = drudelocal[i];
         if (itype == DRUDE_TYPE && j < atom->nlocal) continue;
         if (itype == CORE_TYPE) {
           ci = i;
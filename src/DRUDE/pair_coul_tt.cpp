@@ -16,7 +16,6 @@
 
 #include "atom.h"
 #include "comm.h"
-#include "domain.h"
 #include "fix.h"
 #include "fix_drude.h"
 #include "force.h"
@@ -77,7 +76,8 @@ void PairCoulTT::compute(int eflag, int vflag)
   int newton_pair = force->newton_pair;
   double qqrd2e = force->qqrd2e;
   int *drudetype = fix_drude->drudetype;
-  tagint *drudeid = fix_drude->drudeid;
+  fix_drude->check_drudelocal();
+  int *drudelocal = fix_drude->drudelocal;
 
   inum = list->inum;
   ilist = list->ilist;
@@ -109,7 +109,7 @@ void PairCoulTT::compute(int eflag, int vflag)
       qj = q[j];
 
       if (drudetype[type[i]] == CORE_TYPE) {
-        di = domain->closest_image(i, atom->map(drudeid[i]));
+        di = drudelocal[i];
         if (di == j)
           continue;
         switch (drudetype[type[j]]) {
@@ -123,7 +123,7 @@ void PairCoulTT::compute(int eflag, int vflag)
       }
 
       if (drudetype[type[j]] == CORE_TYPE) {
-        dj = domain->closest_image(j, atom->map(drudeid[j]));
+        dj = drudelocal[j];
         if (dj == i)
           continue;
         switch (drudetype[type[i]]) {
@@ -20,7 +20,6 @@
 
 #include "atom.h"
 #include "comm.h"
-#include "domain.h"
 #include "error.h"
 #include "fix_drude.h"
 #include "force.h"
@@ -97,7 +96,7 @@ void PairLJCutTholeLong::compute(int eflag, int vflag)
   double grij,expm2,prefactor,t,erfc,u;
   int *ilist,*jlist,*numneigh,**firstneigh;
   double factor_f,factor_e;
-  int di,dj;
+  int dj;
   double dqi,dqj,dcoul,asr,exp_asr;
   int di_closest;
 
@@ -114,7 +113,8 @@ void PairLJCutTholeLong::compute(int eflag, int vflag)
   int newton_pair = force->newton_pair;
   double qqrd2e = force->qqrd2e;
   int *drudetype = fix_drude->drudetype;
-  tagint *drudeid = fix_drude->drudeid;
+  fix_drude->check_drudelocal();
+  int *drudelocal = fix_drude->drudelocal;
 
   inum = list->inum;
   ilist = list->ilist;
@@ -133,11 +133,10 @@ void PairLJCutTholeLong::compute(int eflag, int vflag)
     jnum = numneigh[i];
 
     if (drudetype[type[i]] != NOPOL_TYPE) {
-      di = atom->map(drudeid[i]);
-      if (di < 0) error->all(FLERR, "Drude partner not found");
-      di_closest = domain->closest_image(i, di);
+      di_closest = drudelocal[i];
+      if (di_closest < 0) error->all(FLERR, "Drude partner not found");
       if (drudetype[type[i]] == CORE_TYPE)
-        dqi = -q[di];
+        dqi = -q[di_closest];
       else
         dqi = qi;
     }
@@ -191,7 +190,7 @@ void PairLJCutTholeLong::compute(int eflag, int vflag)
               drudetype[type[j]] != NOPOL_TYPE) {
             if (j != di_closest) {
               if (drudetype[type[j]] == CORE_TYPE) {
-                dj = atom->map(drudeid[j]);
+                dj = drudelocal[j];
                 dqj = -q[dj];
               } else dqj = qj;
               asr = ascreen[type[i]][type[j]] * r;
@@ -16,7 +16,6 @@
 
 #include "atom.h"
 #include "comm.h"
-#include "domain.h"
 #include "error.h"
 #include "fix.h"
 #include "fix_drude.h"
@@ -76,7 +75,8 @@ void PairThole::compute(int eflag, int vflag)
   int newton_pair = force->newton_pair;
   double qqrd2e = force->qqrd2e;
   int *drudetype = fix_drude->drudetype;
-  tagint *drudeid = fix_drude->drudeid;
+  fix_drude->check_drudelocal();
+  int *drudelocal = fix_drude->drudelocal;
 
   inum = list->inum;
   ilist = list->ilist;
@@ -92,7 +92,7 @@ void PairThole::compute(int eflag, int vflag)
     if (drudetype[type[i]] == NOPOL_TYPE)
       continue;
 
-    di = domain->closest_image(i, atom->map(drudeid[i]));
+    di = drudelocal[i];
     // get dq of the core via the drude charge
     if (drudetype[type[i]] == DRUDE_TYPE)
       qi = q[i];
@@ -119,7 +119,7 @@ void PairThole::compute(int eflag, int vflag)
       if (drudetype[type[j]] == DRUDE_TYPE)
         qj = q[j];
       else {
-        dj = domain->closest_image(j, atom->map(drudeid[j]));
+        dj = drudelocal[j];
         qj = -q[dj];
       }
 
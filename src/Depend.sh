@@ -187,6 +187,7 @@ fi
 
 if (test $1 = "ML-POD") then
   depend KOKKOS
+  depend OPENMP
 fi
 
 if (test $1 = "ML-SNAP") then
@@ -197,6 +198,7 @@ fi
 
 if (test $1 = "ML-UF3") then
   depend KOKKOS
+  depend OPENMP
 fi
 
 if (test $1 = "CG-SPICA") then
@@ -96,6 +96,9 @@ FixElectrodeConp::FixElectrodeConp(LAMMPS *lmp, int narg, char **arg) :
   algo = Algo::MATRIX_INV;
   matrix_algo = true;
   cg_threshold = 0.;
+  extrapolate = false;
+  q_last = nullptr;
+  q_last_valid = false;
   write_inv = write_mat = write_vec = read_inv = read_mat = false;
   symm = false;
   ffield = false;
@@ -238,6 +241,9 @@ FixElectrodeConp::FixElectrodeConp(LAMMPS *lmp, int narg, char **arg) :
       symm = utils::logical(FLERR, arg[++iarg], false, lmp);
     } else if ((strcmp(arg[iarg], "ffield") == 0)) {
       ffield = utils::logical(FLERR, arg[++iarg], false, lmp);
+    } else if ((strcmp(arg[iarg], "extrapolate") == 0)) {
+      if (iarg + 2 > narg) error->all(FLERR, "Need one argument after extrapolate keyword");
+      extrapolate = utils::logical(FLERR, arg[++iarg], false, lmp);
     } else {
       error->all(FLERR, "Unknown keyword {} for fix {} command", arg[iarg], style);
     }
@@ -279,6 +285,8 @@ FixElectrodeConp::FixElectrodeConp(LAMMPS *lmp, int narg, char **arg) :
           FLERR,
           "Selected algorithm does not use inverted matrix. Cannot read/write inverted matrix.");
   }
+  if (extrapolate && algo == Algo::MATRIX_INV)
+    error->all(FLERR, "Fix {} keyword extrapolate requires algo mat_cg or cg", style);
   if (!matrix_algo && (read_mat || write_mat || write_vec)) {
     error->all(FLERR,
                "Selected algorithm does not use matrix. Cannot read/write matrix or vector.");
@@ -320,6 +328,10 @@ FixElectrodeConp::FixElectrodeConp(LAMMPS *lmp, int narg, char **arg) :
   }
 
   atom->add_callback(Atom::GROW);    // atomvec track local electrode atoms
+  if (extrapolate) {
+    maxexchange = 1;    // charges of previous step for extrapolation
+    FixElectrodeConp::grow_arrays(atom->nmax);
+  }
   comm_reverse = 1;
   comm_forward = 1;
 
@@ -416,6 +428,9 @@ void FixElectrodeConp::init()
   if (modify->get_fix_by_style("^electrode").size() > 1)
     error->all(FLERR, "More than one fix electrode");
 
+  // charges may have been changed since the last run, do not extrapolate from them
+  q_last_valid = false;
+
   // make sure electrode atoms are not integrated if a matrix is used for electrode-electrode interaction
   int const nlocal = atom->nlocal;
   int *mask = atom->mask;
@@ -893,8 +908,15 @@ void FixElectrodeConp::update_charges()
     auto b = gather_elevec_local(elyt_vector);
     for (int i = 0; i < nlocalele; i++) {
       b[i] -= evscale * group_psi[iele_to_group_local[i]];
-      q_local[i] = q[atom->map(taglist_local[i])];    // pre-condition with current charges
+      int const j = atom->map(taglist_local[i]);
+      q_local[i] = q[j];    // pre-condition with current charges
+      if (extrapolate) {
+        // linear extrapolation from the solutions of the last two steps
+        if (q_last_valid) q_local[i] = 2. * q[j] - q_last[j];
+        q_last[j] = q[j];
+      }
     }
+    if (extrapolate) q_last_valid = true;
     q_local = constraint_correction(q_local);
     MPI_Barrier(world);
     double mult_start = MPI_Wtime();
@@ -1329,6 +1351,7 @@ FixElectrodeConp::~FixElectrodeConp()
   }
 
   if (modify->get_fix_by_id(id)) atom->delete_callback(id, Atom::GROW);
+  memory->destroy(q_last);
 
   delete[] recvcounts;
   delete[] displs;
@@ -1488,24 +1511,46 @@ void FixElectrodeConp::request_etypes_neighlists()
   if (intelflag) vecReq->enable_intel();
 }
 
-int FixElectrodeConp::pack_exchange(int i, double * /* buf */)
+int FixElectrodeConp::pack_exchange(int i, double *buf)
 {
   if (atom->mask[i] & groupbit) {
     nlocalele_outdated = 1;
     nlocalele--;    // decrement nlocalele if we are packing away a particle
   }
+  if (extrapolate) {
+    buf[0] = q_last[i];
+    return 1;
+  }
   return 0;
 }
 
-int FixElectrodeConp::unpack_exchange(int nlocal, double * /* buf */)
+int FixElectrodeConp::unpack_exchange(int nlocal, double *buf)
 {
   if (atom->mask[nlocal] & groupbit) {    // this should work
     nlocalele_outdated = 1;
     nlocalele++;    // increment nlocalele if we are unpacking a particle
   }
+  if (extrapolate) {
+    q_last[nlocal] = buf[0];
+    return 1;
+  }
   return 0;
 }
 
+/* ----------------------------------------------------------------------
+   charges of the previous step are only stored for extrapolation
+------------------------------------------------------------------------- */
+
+void FixElectrodeConp::grow_arrays(int nmax_new)
+{
+  if (extrapolate) memory->grow(q_last, nmax_new, "FixElectrode:q_last");
+}
+
+void FixElectrodeConp::copy_arrays(int i, int j, int /*delflag*/)
+{
+  if (extrapolate) q_last[j] = q_last[i];
+}
+
 void FixElectrodeConp::gather_list_iele()
 {
   MPI_Allreduce(MPI_IN_PLACE, &nlocalele_outdated, 1, MPI_INT, MPI_SUM, world);
@@ -1569,6 +1614,7 @@ double FixElectrodeConp::memory_usage()
   int const nmax = atom->nmax;
   double bytes = 0.0;
   bytes += nmax * (sizeof(double));    // potential_i
+  if (extrapolate) bytes += nmax * (sizeof(double));    // q_last
   if (matrix_algo) {
     bytes += ngroup * (sizeof(int) + 2 * sizeof(double));    // iele_gathered, buf_gathered, pot
     bytes += ngroup * ngroup * sizeof(double);               // capacitance or elastance
@@ -62,6 +62,8 @@ class FixElectrodeConp : public Fix {
   // atomvec-based tracking of electrode atoms
   int pack_exchange(int, double *) override;
   int unpack_exchange(int, double *) override;
+  void grow_arrays(int) override;
+  void copy_arrays(int, int, int) override;
 
   int pack_reverse_comm(int, int, double *) override;
   void unpack_reverse_comm(int, int *, double *) override;
@@ -114,6 +116,9 @@ class FixElectrodeConp : public Fix {
   bool read_inv, read_mat, write_inv, write_mat, write_vec;
   bool matrix_algo, need_array_compute, need_elec_vector;
   double eta, cg_threshold;
+  bool extrapolate;      // extrapolate initial guess for CG from previous steps
+  bool q_last_valid;     // q_last holds charges of the previous step
+  double *q_last;        // per-atom charges of the previous step
   double update_time, mult_time;
   long n_cg_step, n_call;
   void create_taglist();
@@ -72,6 +72,7 @@ PPPMElectrode::PPPMElectrode(LAMMPS *lmp) :
   if (lmp->citeme) lmp->citeme->add(cite_pppm_electrode);
 
   group_group_enable = 0;
+  potential_enable = 0;
   electrolyte_density_brick = nullptr;
   electrolyte_density_fft = nullptr;
   compute_vector_called = false;
@@ -56,6 +56,7 @@ PairSWGPU::PairSWGPU(LAMMPS *lmp) : PairSW(lmp), gpu_mode(GPU_FORCE)
   cpu_time = 0.0;
   reinitflag = 0;
   suffix_flag |= Suffix::GPU;
+  tabulate_enable = 0;
   GPU_EXTRA::gpu_ready(lmp->modify, lmp->error);
 
   cutghost = nullptr;
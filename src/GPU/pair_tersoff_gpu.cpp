@@ -60,6 +60,7 @@ PairTersoffGPU::PairTersoffGPU(LAMMPS *lmp) : PairTersoff(lmp), gpu_mode(GPU_FOR
 {
   cpu_time = 0.0;
   suffix_flag |= Suffix::GPU;
+  tabulate_enable = 0;
   GPU_EXTRA::gpu_ready(lmp->modify, lmp->error);
 
   cutghost = nullptr;
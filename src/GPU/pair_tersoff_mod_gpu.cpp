@@ -62,6 +62,7 @@ PairTersoffMODGPU::PairTersoffMODGPU(LAMMPS *lmp) : PairTersoffMOD(lmp), gpu_mod
 {
   cpu_time = 0.0;
   suffix_flag |= Suffix::GPU;
+  tabulate_enable = 0;
   GPU_EXTRA::gpu_ready(lmp->modify, lmp->error);
 
   cutghost = nullptr;
@@ -66,6 +66,7 @@ PairTersoffZBLGPU::PairTersoffZBLGPU(LAMMPS *lmp) : PairTersoffZBL(lmp), gpu_mod
 {
   cpu_time = 0.0;
   suffix_flag |= Suffix::GPU;
+  tabulate_enable = 0;
   GPU_EXTRA::gpu_ready(lmp->modify, lmp->error);
 
   cutghost = nullptr;
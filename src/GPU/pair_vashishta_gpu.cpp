@@ -61,6 +61,7 @@ PairVashishtaGPU::PairVashishtaGPU(LAMMPS *lmp) : PairVashishta(lmp), gpu_mode(G
   reinitflag = 0;
   gpu_allocated = false;
   suffix_flag |= Suffix::GPU;
+  tabulate_enable = 0;
   GPU_EXTRA::gpu_ready(lmp->modify, lmp->error);
 
   cutghost = nullptr;
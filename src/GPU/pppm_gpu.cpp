@@ -75,6 +75,7 @@ PPPMGPU::PPPMGPU(LAMMPS *lmp) : PPPM(lmp)
   density_brick_gpu = vd_brick = nullptr;
   kspace_split = false;
   im_real_space = false;
+  potential_enable = 0;
 
   GPU_EXTRA::gpu_ready(lmp->modify, lmp->error);
 }
@@ -72,6 +72,16 @@ void GranSubMod::mix_coeffs(double *icoeffs, double *jcoeffs)
   coeffs_to_local();
 }
 
+/* ----------------------------------------------------------------------
+   copy coefficients from an identically named sub model
+------------------------------------------------------------------------- */
+
+void GranSubMod::copy_coeffs(GranSubMod *src)
+{
+  for (int i = 0; i < num_coeffs; i++) coeffs[i] = src->coeffs[i];
+  coeffs_to_local();
+}
+
 /* ----------------------------------------------------------------------
    mixing of Young's modulus (E)
 ------------------------------------------------------------------------- */
@@ -29,6 +29,7 @@ namespace Granular_NS {
     double *coeffs;
     void read_restart();
     virtual void mix_coeffs(double *, double *);
+    virtual void copy_coeffs(GranSubMod *);
     virtual void coeffs_to_local(){};
     virtual void init(){};    // called after all sub models + coeffs defined
 
@@ -187,6 +187,18 @@ void GranSubModNormalHertzMaterial::mix_coeffs(double *icoeffs, double *jcoeffs)
   coeffs_to_local();
 }
 
+/* ---------------------------------------------------------------------- */
+
+void GranSubModNormalHertzMaterial::copy_coeffs(GranSubMod *src)
+{
+  for (int i = 0; i < num_coeffs; i++) coeffs[i] = src->coeffs[i];
+
+  mixed_coefficients = dynamic_cast<GranSubModNormalHertzMaterial *>(src)->mixed_coefficients;
+  if (mixed_coefficients) k = FOURTHIRDS * coeffs[0];
+
+  coeffs_to_local();
+}
+
 /* ----------------------------------------------------------------------
    DMT normal force
 ------------------------------------------------------------------------- */
@@ -237,6 +249,18 @@ void GranSubModNormalDMT::mix_coeffs(double *icoeffs, double *jcoeffs)
 
 /* ---------------------------------------------------------------------- */
 
+void GranSubModNormalDMT::copy_coeffs(GranSubMod *src)
+{
+  for (int i = 0; i < num_coeffs; i++) coeffs[i] = src->coeffs[i];
+
+  mixed_coefficients = dynamic_cast<GranSubModNormalDMT *>(src)->mixed_coefficients;
+  if (mixed_coefficients) k = FOURTHIRDS * coeffs[0];
+
+  coeffs_to_local();
+}
+
+/* ---------------------------------------------------------------------- */
+
 double GranSubModNormalDMT::calculate_forces()
 {
   Fne = k * gm->contact_radius * gm->delta;
@@ -305,6 +329,18 @@ void GranSubModNormalJKR::mix_coeffs(double *icoeffs, double *jcoeffs)
 
 /* ---------------------------------------------------------------------- */
 
+void GranSubModNormalJKR::copy_coeffs(GranSubMod *src)
+{
+  for (int i = 0; i < num_coeffs; i++) coeffs[i] = src->coeffs[i];
+
+  mixed_coefficients = dynamic_cast<GranSubModNormalJKR *>(src)->mixed_coefficients;
+  if (mixed_coefficients) Emix = coeffs[0];
+
+  coeffs_to_local();
+}
+
+/* ---------------------------------------------------------------------- */
+
 bool GranSubModNormalJKR::touch()
 {
   double delta_pulloff, dist_pulloff;
@@ -94,6 +94,7 @@ namespace Granular_NS {
     GranSubModNormalHertzMaterial(class GranularModel *, class LAMMPS *);
     void coeffs_to_local() override;
     void mix_coeffs(double *, double *) override;
+    void copy_coeffs(GranSubMod *) override;
    private:
     int mixed_coefficients;
   };
@@ -105,6 +106,7 @@ namespace Granular_NS {
     GranSubModNormalDMT(class GranularModel *, class LAMMPS *);
     void coeffs_to_local() override;
     void mix_coeffs(double *, double *) override;
+    void copy_coeffs(GranSubMod *) override;
     double calculate_forces() override;
     void set_fncrit() override;
 
@@ -121,6 +123,7 @@ namespace Granular_NS {
     GranSubModNormalJKR(class GranularModel *, class LAMMPS *);
     void coeffs_to_local() override;
     void mix_coeffs(double *, double *) override;
+    void copy_coeffs(GranSubMod *) override;
     bool touch() override;
     double pulloff_distance(double, double) override;
     double calculate_contact_radius() override;
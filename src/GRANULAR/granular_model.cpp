@@ -311,6 +311,29 @@ int GranularModel::mix_coeffs(GranularModel *g1, GranularModel *g2)
   return -1;
 }
 
+/* ----------------------------------------------------------------------
+   create an independent duplicate of an initialized model
+   used by threaded styles which need private per-contact scratch data
+------------------------------------------------------------------------- */
+
+void GranularModel::copy_model(GranularModel *src)
+{
+  contact_type = src->contact_type;
+  classic_model = src->classic_model;
+
+  for (int i = 0; i < NSUBMODELS; i++) {
+    construct_sub_model(src->sub_models[i]->name, (SubModelType) i);
+    sub_models[i]->copy_coeffs(src->sub_models[i]);
+    sub_models[i]->history_index = src->sub_models[i]->history_index;
+  }
+
+  limit_damping = src->limit_damping;
+  history_update = src->history_update;
+  dt = src->dt;
+
+  init();
+}
+
 /* ---------------------------------------------------------------------- */
 
 void GranularModel::write_restart(FILE *fp)
@@ -57,6 +57,7 @@ class GranularModel : protected Pointers {
   int define_classic_model(char **, int, int);
   void construct_sub_model(std::string, SubModelType);
   int mix_coeffs(GranularModel*, GranularModel*);
+  void copy_model(GranularModel*);
 
   void write_restart(FILE *);
   void read_restart(FILE *);
@@ -67,6 +67,10 @@ PairGranular::PairGranular(LAMMPS *lmp) : Pair(lmp)
 
   comm_forward = 1;
 
+  // read_restart() does not call settings(), derive the cutoff from particle sizes
+
+  cutoff_global = -1;
+
   use_history = 0;
   size_history = 0;
   beyond_contact = 0;
@@ -69,7 +69,6 @@ class PairGranular : public Pair {
   void transfer_history(double *, double *, int, int) override;
   void prune_models();
 
- private:
   int size_history;
   int heat_flag;
 
@@ -78,6 +77,7 @@ class PairGranular : public Pair {
   class Granular_NS::GranularModel **models_list;
   int **types_indices;
 
+ private:
   // optional user-specified global cutoff, per-type user-specified cutoffs
   double **cutoff_type;
   double cutoff_global;
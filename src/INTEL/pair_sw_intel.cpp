@@ -57,6 +57,7 @@ using namespace LAMMPS_NS;
 PairSWIntel::PairSWIntel(LAMMPS *lmp) : PairSW(lmp)
 {
   suffix_flag |= Suffix::INTEL;
+  tabulate_enable = 0;
 }
 
 /* ---------------------------------------------------------------------- */
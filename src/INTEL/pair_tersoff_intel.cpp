@@ -54,6 +54,7 @@ using namespace MathConst;
 PairTersoffIntel::PairTersoffIntel(LAMMPS *lmp) : PairTersoff(lmp)
 {
   suffix_flag |= Suffix::INTEL;
+  tabulate_enable = 0;
   respa_enable = 0;
 }
 
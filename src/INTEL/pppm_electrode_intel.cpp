@@ -74,6 +74,7 @@ PPPMElectrodeIntel::PPPMElectrodeIntel(LAMMPS *lmp) :
   if (lmp->citeme) lmp->citeme->add(cite_pppm_electrode);
 
   group_group_enable = 0;
+  potential_enable = 0;
   electrolyte_density_brick = nullptr;
   electrolyte_density_fft = nullptr;
   compute_vector_called = false;
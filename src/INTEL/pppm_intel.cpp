@@ -51,6 +51,7 @@ PPPMIntel::PPPMIntel(LAMMPS *lmp) : PPPM(lmp)
   suffix_flag |= Suffix::INTEL;
 
   order = 7; //sets default stencil size to 7
+  potential_enable = 0;
 
   perthread_density = nullptr;
   particle_ekx = particle_eky = particle_ekz = nullptr;
@@ -68,6 +68,11 @@ FixACKS2ReaxFFKokkos(LAMMPS *lmp, int narg, char **arg) :
   prev_last_rows_rank = 0;
 
   d_mfill_offset = typename AT::t_bigint_scalar("acks2/kk:mfill_offset");
+
+  if ((solver != SOLVER_STANDARD) || (precond != PRECOND_JACOBI))
+    error->all(FLERR,"Fix {} does not support the solver and precond keywords", style);
+  if (reuse_flag)
+    error->all(FLERR,"Fix {} does not support the reuse and reusetol keywords", style);
 }
 
 /* ---------------------------------------------------------------------- */
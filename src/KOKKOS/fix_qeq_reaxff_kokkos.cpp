@@ -75,6 +75,11 @@ FixQEqReaxFFKokkos(LAMMPS *lmp, int narg, char **arg) :
   d_mfill_offset = typename AT::t_bigint_scalar("qeq/kk:mfill_offset");
 
   converged = 0;
+
+  if ((solver != SOLVER_STANDARD) || (precond != PRECOND_JACOBI))
+    error->all(FLERR,"Fix {} does not support the solver and precond keywords", style);
+  if (reuse_flag)
+    error->all(FLERR,"Fix {} does not support the reuse and reusetol keywords", style);
 }
 
 /* ---------------------------------------------------------------------- */
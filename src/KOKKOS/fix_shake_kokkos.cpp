@@ -155,6 +155,9 @@ void FixShakeKokkos<DeviceType>::init()
   if (rattle)
     error->all(FLERR,"Cannot yet use KOKKOS package with fix rattle");
 
+  if (settle_flag)
+    error->all(FLERR,"Cannot yet use KOKKOS package with fix shake settle yes");
+
   // set equilibrium bond distances
 
   for (int i = 1; i <= atom->nbondtypes; i++)
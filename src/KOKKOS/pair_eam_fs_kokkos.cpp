@@ -45,6 +45,7 @@ PairEAMFSKokkos<DeviceType>::PairEAMFSKokkos(LAMMPS *lmp) : PairEAM(lmp)
 {
   respa_enable = 0;
   single_enable = 0;
+  energy_local_enable = 0;
   one_coeff = 1;
   manybody_flag = 1;
 
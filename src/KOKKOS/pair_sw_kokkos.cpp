@@ -43,6 +43,7 @@ template<class DeviceType>
 PairSWKokkos<DeviceType>::PairSWKokkos(LAMMPS *lmp) : PairSW(lmp)
 {
   respa_enable = 0;
+  tabulate_enable = 0;
 
   kokkosable = 1;
   atomKK = (AtomKokkos *) atom;
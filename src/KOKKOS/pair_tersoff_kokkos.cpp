@@ -65,6 +65,8 @@ template<class DeviceType>
 PairTersoffKokkos<DeviceType>::PairTersoffKokkos(LAMMPS *lmp) : PairTersoff(lmp)
 {
   respa_enable = 0;
+  tabulate_enable = 0;
+  energy_local_enable = 0;
   suffix_flag |= Suffix::KOKKOS;
 
   kokkosable = 1;
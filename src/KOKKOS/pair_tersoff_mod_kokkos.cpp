@@ -55,6 +55,8 @@ template<class DeviceType>
 PairTersoffMODKokkos<DeviceType>::PairTersoffMODKokkos(LAMMPS *lmp) : PairTersoffMOD(lmp)
 {
   respa_enable = 0;
+  tabulate_enable = 0;
+  energy_local_enable = 0;
   suffix_flag |= Suffix::KOKKOS;
 
   kokkosable = 1;
@@ -57,6 +57,8 @@ template<class DeviceType>
 PairTersoffZBLKokkos<DeviceType>::PairTersoffZBLKokkos(LAMMPS *lmp) : PairTersoffZBL(lmp)
 {
   respa_enable = 0;
+  tabulate_enable = 0;
+  energy_local_enable = 0;
   suffix_flag |= Suffix::KOKKOS;
 
   kokkosable = 1;
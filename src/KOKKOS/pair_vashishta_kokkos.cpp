@@ -42,6 +42,7 @@ template<class DeviceType>
 PairVashishtaKokkos<DeviceType>::PairVashishtaKokkos(LAMMPS *lmp) : PairVashishta(lmp)
 {
   respa_enable = 0;
+  tabulate_enable = 0;
 
   kokkosable = 1;
   atomKK = (AtomKokkos *) atom;
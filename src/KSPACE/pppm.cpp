@@ -69,6 +69,7 @@ PPPM::PPPM(LAMMPS *lmp) : KSpace(lmp),
 
   pppmflag = 1;
   group_group_enable = 1;
+  potential_enable = 1;
   triclinic = domain->triclinic;
 
   nfactors = 3;
@@ -3009,6 +3010,124 @@ double PPPM::memory_usage()
   return bytes;
 }
 
+/* ----------------------------------------------------------------------
+   long-range electrostatic potential of owned atoms due to charges qvec
+   phi = dE_long/dq including the self-energy correction, but without the
+     term from the neutralizing background, which is the same for all atoms
+   qvec must be allocated for owned atoms, atom->q is not changed
+   used as a matrix-free operator by charge equilibration solvers,
+     setup() must have been called for the current box
+ ------------------------------------------------------------------------- */
+
+void PPPM::compute_potential(double *qvec, double *phi)
+{
+  int i,j,k,l,m,n,nx,ny,nz,mx,my,mz;
+  FFT_SCALAR dx,dy,dz,x0,y0,z0,u;
+
+  if (slabflag)
+    error->all(FLERR,"Kspace style {} per-atom potential does not support slab correction",
+               force->kspace_style);
+
+  // potential is computed via the per-atom energy brick in ik mode
+
+  if (differentiation_flag != 1 && !peratom_allocate_flag) allocate_peratom();
+
+  if (triclinic == 0) boxlo = domain->boxlo;
+  else {
+    boxlo = domain->boxlo_lamda;
+    domain->x2lamda(atom->nlocal);
+  }
+
+  if (atom->nmax > nmax) {
+    memory->destroy(part2grid);
+    nmax = atom->nmax;
+    memory->create(part2grid,nmax,3,"pppm:part2grid");
+  }
+
+  // temporarily swap in qvec as charges to map them onto the grid
+
+  double *q_save = atom->q;
+  atom->q = qvec;
+
+  particle_map();
+  make_rho();
+
+  atom->q = q_save;
+
+  gc->reverse_comm(Grid3d::KSPACE,this,REVERSE_RHO,1,sizeof(FFT_SCALAR),
+                   gc_buf1,gc_buf2,MPI_FFT_SCALAR);
+  brick2fft();
+
+  // V(k) = G(k) rho(k), transformed back to u_brick
+
+  n = 0;
+  for (i = 0; i < nfft; i++) {
+    work1[n++] = density_fft[i];
+    work1[n++] = ZEROF;
+  }
+
+  fft1->compute(work1,work1,FFT3d::FORWARD);
+
+  const double scaleinv = 1.0/((bigint) nx_pppm * ny_pppm * nz_pppm);
+
+  n = 0;
+  for (i = 0; i < nfft; i++) {
+    work1[n] *= scaleinv * greensfn[i];
+    work1[n+1] *= scaleinv * greensfn[i];
+    n += 2;
+  }
+
+  fft2->compute(work1,work1,FFT3d::BACKWARD);
+
+  n = 0;
+  for (k = nzlo_in; k <= nzhi_in; k++)
+    for (j = nylo_in; j <= nyhi_in; j++)
+      for (i = nxlo_in; i <= nxhi_in; i++) {
+        u_brick[k][j][i] = work1[n];
+        n += 2;
+      }
+
+  gc->forward_comm(Grid3d::KSPACE,this,FORWARD_AD,1,sizeof(FFT_SCALAR),
+                   gc_buf1,gc_buf2,MPI_FFT_SCALAR);
+
+  // interpolate potential to my particles
+
+  const double qscale = qqrd2e * scale;
+  const double selfcoeff = 2.0*g_ewald/MY_PIS;
+  double **x = atom->x;
+  const int nlocal = atom->nlocal;
+
+  for (i = 0; i < nlocal; i++) {
+    nx = part2grid[i][0];
+    ny = part2grid[i][1];
+    nz = part2grid[i][2];
+    dx = nx+shiftone - (x[i][0]-boxlo[0])*delxinv;
+    dy = ny+shiftone - (x[i][1]-boxlo[1])*delyinv;
+    dz = nz+shiftone - (x[i][2]-boxlo[2])*delzinv;
+
+    compute_rho1d(dx,dy,dz);
+
+    u = ZEROF;
+    for (n = nlower; n <= nupper; n++) {
+      mz = n+nz;
+      z0 = rho1d[2][n];
+      for (m = nlower; m <= nupper; m++) {
+        my = m+ny;
+        y0 = z0*rho1d[1][m];
+        for (l = nlower; l <= nupper; l++) {
+          mx = l+nx;
+          x0 = y0*rho1d[0][l];
+          u += x0*u_brick[mz][my][mx];
+        }
+      }
+    }
+
+    phi[i] = qscale * (u - selfcoeff*qvec[i]);
+  }
+
+  if (triclinic) domain->lamda2x(atom->nlocal);
+}
+
 /* ----------------------------------------------------------------------
    group-group interactions
  ------------------------------------------------------------------------- */
@@ -39,6 +39,7 @@ class PPPM : public KSpace {
   double memory_usage() override;
 
   void compute_group_group(int, int, int) override;
+  void compute_potential(double *, double *) override;
 
  protected:
   int me, nprocs;
@@ -66,6 +66,7 @@ PPPMDipole::PPPMDipole(LAMMPS *lmp) : PPPM(lmp),
 {
   dipoleflag = 1;
   group_group_enable = 0;
+  potential_enable = 0;
 
   gc_dipole = nullptr;
 }
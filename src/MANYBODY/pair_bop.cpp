@@ -193,9 +193,9 @@ void PairBOP::compute(int eflag, int vflag)
   int i, ii, j, jj;
   int nlisti, *ilist;
   tagint i_tag,j_tag, itype, jtype;
-  int temp_ij;
+  int temp_ij, nb_t, loop, n, bt_i, bt_j;
   double sigB_0, piB_0;
-  double dpr1, dpr2, ftmp1, ftmp2, ftmp3, dE;
+  double dpr1, dpr2, ftmp1, ftmp2, ftmp3, dE, pp, ftmp[3];
 
   int newton_pair = force->newton_pair;
   int nlocal = atom->nlocal;
@@ -234,13 +234,43 @@ void PairBOP::compute(int eflag, int vflag)
       }
       jtype = map[type[j]];
       int param_ij = elem2param[itype][jtype];
-      sigB_0 = SigmaBo(ii,jj);
+      PairList1 & pl_ij = pairlist1[temp_ij];
+
+      // forces from the derivatives of the bond orders w.r.t. all
+      // pairs that contribute to them
+
+      sigB_0 = SigmaBo(ii,jj,bt_sg,sglimit,nb_t);
+      pp = 2.0*pl_ij.betaS;
+      for (loop = 0; loop < nb_t; loop++) {
+        bt_i = bt_sg[loop].i;
+        bt_j = bt_sg[loop].j;
+        for (n = 0; n < 3; n++) {
+          ftmp[n] = pp*bt_sg[loop].dSigB[n];
+          f[bt_i][n] -= ftmp[n];
+          f[bt_j][n] += ftmp[n];
+        }
+        if (evflag) ev_tally_xyz(bt_i,bt_j,nlocal,newton_pair,0.0,0.0,
+                                 -ftmp[0],-ftmp[1],-ftmp[2],x[bt_i][0]-x[bt_j][0],
+                                 x[bt_i][1]-x[bt_j][1],x[bt_i][2]-x[bt_j][2]);
+      }
       if (pi_a[param_ij] == 0) {
         piB_0 = 0.0;
       } else {
-        piB_0 = PiBo(ii,jj);
+        piB_0 = PiBo(ii,jj,bt_pi,pilimit,nb_t);
+        pp = 2.0*pl_ij.betaP;
+        for (loop = 0; loop < nb_t; loop++) {
+          bt_i = bt_pi[loop].i;
+          bt_j = bt_pi[loop].j;
+          for (n = 0; n < 3; n++) {
+            ftmp[n] = pp*bt_pi[loop].dPiB[n];
+            f[bt_i][n] -= ftmp[n];
+            f[bt_j][n] += ftmp[n];
+          }
+          if (evflag) ev_tally_xyz(bt_i,bt_j,nlocal,newton_pair,0.0,0.0,
+                                   -ftmp[0],-ftmp[1],-ftmp[2],x[bt_i][0]-x[bt_j][0],
+                                   x[bt_i][1]-x[bt_j][1],x[bt_i][2]-x[bt_j][2]);
+        }
       }
-      PairList1 & pl_ij = pairlist1[temp_ij];
       dpr1 = (pl_ij.dRep - 2.0*pl_ij.dBetaS*sigB_0 -
               2.0*pl_ij.dBetaP*piB_0) / pl_ij.r;
       ftmp1 = dpr1 * pl_ij.dis[0];
@@ -657,12 +687,12 @@ void PairBOP::angle(double r1, double *dis1, double r2, double *dis2,
 /*  The formulation differs slightly to avoid negative square roots
     in the calculation of Theta_pi,ij of (a) Eq. 36 and (b) Eq. 18 */
 
-double PairBOP::SigmaBo(int itmp, int jtmp)
+double PairBOP::SigmaBo(int itmp, int jtmp, B_SG *&bt, int &btlimit, int &nb)
 {
-  double sigB, sigB1, dsigB, ftmp[3], xtmp[3];
+  double sigB, sigB1, dsigB;
   int i, j, k;
   int itype, jtype, ktype;
-  int nb_t, nb_ij, nb_ik, nb_jk, bt_i, bt_j;
+  int nb_t, nb_ij, nb_ik, nb_jk;
   int n_ji, n_jk, n_ki, n_kj, n_jik, n_ijk, n_ikj, pass_jk;
   int temp_ij, temp_ik, temp_jk, temp_kk, temp_jik, temp_ijk, temp_ikj;
   int *ilist, *jlist, *klist;
@@ -675,7 +705,7 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
   double cosAng_jik, dcA_jik[3][2], cosAng_ijk, dcA_ijk[3][2],
     cosAng_ikj, dcA_ikj[3][2];
   int nfound, loop, temp_loop, nei_loop, nei;
-  double AA, BB, EE1, FF, AAC, pp1;
+  double AA, BB, EE1, FF, AAC;
   double gfactor1, gprime1, gfactor2, gprime2, gfactor3, gprime3,
     gfactor, gfactorsq, gsqprime, gcm1, gcm2, gcm3,
     rfactor, rcm1, rcm2;
@@ -683,15 +713,14 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
     part0, part1, part2, part3, part4;
   int ktmp;
 
-  int newton_pair = force->newton_pair;
   int nlocal = atom->nlocal;
   double **x = atom->x;
-  double **f = atom->f;
   int *type = atom->type;
   int *iilist = list->ilist;
   int **firstneigh = list->firstneigh;
 
   sigB = 0.0;
+  nb = 0;
   if (itmp < nlocal) {
     i = iilist[itmp];
   } else {
@@ -699,8 +728,8 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
   }
 
   nb_t = 0;
-  memory_sg(nb_t);
-  initial_sg(nb_t);
+  memory_sg(bt, btlimit, nb_t);
+  initial_sg(bt, nb_t);
 
   itype = map[type[i]];
   ilist = firstneigh[i];
@@ -714,12 +743,12 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
   int param_ij = elem2param[itype][jtype];
   PairParameters & p_ij = pairParameters[param_ij];
   nb_ij = nb_t;
-  bt_sg[nb_ij].i = i;
-  bt_sg[nb_ij].j = j;
-  bt_sg[nb_ij].temp = temp_ij;
+  bt[nb_ij].i = i;
+  bt[nb_ij].j = j;
+  bt[nb_ij].temp = temp_ij;
   nb_t++;
-  memory_sg(nb_t);
-  initial_sg(nb_t);
+  memory_sg(bt, btlimit, nb_t);
+  initial_sg(bt, nb_t);
 
   for (loop = 0; loop < nlistj; loop++) {
     temp_loop = BOP_index[j] + loop;
@@ -760,9 +789,9 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
   // dXX derivatives are taken with respect to all pairs contributing to the energy
   // nb_ij is derivative w.r.t. ij pair
 
-  bt_sg[nb_ij].dFF[0] = agpdpr1 * dis_ij[0];
-  bt_sg[nb_ij].dFF[1] = agpdpr1 * dis_ij[1];
-  bt_sg[nb_ij].dFF[2] = agpdpr1 * dis_ij[2];
+  bt[nb_ij].dFF[0] = agpdpr1 * dis_ij[0];
+  bt[nb_ij].dFF[1] = agpdpr1 * dis_ij[1];
+  bt[nb_ij].dFF[2] = agpdpr1 * dis_ij[2];
 
   // k is loop over all neighbors of i again with j neighbor of i
 
@@ -808,12 +837,12 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
     }
 
     nb_ik = nb_t;
-    bt_sg[nb_ik].i = i;
-    bt_sg[nb_ik].j = k;
-    bt_sg[nb_ik].temp = temp_ik;
+    bt[nb_ik].i = i;
+    bt[nb_ik].j = k;
+    bt[nb_ik].temp = temp_ik;
     nb_t++;
-    memory_sg(nb_t);
-    initial_sg(nb_t);
+    memory_sg(bt, btlimit, nb_t);
+    initial_sg(bt, nb_t);
     if (pass_jk) {
       for (loop = 0; loop < nlistj; loop++) {
         temp_loop = BOP_index[j] + loop;
@@ -826,12 +855,12 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
         }
       }
       nb_jk = nb_t;
-      bt_sg[nb_jk].i = j;
-      bt_sg[nb_jk].j = k;
-      bt_sg[nb_jk].temp = temp_jk;
+      bt[nb_jk].i = j;
+      bt[nb_jk].j = k;
+      bt[nb_jk].temp = temp_jk;
       nb_t++;
-      memory_sg(nb_t);
-      initial_sg(nb_t);
+      memory_sg(bt, btlimit, nb_t);
+      initial_sg(bt, nb_t);
     }
 
     if (!otfly) {
@@ -883,12 +912,12 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
 
     agpdpr1 = 2.0 * gfactorsq * betaS_ik * dBetaS_ik / r_ik;
     app1 = betaS_ik * betaS_ik * gsqprime;
-    bt_sg[nb_ij].dAA[0] += app1*dcA_jik[0][0];
-    bt_sg[nb_ij].dAA[1] += app1*dcA_jik[1][0];
-    bt_sg[nb_ij].dAA[2] += app1*dcA_jik[2][0];
-    bt_sg[nb_ik].dAA[0] += app1*dcA_jik[0][1] + agpdpr1*dis_ik[0];
-    bt_sg[nb_ik].dAA[1] += app1*dcA_jik[1][1] + agpdpr1*dis_ik[1];
-    bt_sg[nb_ik].dAA[2] += app1*dcA_jik[2][1] + agpdpr1*dis_ik[2];
+    bt[nb_ij].dAA[0] += app1*dcA_jik[0][0];
+    bt[nb_ij].dAA[1] += app1*dcA_jik[1][0];
+    bt[nb_ij].dAA[2] += app1*dcA_jik[2][0];
+    bt[nb_ik].dAA[0] += app1*dcA_jik[0][1] + agpdpr1*dis_ik[0];
+    bt[nb_ik].dAA[1] += app1*dcA_jik[1][1] + agpdpr1*dis_ik[1];
+    bt[nb_ik].dAA[2] += app1*dcA_jik[2][1] + agpdpr1*dis_ik[2];
 
     // k' is loop over neighbors all neighbors of j with k a neighbor
     // of i and j a neighbor of i and determine which k' is k
@@ -993,20 +1022,20 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
     gcm1 = rfactor*gprime1*gfactor2*gfactor3;
     gcm2 = rfactor*gfactor1*gprime2*gfactor3;
     gcm3 = rfactor*gfactor1*gfactor2*gprime3;
-    bt_sg[nb_ij].dEE1[0] += gcm1*dcA_jik[0][0] - gcm2*dcA_ijk[0][0];
-    bt_sg[nb_ij].dEE1[1] += gcm1*dcA_jik[1][0] - gcm2*dcA_ijk[1][0];
-    bt_sg[nb_ij].dEE1[2] += gcm1*dcA_jik[2][0] - gcm2*dcA_ijk[2][0];
-    bt_sg[nb_ik].dEE1[0] += gcm1*dcA_jik[0][1] + rcm1*dis_ik[0] -
+    bt[nb_ij].dEE1[0] += gcm1*dcA_jik[0][0] - gcm2*dcA_ijk[0][0];
+    bt[nb_ij].dEE1[1] += gcm1*dcA_jik[1][0] - gcm2*dcA_ijk[1][0];
+    bt[nb_ij].dEE1[2] += gcm1*dcA_jik[2][0] - gcm2*dcA_ijk[2][0];
+    bt[nb_ik].dEE1[0] += gcm1*dcA_jik[0][1] + rcm1*dis_ik[0] -
       gcm3*dcA_ikj[0][0];
-    bt_sg[nb_ik].dEE1[1] += gcm1*dcA_jik[1][1] + rcm1*dis_ik[1] -
+    bt[nb_ik].dEE1[1] += gcm1*dcA_jik[1][1] + rcm1*dis_ik[1] -
       gcm3*dcA_ikj[1][0];
-    bt_sg[nb_ik].dEE1[2] += gcm1*dcA_jik[2][1] + rcm1*dis_ik[2] -
+    bt[nb_ik].dEE1[2] += gcm1*dcA_jik[2][1] + rcm1*dis_ik[2] -
       gcm3*dcA_ikj[2][0];
-    bt_sg[nb_jk].dEE1[0] += gcm2*dcA_ijk[0][1] + rcm2*dis_jk[0] -
+    bt[nb_jk].dEE1[0] += gcm2*dcA_ijk[0][1] + rcm2*dis_jk[0] -
       gcm3*dcA_ikj[0][1];
-    bt_sg[nb_jk].dEE1[1] += gcm2*dcA_ijk[1][1] + rcm2*dis_jk[1] -
+    bt[nb_jk].dEE1[1] += gcm2*dcA_ijk[1][1] + rcm2*dis_jk[1] -
       gcm3*dcA_ikj[1][1];
-    bt_sg[nb_jk].dEE1[2] += gcm2*dcA_ijk[2][1] + rcm2*dis_jk[2] -
+    bt[nb_jk].dEE1[2] += gcm2*dcA_ijk[2][1] + rcm2*dis_jk[2] -
       gcm3*dcA_ikj[2][1];
   }
 
@@ -1025,12 +1054,12 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
     dBetaS_jk = pl_jk.dBetaS;
 
     nb_jk = nb_t;
-    bt_sg[nb_jk].i = j;
-    bt_sg[nb_jk].j = k;
-    bt_sg[nb_jk].temp = temp_jk;
+    bt[nb_jk].i = j;
+    bt[nb_jk].j = k;
+    bt[nb_jk].temp = temp_jk;
     nb_t++;
-    memory_sg(nb_t);
-    initial_sg(nb_t);
+    memory_sg(bt, btlimit, nb_t);
+    initial_sg(bt, nb_t);
 
     if (!otfly) {
       if (n_ji < n_jk) {
@@ -1081,19 +1110,19 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
 
     agpdpr1 = 2.0 * gfactorsq * betaS_jk * dBetaS_jk / r_jk;
     app1 = betaS_jk * betaS_jk * gsqprime;
-    bt_sg[nb_ij].dBB[0] -= app1*dcA_ijk[0][0];
-    bt_sg[nb_ij].dBB[1] -= app1*dcA_ijk[1][0];
-    bt_sg[nb_ij].dBB[2] -= app1*dcA_ijk[2][0];
-    bt_sg[nb_jk].dBB[0] += app1*dcA_ijk[0][1] + agpdpr1*dis_jk[0];
-    bt_sg[nb_jk].dBB[1] += app1*dcA_ijk[1][1] + agpdpr1*dis_jk[1];
-    bt_sg[nb_jk].dBB[2] += app1*dcA_ijk[2][1] + agpdpr1*dis_jk[2];
+    bt[nb_ij].dBB[0] -= app1*dcA_ijk[0][0];
+    bt[nb_ij].dBB[1] -= app1*dcA_ijk[1][0];
+    bt[nb_ij].dBB[2] -= app1*dcA_ijk[2][0];
+    bt[nb_jk].dBB[0] += app1*dcA_ijk[0][1] + agpdpr1*dis_jk[0];
+    bt[nb_jk].dBB[1] += app1*dcA_ijk[1][1] + agpdpr1*dis_jk[1];
+    bt[nb_jk].dBB[2] += app1*dcA_ijk[2][1] + agpdpr1*dis_jk[2];
   }
 
   AAC = AA + BB;
   for (loop = 0; loop < nb_t; loop++) {
-    bt_sg[loop].dAAC[0] = bt_sg[loop].dAA[0] + bt_sg[loop].dBB[0];
-    bt_sg[loop].dAAC[1] = bt_sg[loop].dAA[1] + bt_sg[loop].dBB[1];
-    bt_sg[loop].dAAC[2] = bt_sg[loop].dAA[2] + bt_sg[loop].dBB[2];
+    bt[loop].dAAC[0] = bt[loop].dAA[0] + bt[loop].dBB[0];
+    bt[loop].dAAC[1] = bt[loop].dAA[1] + bt[loop].dBB[1];
+    bt[loop].dAAC[2] = bt[loop].dAA[2] + bt[loop].dBB[2];
   }
   bndtmp = FF + sigma_delta[param_ij]*sigma_delta[param_ij] +
     sigma_c[param_ij]*AAC + small4;
@@ -1107,14 +1136,14 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
   bndtmp1 = (bndtmp0+betaS_ij*bndtmp*2.0*betaS_ij) * dBetaS_ij/r_ij;
   bndtmp2 = betaS_ij*bndtmp*sigma_c[param_ij];
   for (loop = 0; loop < nb_t; loop++) {
-    temp_kk = bt_sg[loop].temp;
-    bt_sg[loop].dSigB1[0] = bndtmp2*bt_sg[loop].dAAC[0];
-    bt_sg[loop].dSigB1[1] = bndtmp2*bt_sg[loop].dAAC[1];
-    bt_sg[loop].dSigB1[2] = bndtmp2*bt_sg[loop].dAAC[2];
+    temp_kk = bt[loop].temp;
+    bt[loop].dSigB1[0] = bndtmp2*bt[loop].dAAC[0];
+    bt[loop].dSigB1[1] = bndtmp2*bt[loop].dAAC[1];
+    bt[loop].dSigB1[2] = bndtmp2*bt[loop].dAAC[2];
     if (temp_kk == temp_ij) {
-      bt_sg[loop].dSigB1[0] += bndtmp1*dis_ij[0];
-      bt_sg[loop].dSigB1[1] += bndtmp1*dis_ij[1];
-      bt_sg[loop].dSigB1[2] += bndtmp1*dis_ij[2];
+      bt[loop].dSigB1[0] += bndtmp1*dis_ij[0];
+      bt[loop].dSigB1[1] += bndtmp1*dis_ij[1];
+      bt[loop].dSigB1[2] += bndtmp1*dis_ij[2];
     }
   }
 
@@ -1130,39 +1159,20 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
     sigB *= part2;
   }
 
-  pp1 = 2.0*betaS_ij;
   for (loop = 0; loop < nb_t; loop++) {
-    bt_i = bt_sg[loop].i;
-    bt_j = bt_sg[loop].j;
-    xtmp[0] = x[bt_i][0]-x[bt_j][0];
-    xtmp[1] = x[bt_i][1]-x[bt_j][1];
-    xtmp[2] = x[bt_i][2]-x[bt_j][2];
     if (sigma_f[param_ij] == 0.5 || sigma_k[param_ij] == 0.0) {
       for (int n = 0; n < 3; n++) {
-        bt_sg[loop].dSigB[n] = dsigB*bt_sg[loop].dSigB1[n];
+        bt[loop].dSigB[n] = dsigB*bt[loop].dSigB1[n];
       }
-      for (int n = 0; n < 3; n++) {
-        ftmp[n] = pp1*bt_sg[loop].dSigB[n];
-        f[bt_i][n] -= ftmp[n];
-        f[bt_j][n] += ftmp[n];
-      }
-      if (evflag) ev_tally_xyz(bt_i,bt_j,nlocal,newton_pair,0.0,0.0,
-                               -ftmp[0],-ftmp[1],-ftmp[2],xtmp[0],xtmp[1],xtmp[2]);
     } else {
       for (int n = 0; n < 3; n++) {
-        bt_sg[loop].dSigB[n] = dsigB*part2*bt_sg[loop].dSigB1[n] -
-          part3*bt_sg[loop].dEE1[n] + part4*(bt_sg[loop].dFF[n] +
-                                             0.5*bt_sg[loop].dAAC[n]);
+        bt[loop].dSigB[n] = dsigB*part2*bt[loop].dSigB1[n] -
+          part3*bt[loop].dEE1[n] + part4*(bt[loop].dFF[n] +
+                                          0.5*bt[loop].dAAC[n]);
       }
-      for (int n = 0; n < 3; n++) {
-        ftmp[n] = pp1*bt_sg[loop].dSigB[n];
-        f[bt_i][n] -= ftmp[n];
-        f[bt_j][n] += ftmp[n];
-      }
-      if (evflag) ev_tally_xyz(bt_i,bt_j,nlocal,newton_pair,0.0,0.0,
-                               -ftmp[0],-ftmp[1],-ftmp[2],xtmp[0],xtmp[1],xtmp[2]);
     }
   }
+  nb = nb_t;
   return(sigB);
 }
 
@@ -1174,12 +1184,12 @@ double PairBOP::SigmaBo(int itmp, int jtmp)
 
 /* ---------------------------------------------------------------------- */
 
-double PairBOP::PiBo(int itmp, int jtmp)
+double PairBOP::PiBo(int itmp, int jtmp, B_PI *&bt, int &btlimit, int &nb)
 {
-  double piB, ftmp[3], xtmp[3];
+  double piB;
   int i, j, k, kp;
   int itype, jtype;
-  int nb_t, nb_ij, nb_ik, nb_ikp, nb_jk, nb_jkp, bt_i, bt_j;
+  int nb_t, nb_ij, nb_ik, nb_ikp, nb_jk, nb_jkp;
   int n_ji, n_jik, n_jikp, n_kikp, n_ijk, n_ijkp, n_kjkp;
   int temp_ij, temp_ik, temp_ikp, temp_jk, temp_jkp, temp_kk, temp_jik,
     temp_jikp, temp_kikp, temp_ijk, temp_ijkp, temp_kjkp;
@@ -1196,7 +1206,7 @@ double PairBOP::PiBo(int itmp, int jtmp)
     cosAng_kikp, dcA_kikp[3][2], cosAng_ijk, dcA_ijk[3][2], cosAng_ijkp,
     dcA_ijkp[3][2], cosAng_kjkp, dcA_kjkp[3][2];
   double AA, BB, AB1, AB2, CC, BBrt, BBrtR, ABrtR1, ABrtR2, dPiB1, dPiB2,
-    dPiB3, pp2;
+    dPiB3;
   double cosSq, cosSq1, sinFactor, cosFactor, betaCapSq1,
     dbetaCapSq1, betaCapSq2, dbetaCapSq2, agpdpr1, agpdpr2, agpdpr3,
     app1, app2, app3, angFactor, angFactor1, angFactor2, angFactor3,
@@ -1204,10 +1214,8 @@ double PairBOP::PiBo(int itmp, int jtmp)
   int loop, temp_loop, nei_loop, nei;
   int ktmp, ltmp;
 
-  int newton_pair = force->newton_pair;
   int nlocal = atom->nlocal;
   double **x = atom->x;
-  double **f = atom->f;
   int *type = atom->type;
   int *iilist = list->ilist;
   int **firstneigh = list->firstneigh;
@@ -1215,6 +1223,7 @@ double PairBOP::PiBo(int itmp, int jtmp)
   // Loop over all local atoms for i
 
   piB = 0;
+  nb = 0;
   if (itmp < nlocal) {
     i = iilist[itmp];
   } else {
@@ -1222,8 +1231,8 @@ double PairBOP::PiBo(int itmp, int jtmp)
   }
 
   nb_t = 0;
-  memory_pi(nb_t);
-  initial_pi(nb_t);
+  memory_pi(bt, btlimit, nb_t);
+  initial_pi(bt, nb_t);
 
   itype = map[type[i]];
   ilist = firstneigh[i];
@@ -1236,12 +1245,12 @@ double PairBOP::PiBo(int itmp, int jtmp)
   nlistj = BOP_total[j];
   int param_ij = elem2param[itype][jtype];
   nb_ij = nb_t;
-  bt_pi[nb_ij].i = i;
-  bt_pi[nb_ij].j = j;
-  bt_pi[nb_ij].temp = temp_ij;
+  bt[nb_ij].i = i;
+  bt[nb_ij].j = j;
+  bt[nb_ij].temp = temp_ij;
   nb_t++;
-  memory_pi(nb_t);
-  initial_pi(nb_t);
+  memory_pi(bt, btlimit, nb_t);
+  initial_pi(bt, nb_t);
 
   for (loop = 0; loop < nlistj; loop++) {
     temp_loop = BOP_index[j] + loop;
@@ -1285,12 +1294,12 @@ double PairBOP::PiBo(int itmp, int jtmp)
     dBetaP_ik = pl_ik.dBetaP;
 
     nb_ik = nb_t;
-    bt_pi[nb_ik].i = i;
-    bt_pi[nb_ik].j = k;
-    bt_pi[nb_ik].temp = temp_ik;
+    bt[nb_ik].i = i;
+    bt[nb_ik].j = k;
+    bt[nb_ik].temp = temp_ik;
     nb_t++;
-    memory_pi(nb_t);
-    initial_pi(nb_t);
+    memory_pi(bt, btlimit, nb_t);
+    initial_pi(bt, nb_t);
 
     if (!otfly) {
       if (jtmp < ktmp) {
@@ -1347,18 +1356,18 @@ double PairBOP::PiBo(int itmp, int jtmp)
     agpdpr2 = 0.5*(1.0-cosSq)*(1.0-cosSq)*betaCapSq1*dbetaCapSq1 / r_ik;
     app1 = cosAng_jik*(betaP_ik*betaP_ik-pi_p[itype]*betaS_ik*betaS_ik);
     app2 = (cosSq-1.0)*cosAng_jik*betaCapSq1*betaCapSq1;
-    bt_pi[nb_ij].dAA[0] += app1*dcA_jik[0][0];
-    bt_pi[nb_ij].dAA[1] += app1*dcA_jik[1][0];
-    bt_pi[nb_ij].dAA[2] += app1*dcA_jik[2][0];
-    bt_pi[nb_ij].dBB[0] += app2*dcA_jik[0][0];
-    bt_pi[nb_ij].dBB[1] += app2*dcA_jik[1][0];
-    bt_pi[nb_ij].dBB[2] += app2*dcA_jik[2][0];
-    bt_pi[nb_ik].dAA[0] += agpdpr1*dis_ik[0] + app1*dcA_jik[0][1];
-    bt_pi[nb_ik].dAA[1] += agpdpr1*dis_ik[1] + app1*dcA_jik[1][1];
-    bt_pi[nb_ik].dAA[2] += agpdpr1*dis_ik[2] + app1*dcA_jik[2][1];
-    bt_pi[nb_ik].dBB[0] += agpdpr2*dis_ik[0] + app2*dcA_jik[0][1];
-    bt_pi[nb_ik].dBB[1] += agpdpr2*dis_ik[1] + app2*dcA_jik[1][1];
-    bt_pi[nb_ik].dBB[2] += agpdpr2*dis_ik[2] + app2*dcA_jik[2][1];
+    bt[nb_ij].dAA[0] += app1*dcA_jik[0][0];
+    bt[nb_ij].dAA[1] += app1*dcA_jik[1][0];
+    bt[nb_ij].dAA[2] += app1*dcA_jik[2][0];
+    bt[nb_ij].dBB[0] += app2*dcA_jik[0][0];
+    bt[nb_ij].dBB[1] += app2*dcA_jik[1][0];
+    bt[nb_ij].dBB[2] += app2*dcA_jik[2][0];
+    bt[nb_ik].dAA[0] += agpdpr1*dis_ik[0] + app1*dcA_jik[0][1];
+    bt[nb_ik].dAA[1] += agpdpr1*dis_ik[1] + app1*dcA_jik[1][1];
+    bt[nb_ik].dAA[2] += agpdpr1*dis_ik[2] + app1*dcA_jik[2][1];
+    bt[nb_ik].dBB[0] += agpdpr2*dis_ik[0] + app2*dcA_jik[0][1];
+    bt[nb_ik].dBB[1] += agpdpr2*dis_ik[1] + app2*dcA_jik[1][1];
+    bt[nb_ik].dBB[2] += agpdpr2*dis_ik[2] + app2*dcA_jik[2][1];
 
     // j and k and k' are different neighbors of i
 
@@ -1377,12 +1386,12 @@ double PairBOP::PiBo(int itmp, int jtmp)
       dBetaP_ikp = pl_ikp.dBetaP;
 
       nb_ikp = nb_t;
-      bt_pi[nb_ikp].i = i;
-      bt_pi[nb_ikp].j = kp;
-      bt_pi[nb_ikp].temp = temp_ikp;
+      bt[nb_ikp].i = i;
+      bt[nb_ikp].j = kp;
+      bt[nb_ikp].temp = temp_ikp;
       nb_t++;
-      memory_pi(nb_t);
-      initial_pi(nb_t);
+      memory_pi(bt, btlimit, nb_t);
+      initial_pi(bt, nb_t);
 
       if (!otfly) {
         n_kikp = ltmp*(2*nlisti-ltmp-1)/2 + (ktmp-ltmp)-1;
@@ -1463,20 +1472,20 @@ double PairBOP::PiBo(int itmp, int jtmp)
       app1 = betaCapSum*angFactor1;
       app2 = betaCapSum*angFactor2;
       app3 = betaCapSum*angFactor3;
-      bt_pi[nb_ij].dBB[0] += app2*dcA_jik[0][0] + app3*dcA_jikp[0][0];
-      bt_pi[nb_ij].dBB[1] += app2*dcA_jik[1][0] + app3*dcA_jikp[1][0];
-      bt_pi[nb_ij].dBB[2] += app2*dcA_jik[2][0] + app3*dcA_jikp[2][0];
-      bt_pi[nb_ik].dBB[0] += agpdpr1*dis_ik[0] + app1*dcA_kikp[0][0] +
+      bt[nb_ij].dBB[0] += app2*dcA_jik[0][0] + app3*dcA_jikp[0][0];
+      bt[nb_ij].dBB[1] += app2*dcA_jik[1][0] + app3*dcA_jikp[1][0];
+      bt[nb_ij].dBB[2] += app2*dcA_jik[2][0] + app3*dcA_jikp[2][0];
+      bt[nb_ik].dBB[0] += agpdpr1*dis_ik[0] + app1*dcA_kikp[0][0] +
         app2*dcA_jik[0][1];
-      bt_pi[nb_ik].dBB[1] += agpdpr1*dis_ik[1] + app1*dcA_kikp[1][0] +
+      bt[nb_ik].dBB[1] += agpdpr1*dis_ik[1] + app1*dcA_kikp[1][0] +
         app2*dcA_jik[1][1];
-      bt_pi[nb_ik].dBB[2] += agpdpr1*dis_ik[2] + app1*dcA_kikp[2][0] +
+      bt[nb_ik].dBB[2] += agpdpr1*dis_ik[2] + app1*dcA_kikp[2][0] +
         app2*dcA_jik[2][1];
-      bt_pi[nb_ikp].dBB[0] += agpdpr2*dis_ikp[0] + app1*dcA_kikp[0][1] +
+      bt[nb_ikp].dBB[0] += agpdpr2*dis_ikp[0] + app1*dcA_kikp[0][1] +
         app3*dcA_jikp[0][1];
-      bt_pi[nb_ikp].dBB[1] += agpdpr2*dis_ikp[1] + app1*dcA_kikp[1][1] +
+      bt[nb_ikp].dBB[1] += agpdpr2*dis_ikp[1] + app1*dcA_kikp[1][1] +
         app3*dcA_jikp[1][1];
-      bt_pi[nb_ikp].dBB[2] += agpdpr2*dis_ikp[2] + app1*dcA_kikp[2][1] +
+      bt[nb_ikp].dBB[2] += agpdpr2*dis_ikp[2] + app1*dcA_kikp[2][1] +
         app3*dcA_jikp[2][1];
     }
   }
@@ -1497,12 +1506,12 @@ double PairBOP::PiBo(int itmp, int jtmp)
     dBetaP_jk = pl_jk.dBetaP;
 
     nb_jk = nb_t;
-    bt_pi[nb_jk].i = j;
-    bt_pi[nb_jk].j = k;
-    bt_pi[nb_jk].temp = temp_jk;
+    bt[nb_jk].i = j;
+    bt[nb_jk].j = k;
+    bt[nb_jk].temp = temp_jk;
     nb_t++;
-    memory_pi(nb_t);
-    initial_pi(nb_t);
+    memory_pi(bt, btlimit, nb_t);
+    initial_pi(bt, nb_t);
 
     if (!otfly) {
       if (n_ji < ktmp) {
@@ -1559,18 +1568,18 @@ double PairBOP::PiBo(int itmp, int jtmp)
     agpdpr2 = 0.5*(1.0-cosSq)*(1.0-cosSq)*betaCapSq1*dbetaCapSq1 / r_jk;
     app1 = cosAng_ijk*(betaP_jk*betaP_jk-pi_p[jtype]*betaS_jk*betaS_jk);
     app2 = (cosSq-1.0)*cosAng_ijk*betaCapSq1*betaCapSq1;
-    bt_pi[nb_ij].dAA[0] -= app1*dcA_ijk[0][0];
-    bt_pi[nb_ij].dAA[1] -= app1*dcA_ijk[1][0];
-    bt_pi[nb_ij].dAA[2] -= app1*dcA_ijk[2][0];
-    bt_pi[nb_ij].dBB[0] -= app2*dcA_ijk[0][0];
-    bt_pi[nb_ij].dBB[1] -= app2*dcA_ijk[1][0];
-    bt_pi[nb_ij].dBB[2] -= app2*dcA_ijk[2][0];
-    bt_pi[nb_jk].dAA[0] += agpdpr1*dis_jk[0] + app1*dcA_ijk[0][1];
-    bt_pi[nb_jk].dAA[1] += agpdpr1*dis_jk[1] + app1*dcA_ijk[1][1];
-    bt_pi[nb_jk].dAA[2] += agpdpr1*dis_jk[2] + app1*dcA_ijk[2][1];
-    bt_pi[nb_jk].dBB[0] += agpdpr2*dis_jk[0] + app2*dcA_ijk[0][1];
-    bt_pi[nb_jk].dBB[1] += agpdpr2*dis_jk[1] + app2*dcA_ijk[1][1];
-    bt_pi[nb_jk].dBB[2] += agpdpr2*dis_jk[2] + app2*dcA_ijk[2][1];
+    bt[nb_ij].dAA[0] -= app1*dcA_ijk[0][0];
+    bt[nb_ij].dAA[1] -= app1*dcA_ijk[1][0];
+    bt[nb_ij].dAA[2] -= app1*dcA_ijk[2][0];
+    bt[nb_ij].dBB[0] -= app2*dcA_ijk[0][0];
+    bt[nb_ij].dBB[1] -= app2*dcA_ijk[1][0];
+    bt[nb_ij].dBB[2] -= app2*dcA_ijk[2][0];
+    bt[nb_jk].dAA[0] += agpdpr1*dis_jk[0] + app1*dcA_ijk[0][1];
+    bt[nb_jk].dAA[1] += agpdpr1*dis_jk[1] + app1*dcA_ijk[1][1];
+    bt[nb_jk].dAA[2] += agpdpr1*dis_jk[2] + app1*dcA_ijk[2][1];
+    bt[nb_jk].dBB[0] += agpdpr2*dis_jk[0] + app2*dcA_ijk[0][1];
+    bt[nb_jk].dBB[1] += agpdpr2*dis_jk[1] + app2*dcA_ijk[1][1];
+    bt[nb_jk].dBB[2] += agpdpr2*dis_jk[2] + app2*dcA_ijk[2][1];
 
     // j is a neighbor of i and k and k' are different neighbors of j not equal to i
 
@@ -1589,12 +1598,12 @@ double PairBOP::PiBo(int itmp, int jtmp)
       dBetaP_jkp = pl_jkp.dBetaP;
 
       nb_jkp = nb_t;
-      bt_pi[nb_jkp].i = j;
-      bt_pi[nb_jkp].j = kp;
-      bt_pi[nb_jkp].temp = temp_jkp;
+      bt[nb_jkp].i = j;
+      bt[nb_jkp].j = kp;
+      bt[nb_jkp].temp = temp_jkp;
       nb_t++;
-      memory_pi(nb_t);
-      initial_pi(nb_t);
+      memory_pi(bt, btlimit, nb_t);
+      initial_pi(bt, nb_t);
 
       if (!otfly) {
         n_kjkp = ltmp*(2*nlistj-ltmp-1)/2 + (ktmp-ltmp)-1;
@@ -1675,20 +1684,20 @@ double PairBOP::PiBo(int itmp, int jtmp)
       app1 = betaCapSum*angFactor1;
       app2 = betaCapSum*angFactor2;
       app3 = betaCapSum*angFactor3;
-      bt_pi[nb_ij].dBB[0] -= app3*dcA_ijkp[0][0] + app2*dcA_ijk[0][0];
-      bt_pi[nb_ij].dBB[1] -= app3*dcA_ijkp[1][0] + app2*dcA_ijk[1][0];
-      bt_pi[nb_ij].dBB[2] -= app3*dcA_ijkp[2][0] + app2*dcA_ijk[2][0];
-      bt_pi[nb_jk].dBB[0] += agpdpr1*dis_jk[0] + app1*dcA_kjkp[0][0] +
+      bt[nb_ij].dBB[0] -= app3*dcA_ijkp[0][0] + app2*dcA_ijk[0][0];
+      bt[nb_ij].dBB[1] -= app3*dcA_ijkp[1][0] + app2*dcA_ijk[1][0];
+      bt[nb_ij].dBB[2] -= app3*dcA_ijkp[2][0] + app2*dcA_ijk[2][0];
+      bt[nb_jk].dBB[0] += agpdpr1*dis_jk[0] + app1*dcA_kjkp[0][0] +
         app2*dcA_ijk[0][1];
-      bt_pi[nb_jk].dBB[1] += agpdpr1*dis_jk[1] + app1*dcA_kjkp[1][0] +
+      bt[nb_jk].dBB[1] += agpdpr1*dis_jk[1] + app1*dcA_kjkp[1][0] +
         app2*dcA_ijk[1][1];
-      bt_pi[nb_jk].dBB[2] += agpdpr1*dis_jk[2] + app1*dcA_kjkp[2][0] +
+      bt[nb_jk].dBB[2] += agpdpr1*dis_jk[2] + app1*dcA_kjkp[2][0] +
         app2*dcA_ijk[2][1];
-      bt_pi[nb_jkp].dBB[0] += agpdpr2*dis_jkp[0] + app1*dcA_kjkp[0][1] +
+      bt[nb_jkp].dBB[0] += agpdpr2*dis_jkp[0] + app1*dcA_kjkp[0][1] +
         app3*dcA_ijkp[0][1];
-      bt_pi[nb_jkp].dBB[1] += agpdpr2*dis_jkp[1] + app1*dcA_kjkp[1][1] +
+      bt[nb_jkp].dBB[1] += agpdpr2*dis_jkp[1] + app1*dcA_kjkp[1][1] +
         app3*dcA_ijkp[1][1];
-      bt_pi[nb_jkp].dBB[2] += agpdpr2*dis_jkp[2] + app1*dcA_kjkp[2][1] +
+      bt[nb_jkp].dBB[2] += agpdpr2*dis_jkp[2] + app1*dcA_kjkp[2][1] +
         app3*dcA_ijkp[2][1];
     }
 
@@ -1709,12 +1718,12 @@ double PairBOP::PiBo(int itmp, int jtmp)
       dBetaP_ikp = pl_ikp.dBetaP;
 
       nb_ikp = nb_t;
-      bt_pi[nb_ikp].i = i;
-      bt_pi[nb_ikp].j = kp;
-      bt_pi[nb_ikp].temp = temp_ikp;
+      bt[nb_ikp].i = i;
+      bt[nb_ikp].j = kp;
+      bt[nb_ikp].temp = temp_ikp;
       nb_t++;
-      memory_pi(nb_t);
-      initial_pi(nb_t);
+      memory_pi(bt, btlimit, nb_t);
+      initial_pi(bt, nb_t);
 
       if (!otfly) {
         if (jtmp < ltmp) {
@@ -1781,24 +1790,23 @@ double PairBOP::PiBo(int itmp, int jtmp)
       agpdpr3 = 4.0*betaCapSum*angFactor/(r_ikp*r_jk);
       app1 = betaCapSum*angFactor1;
       app2 = betaCapSum*angFactor2;
-      bt_pi[nb_ij].dBB[0] += app2*dcA_jikp[0][0] - app1*dcA_ijk[0][0];
-      bt_pi[nb_ij].dBB[1] += app2*dcA_jikp[1][0] - app1*dcA_ijk[1][0];
-      bt_pi[nb_ij].dBB[2] += app2*dcA_jikp[2][0] - app1*dcA_ijk[2][0];
-      bt_pi[nb_ikp].dBB[0]+= agpdpr2*dis_ikp[0] + agpdpr3*dis_jk[0] +
+      bt[nb_ij].dBB[0] += app2*dcA_jikp[0][0] - app1*dcA_ijk[0][0];
+      bt[nb_ij].dBB[1] += app2*dcA_jikp[1][0] - app1*dcA_ijk[1][0];
+      bt[nb_ij].dBB[2] += app2*dcA_jikp[2][0] - app1*dcA_ijk[2][0];
+      bt[nb_ikp].dBB[0]+= agpdpr2*dis_ikp[0] + agpdpr3*dis_jk[0] +
         app2*dcA_jikp[0][1];
-      bt_pi[nb_ikp].dBB[1] += agpdpr2*dis_ikp[1] + agpdpr3*dis_jk[1] +
+      bt[nb_ikp].dBB[1] += agpdpr2*dis_ikp[1] + agpdpr3*dis_jk[1] +
         app2*dcA_jikp[1][1];
-      bt_pi[nb_ikp].dBB[2] += agpdpr2*dis_ikp[2] + agpdpr3*dis_jk[2] +
+      bt[nb_ikp].dBB[2] += agpdpr2*dis_ikp[2] + agpdpr3*dis_jk[2] +
         app2*dcA_jikp[2][1];
-      bt_pi[nb_jk].dBB[0] += agpdpr1*dis_jk[0] + agpdpr3*dis_ikp[0] +
+      bt[nb_jk].dBB[0] += agpdpr1*dis_jk[0] + agpdpr3*dis_ikp[0] +
         app1*dcA_ijk[0][1];
-      bt_pi[nb_jk].dBB[1] += agpdpr1*dis_jk[1] + agpdpr3*dis_ikp[1] +
+      bt[nb_jk].dBB[1] += agpdpr1*dis_jk[1] + agpdpr3*dis_ikp[1] +
         app1*dcA_ijk[1][1];
-      bt_pi[nb_jk].dBB[2] += agpdpr1*dis_jk[2] + agpdpr3*dis_ikp[2] +
+      bt[nb_jk].dBB[2] += agpdpr1*dis_jk[2] + agpdpr3*dis_ikp[2] +
         app1*dcA_ijk[2][1];
     }
   }
-  pp2 = 2.0*betaP_ij;
   CC = betaP_ij*betaP_ij + pi_delta[param_ij]*pi_delta[param_ij];
   BBrt = sqrt(BB+small6);
   AB1 = CC + pi_c[param_ij]*(AA+BBrt) + small7;
@@ -1819,31 +1827,18 @@ double PairBOP::PiBo(int itmp, int jtmp)
   dPiB3 = ((ABrtR1+ABrtR2)*pi_a[param_ij]-(pow(ABrtR1,3)+pow(ABrtR2,3))*
            pi_a[param_ij]*betaP_ij*betaP_ij)*dBetaP_ij / r_ij;
   for (loop = 0; loop < nb_t; loop++) {
-    temp_kk = bt_pi[loop].temp;
-    bt_pi[loop].dPiB[0] = dPiB1*bt_pi[loop].dAA[0] + dPiB2*bt_pi[loop].dBB[0];
-    bt_pi[loop].dPiB[1] = dPiB1*bt_pi[loop].dAA[1] + dPiB2*bt_pi[loop].dBB[1];
-    bt_pi[loop].dPiB[2] = dPiB1*bt_pi[loop].dAA[2] + dPiB2*bt_pi[loop].dBB[2];
+    temp_kk = bt[loop].temp;
+    bt[loop].dPiB[0] = dPiB1*bt[loop].dAA[0] + dPiB2*bt[loop].dBB[0];
+    bt[loop].dPiB[1] = dPiB1*bt[loop].dAA[1] + dPiB2*bt[loop].dBB[1];
+    bt[loop].dPiB[2] = dPiB1*bt[loop].dAA[2] + dPiB2*bt[loop].dBB[2];
     if (temp_kk == temp_ij) {
-      bt_pi[loop].dPiB[0] += dPiB3*dis_ij[0];
-      bt_pi[loop].dPiB[1] += dPiB3*dis_ij[1];
-      bt_pi[loop].dPiB[2] += dPiB3*dis_ij[2];
+      bt[loop].dPiB[0] += dPiB3*dis_ij[0];
+      bt[loop].dPiB[1] += dPiB3*dis_ij[1];
+      bt[loop].dPiB[2] += dPiB3*dis_ij[2];
     }
   }
 
-  for (loop = 0; loop < nb_t; loop++) {
-    bt_i = bt_pi[loop].i;
-    bt_j = bt_pi[loop].j;
-    xtmp[0] = x[bt_i][0]-x[bt_j][0];
-    xtmp[1] = x[bt_i][1]-x[bt_j][1];
-    xtmp[2] = x[bt_i][2]-x[bt_j][2];
-    for (int n = 0; n <3; n++) {
-      ftmp[n] = pp2*bt_pi[loop].dPiB[n];
-      f[bt_i][n] -= ftmp[n];
-      f[bt_j][n] += ftmp[n];
-    }
-    if (evflag) ev_tally_xyz(bt_i,bt_j,nlocal,newton_pair,0.0,0.0,
-                             -ftmp[0],-ftmp[1],-ftmp[2],xtmp[0],xtmp[1],xtmp[2]);
-  }
+  nb = nb_t;
   return(piB);
 }
 
@@ -2149,48 +2144,47 @@ void PairBOP::read_table(char *filename)
 
 double PairBOP::memory_usage()
 {
-  return(bytes);
+  double usage = bytes;
+  if (bt_sg) usage += (double)sglimit * sizeof(B_SG);
+  if (bt_pi) usage += (double)pilimit * sizeof(B_PI);
+  return usage;
 }
 
 /* ---------------------------------------------------------------------- */
 
-void PairBOP::memory_sg(int n)
+void PairBOP::memory_sg(B_SG *&bt, int &btlimit, int n)
 {
-  if (bt_sg) {
-    if (sglimit <= n) {
-      sglimit += 500;
-      memory->grow(bt_sg,sglimit,"BOP:bt_sg");
-      bytes += 500 * sizeof(B_SG);
+  if (bt) {
+    if (btlimit <= n) {
+      btlimit += 500;
+      memory->grow(bt,btlimit,"BOP:bt_sg");
     }
   } else {
-    sglimit = 2500;
-    memory->create(bt_sg,sglimit,"BOP:bt_sg");
-    bytes += sglimit * sizeof(B_SG);
+    btlimit = 2500;
+    memory->create(bt,btlimit,"BOP:bt_sg");
   }
 }
 
 /* ---------------------------------------------------------------------- */
 
-void PairBOP::memory_pi(int n)
+void PairBOP::memory_pi(B_PI *&bt, int &btlimit, int n)
 {
-  if (bt_pi) {
-    if (pilimit <= n) {
-      pilimit += 500;
-      memory->grow(bt_pi,pilimit,"BOP:bt_pi");
-      bytes += 500 * sizeof(B_PI);
+  if (bt) {
+    if (btlimit <= n) {
+      btlimit += 500;
+      memory->grow(bt,btlimit,"BOP:bt_pi");
     }
   } else {
-    pilimit = 2500;
-    memory->create(bt_pi,pilimit,"BOP:bt_pi");
-    bytes += 2500 * sizeof(B_PI);
+    btlimit = 2500;
+    memory->create(bt,btlimit,"BOP:bt_pi");
   }
 }
 
 /* ---------------------------------------------------------------------- */
 
-void PairBOP::initial_sg(int n)
+void PairBOP::initial_sg(B_SG *bt, int n)
 {
-  B_SG & at = bt_sg[n];
+  B_SG & at = bt[n];
   memset(&at, 0, sizeof(struct B_SG));
   at.i = -1;
   at.j = -1;
@@ -2199,9 +2193,9 @@ void PairBOP::initial_sg(int n)
 
 /* ---------------------------------------------------------------------- */
 
-void PairBOP::initial_pi(int n)
+void PairBOP::initial_pi(B_PI *bt, int n)
 {
-  B_PI & at = bt_pi[n];
+  B_PI & at = bt[n];
   memset(&at, 0, sizeof(struct B_PI));
   at.i = -1;
   at.j = -1;
@@ -42,7 +42,7 @@ class PairBOP : public Pair {
   double init_one(int, int) override;
   double memory_usage() override;
 
- private:
+ protected:
   struct PairParameters {
     double cutB, cutBsq, cutL, cutLsq;
     TabularFunction *betaS;
@@ -142,14 +142,14 @@ class PairBOP : public Pair {
 
   void gneigh();
   void angle(double, double *, double, double *, double &, double *, double *);
-  double SigmaBo(int, int);
-  double PiBo(int, int);
+  double SigmaBo(int, int, B_SG *&, int &, int &);
+  double PiBo(int, int, B_PI *&, int &, int &);
   void read_table(char *);
   void allocate();
-  void memory_sg(int);
-  void memory_pi(int);
-  void initial_sg(int);
-  void initial_pi(int);
+  void memory_sg(B_SG *&, int &, int);
+  void memory_pi(B_PI *&, int &, int);
+  void initial_sg(B_SG *, int);
+  void initial_pi(B_PI *, int);
 };
 
 }    // namespace LAMMPS_NS
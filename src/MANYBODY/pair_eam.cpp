@@ -39,6 +39,7 @@ PairEAM::PairEAM(LAMMPS *lmp) : Pair(lmp)
 {
   restartinfo = 0;
   manybody_flag = 1;
+  energy_local_enable = 1;
   embedstep = -1;
   unit_convert_flag = utils::get_supported_conversions(utils::ENERGY);
 
@@ -865,6 +866,66 @@ double PairEAM::single(int i, int j, int itype, int jtype,
   return phi;
 }
 
+/* ----------------------------------------------------------------------
+   embedding energy of atom I plus half of its pair energies
+   density is summed from scratch over a full neighbor list
+------------------------------------------------------------------------- */
+
+double PairEAM::energy_atom(NeighList *elist, int i)
+{
+  int j,jj,m,jtype;
+  double delx,dely,delz,rsq,r,p,phi,rhoi,fpi;
+  double *coeff;
+
+  double **x = atom->x;
+  int *type = atom->type;
+  const int itype = type[i];
+  const int * const jlist = elist->firstneigh[i];
+  const int jnum = elist->numneigh[i];
+
+  double energy = 0.0;
+  rhoi = 0.0;
+
+  for (jj = 0; jj < jnum; jj++) {
+    j = jlist[jj] & NEIGHMASK;
+
+    delx = x[i][0] - x[j][0];
+    dely = x[i][1] - x[j][1];
+    delz = x[i][2] - x[j][2];
+    rsq = delx*delx + dely*dely + delz*delz;
+
+    if (rsq < cutforcesq) {
+      jtype = type[j];
+      r = sqrt(rsq);
+      p = r*rdr + 1.0;
+      m = static_cast<int> (p);
+      m = MIN(m,nr-1);
+      p -= m;
+      p = MIN(p,1.0);
+      coeff = rhor_spline[type2rhor[jtype][itype]][m];
+      rhoi += ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
+      coeff = z2r_spline[type2z2r[itype][jtype]][m];
+      phi = (((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6])/r;
+      energy += 0.5*scale[itype][jtype]*phi;
+    }
+  }
+
+  p = rhoi*rdrho + 1.0;
+  m = static_cast<int> (p);
+  m = MAX(1,MIN(m,nrho-1));
+  p -= m;
+  p = MIN(p,1.0);
+  coeff = frho_spline[type2frho[itype]][m];
+  phi = ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
+  if (rhoi > rhomax) {
+    fpi = (coeff[0]*p + coeff[1])*p + coeff[2];
+    phi += fpi * (rhoi-rhomax);
+  }
+  energy += scale[itype][itype]*phi;
+
+  return energy;
+}
+
 /* ---------------------------------------------------------------------- */
 
 int PairEAM::pack_forward_comm(int n, int *list, double *buf, int /*pbc_flag*/, int * /*pbc*/)
@@ -52,6 +52,7 @@ class PairEAM : public Pair {
   void init_style() override;
   double init_one(int, int) override;
   double single(int, int, int, int, double, double, double, double &) override;
+  double energy_atom(class NeighList *, int) override;
   void *extract(const char *, int &) override;
   void *extract_peratom(const char *, int &) override;
 
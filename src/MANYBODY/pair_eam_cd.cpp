@@ -38,6 +38,7 @@ PairEAMCD::PairEAMCD(LAMMPS *lmp, int _cdeamVersion)
   : PairEAM(lmp), PairEAMAlloy(lmp), cdeamVersion(_cdeamVersion)
 {
   single_enable = 0;
+  energy_local_enable = 0;
   restartinfo = 0;
   unit_convert_flag = utils::get_supported_conversions(utils::ENERGY);
 
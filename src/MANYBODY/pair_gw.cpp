@@ -29,6 +29,7 @@
 #include "neigh_list.h"
 #include "neighbor.h"
 #include "potential_file_reader.h"
+#include "radial_table.h"
 
 #include <cmath>
 #include <cstring>
@@ -49,8 +50,10 @@ PairGW::PairGW(LAMMPS *lmp) : Pair(lmp)
   manybody_flag = 1;
   centroidstressflag = CENTROID_NOTAVAIL;
   unit_convert_flag = utils::get_supported_conversions(utils::ENERGY);
+  tabulate_enable = 1;
 
   params = nullptr;
+  tab = nullptr;
 }
 
 /* ----------------------------------------------------------------------
@@ -59,6 +62,7 @@ PairGW::PairGW(LAMMPS *lmp) : Pair(lmp)
 
 PairGW::~PairGW()
 {
+  delete tab;
   memory->destroy(params);
   memory->destroy(elem3param);
 
@@ -286,6 +290,12 @@ void PairGW::init_style()
   // need a full neighbor list
 
   neighbor->add_request(this, NeighConst::REQ_FULL);
+
+  // tabulate radial functions
+
+  delete tab;
+  tab = nullptr;
+  if (ntabulate) setup_table();
 }
 
 /* ----------------------------------------------------------------------
@@ -458,6 +468,63 @@ void PairGW::setup_params()
     if (params[m].cut > cutmax) cutmax = params[m].cut;
 }
 
+/* ----------------------------------------------------------------------
+   tabulate cutoff, attractive, repulsive and exponential zeta functions
+   for each parameter set. grid points are aligned with R+D and R-D where
+   the second derivative of the cutoff function is discontinuous
+------------------------------------------------------------------------- */
+
+void PairGW::setup_table()
+{
+  auto table = new RadialTable(lmp,NTAB,nparams);
+
+  table->set_function(TAB_FC,"fc",[this](int m, double r, double &f, double &df) {
+    f = gw_fc(r,&params[m]);
+    df = gw_fc_d(r,&params[m]);
+  });
+  table->set_function(TAB_FA,"fa",[this](int m, double r, double &f, double &df) {
+    f = gw_fa(r,&params[m]);
+    df = gw_fa_d(r,&params[m]);
+  });
+  table->set_function(TAB_FR,"fr",[this](int m, double r, double &f, double &df) {
+    Param *param = &params[m];
+    const double tmp_fc = gw_fc(r,param);
+    const double tmp_exp = param->biga * exp(-param->lam1 * r);
+    f = tmp_fc * tmp_exp;
+    df = tmp_exp * (gw_fc_d(r,param) - tmp_fc*param->lam1);
+  });
+  table->set_function(TAB_EXP,"exp",[this](int m, double r, double &f, double &df) {
+    const Param *param = &params[m];
+    double arg;
+    if (param->powermint == 3) arg = pow(param->lam3 * r,3.0);
+    else arg = param->lam3 * r;
+    if (arg > 69.0776) f = 1.e30;
+    else if (arg < -69.0776) f = 0.0;
+    else f = exp(arg);
+    if (param->powermint == 3) df = 3.0*pow(param->lam3,3.0) * pow(r,2.0)*f;
+    else df = param->lam3 * f;
+  });
+
+  for (int m = 0; m < nparams; m++) {
+    const double rc = params[m].bigr + params[m].bigd;
+    const double rcinner = params[m].bigr - params[m].bigd;
+    table->set_range(TAB_FC,m,rcinner,rc);
+    table->set_range(TAB_FA,m,0.0,rc,rcinner);
+    table->set_range(TAB_FR,m,0.0,rc,rcinner);
+
+    // exclude the range where the argument of the exponential is capped
+
+    double dmax = cutmax;
+    if (params[m].lam3 != 0.0) {
+      if (params[m].powermint == 3) dmax = MIN(dmax,cbrt(69.0776)/fabs(params[m].lam3));
+      else dmax = MIN(dmax,69.0776/fabs(params[m].lam3));
+    }
+    table->set_range(TAB_EXP,m,-dmax,dmax);
+  }
+  table->build(ntabulate);
+  tab = table;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void PairGW::repulsive(Param *param, double rsq, double &fforce,
@@ -466,6 +533,12 @@ void PairGW::repulsive(Param *param, double rsq, double &fforce,
   double r,tmp_fc,tmp_fc_d,tmp_exp;
 
   r = sqrt(rsq);
+  if (tab && tab->lookup(TAB_FR,param-params,r,tmp_exp,tmp_fc_d)) {
+    fforce = -tmp_fc_d / r;
+    if (eflag) eng = tmp_exp;
+    return;
+  }
+
   tmp_fc = gw_fc(r,param);
   tmp_fc_d = gw_fc_d(r,param);
   tmp_exp = exp(-param->lam1 * r);
@@ -478,13 +551,21 @@ void PairGW::repulsive(Param *param, double rsq, double &fforce,
 double PairGW::zeta(Param *param, double rsqij, double rsqik,
                          double *delrij, double *delrik)
 {
-  double rij,rik,costheta,arg,ex_delr;
+  double rij,rik,costheta,arg,ex_delr,fc;
 
   rij = sqrt(rsqij);
   rik = sqrt(rsqik);
   costheta = (delrij[0]*delrik[0] + delrij[1]*delrik[1] +
               delrij[2]*delrik[2]) / (rij*rik);
 
+  if (tab) {
+    const int m = param - params;
+    if (tab->value(TAB_EXP,m,rij-rik,ex_delr)) {
+      if (!tab->value(TAB_FC,m,rik,fc)) fc = gw_fc(rik,param);
+      return fc * gw_gijk(costheta,param) * ex_delr;
+    }
+  }
+
   if (param->powermint == 3) arg = pow(param->lam3 * (rij-rik),3.0);
   else arg = param->lam3 * (rij-rik);
 
@@ -504,8 +585,10 @@ void PairGW::force_zeta(Param *param_i, double rsq, double zeta_ij,
   double r,fa,fa_d,bij;
 
   r = sqrt(rsq);
-  fa = gw_fa(r,param_i);
-  fa_d = gw_fa_d(r,param_i);
+  if (!tab || !tab->lookup(TAB_FA,param_i-params,r,fa,fa_d)) {
+    fa = gw_fa(r,param_i);
+    fa_d = gw_fa_d(r,param_i);
+  }
   bij = gw_bij(zeta_ij,param_i);
   fforce = 0.5*bij*fa_d / r;
   prefactor = -0.5*fa * gw_bij_d(zeta_ij,param_i);
@@ -605,18 +688,24 @@ void PairGW::gw_zetaterm_d(double prefactor,
   double gijk,gijk_d,ex_delr,ex_delr_d,fc,dfc,cos_theta,tmp;
   double dcosdri[3],dcosdrj[3],dcosdrk[3];
 
-  fc = gw_fc(rik,param);
-  dfc = gw_fc_d(rik,param);
-  if (param->powermint == 3) tmp = pow(param->lam3 * (rij-rik),3.0);
-  else tmp = param->lam3 * (rij-rik);
+  const int m = param - params;
+  if (!tab || !tab->lookup(TAB_FC,m,rik,fc,dfc)) {
+    fc = gw_fc(rik,param);
+    dfc = gw_fc_d(rik,param);
+  }
+
+  if (!tab || !tab->lookup(TAB_EXP,m,rij-rik,ex_delr,ex_delr_d)) {
+    if (param->powermint == 3) tmp = pow(param->lam3 * (rij-rik),3.0);
+    else tmp = param->lam3 * (rij-rik);
 
-  if (tmp > 69.0776) ex_delr = 1.e30;
-  else if (tmp < -69.0776) ex_delr = 0.0;
-  else ex_delr = exp(tmp);
+    if (tmp > 69.0776) ex_delr = 1.e30;
+    else if (tmp < -69.0776) ex_delr = 0.0;
+    else ex_delr = exp(tmp);
 
-  if (param->powermint == 3)
-    ex_delr_d = 3.0*pow(param->lam3,3.0) * pow(rij-rik,2.0)*ex_delr;
-  else ex_delr_d = param->lam3 * ex_delr;
+    if (param->powermint == 3)
+      ex_delr_d = 3.0*pow(param->lam3,3.0) * pow(rij-rik,2.0)*ex_delr;
+    else ex_delr_d = param->lam3 * ex_delr;
+  }
 
   cos_theta = dot3(rij_hat,rik_hat);
   gijk = gw_gijk(cos_theta,param);
@@ -54,6 +54,9 @@ class PairGW : public Pair {
   Param *params;    // parameter set for an I-J-K interaction
   double cutmax;    // max cutoff for all elements
 
+  enum { TAB_FC, TAB_FA, TAB_FR, TAB_EXP, NTAB };
+  class RadialTable *tab;    // tabulated radial functions, see pair_modify tabulate
+
   int **pages;     // neighbor list pages
   int maxlocal;    // size of numneigh, firstneigh arrays
   int maxpage;     // # of pages currently allocated
@@ -69,6 +72,7 @@ class PairGW : public Pair {
   void allocate();
   virtual void read_file(char *);
   void setup_params();
+  void setup_table();
   virtual void repulsive(Param *, double, double &, int, double &);
   double zeta(Param *, double, double, double *, double *);
   virtual void force_zeta(Param *, double, double, double &, double &, int, double &);
@@ -27,6 +27,7 @@
 #include "neigh_list.h"
 #include "neighbor.h"
 #include "potential_file_reader.h"
+#include "radial_table.h"
 
 #include <cmath>
 #include <cstring>
@@ -47,8 +48,10 @@ PairSW::PairSW(LAMMPS *lmp) : Pair(lmp)
   unit_convert_flag = utils::get_supported_conversions(utils::ENERGY);
   skip_threebody_flag = false;
   params_mapped = 0;
+  tabulate_enable = 1;
 
   params = nullptr;
+  tab = nullptr;
 
   maxshort = 10;
   neighshort = nullptr;
@@ -62,6 +65,7 @@ PairSW::~PairSW()
 {
   if (copymode) return;
 
+  delete tab;
   memory->destroy(params);
   memory->destroy(elem3param);
 
@@ -326,6 +330,12 @@ void PairSW::init_style()
     neighbor->add_request(this);
   else
     neighbor->add_request(this, NeighConst::REQ_FULL);
+
+  // tabulate radial functions
+
+  delete tab;
+  tab = nullptr;
+  if (ntabulate) setup_table();
 }
 
 /* ----------------------------------------------------------------------
@@ -535,6 +545,41 @@ void PairSW::setup_params()
   }
 }
 
+/* ----------------------------------------------------------------------
+   tabulate two-body energy and three-body radial factor for each parameter
+   set. the two-body term is singular at r = 0, so its table starts at the
+   pair_modify tabinner distance and shorter distances are not tabulated
+------------------------------------------------------------------------- */
+
+void PairSW::setup_table()
+{
+  auto table = new RadialTable(lmp,NTAB,nparams);
+
+  table->set_function(TAB_PHI2,"phi2",[this](int m, double r, double &f, double &df) {
+    f = df = 0.0;
+    if (r < params[m].cut) {
+      twobody(&params[m],r*r,df,1,f);
+      df *= -r;
+    }
+  });
+  table->set_function(TAB_EXP,"exp",[this](int m, double r, double &f, double &df) {
+    f = df = 0.0;
+    if (r < params[m].cut) {
+      const double rainv = 1.0/(r - params[m].cut);
+      const double gsrainv = params[m].sigma_gamma * rainv;
+      f = exp(gsrainv);
+      df = -gsrainv*rainv*f;
+    }
+  });
+
+  for (int m = 0; m < nparams; m++) {
+    table->set_range(TAB_PHI2,m,tabinner,params[m].cut);
+    table->set_range(TAB_EXP,m,0.0,params[m].cut);
+  }
+  table->build(ntabulate);
+  tab = table;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void PairSW::twobody(Param *param, double rsq, double &fforce,
@@ -543,6 +588,11 @@ void PairSW::twobody(Param *param, double rsq, double &fforce,
   double r,rinvsq,rp,rq,rainv,rainvsq,expsrainv;
 
   r = sqrt(rsq);
+  if (tab && tab->lookup(TAB_PHI2,param-params,r,eng,fforce)) {
+    fforce /= -r;
+    return;
+  }
+
   rinvsq = 1.0/rsq;
   rp = pow(r,-param->powerp);
   rq = pow(r,-param->powerq);
@@ -565,20 +615,30 @@ void PairSW::threebody(Param *paramij, Param *paramik, Param *paramijk,
   double r2,rinvsq2,rainv2,gsrainv2,gsrainvsq2,expgsrainv2;
   double rinv12,cs,delcs,delcssq,facexp,facrad,frad1,frad2;
   double facang,facang12,csfacang,csfac1,csfac2;
+  double dexp1,dexp2;
+  int tabflag = 0;
 
   r1 = sqrt(rsq1);
   rinvsq1 = 1.0/rsq1;
-  rainv1 = 1.0/(r1 - paramij->cut);
-  gsrainv1 = paramij->sigma_gamma * rainv1;
-  gsrainvsq1 = gsrainv1*rainv1/r1;
-  expgsrainv1 = exp(gsrainv1);
-
   r2 = sqrt(rsq2);
   rinvsq2 = 1.0/rsq2;
-  rainv2 = 1.0/(r2 - paramik->cut);
-  gsrainv2 = paramik->sigma_gamma * rainv2;
-  gsrainvsq2 = gsrainv2*rainv2/r2;
-  expgsrainv2 = exp(gsrainv2);
+
+  // radial factors and their derivatives from the tables, if possible
+
+  if (tab && tab->lookup(TAB_EXP,paramij-params,r1,expgsrainv1,dexp1) &&
+      tab->lookup(TAB_EXP,paramik-params,r2,expgsrainv2,dexp2)) {
+    tabflag = 1;
+  } else {
+    rainv1 = 1.0/(r1 - paramij->cut);
+    gsrainv1 = paramij->sigma_gamma * rainv1;
+    gsrainvsq1 = gsrainv1*rainv1/r1;
+    expgsrainv1 = exp(gsrainv1);
+
+    rainv2 = 1.0/(r2 - paramik->cut);
+    gsrainv2 = paramik->sigma_gamma * rainv2;
+    gsrainvsq2 = gsrainv2*rainv2/r2;
+    expgsrainv2 = exp(gsrainv2);
+  }
 
   rinv12 = 1.0/(r1*r2);
   cs = (delr1[0]*delr2[0] + delr1[1]*delr2[1] + delr1[2]*delr2[2]) * rinv12;
@@ -591,8 +651,13 @@ void PairSW::threebody(Param *paramij, Param *paramik, Param *paramijk,
   //          facexp*delcssq;
 
   facrad = paramijk->lambda_epsilon * facexp*delcssq;
-  frad1 = facrad*gsrainvsq1;
-  frad2 = facrad*gsrainvsq2;
+  if (tabflag) {
+    frad1 = -paramijk->lambda_epsilon * delcssq*expgsrainv2*dexp1/r1;
+    frad2 = -paramijk->lambda_epsilon * delcssq*expgsrainv1*dexp2/r2;
+  } else {
+    frad1 = facrad*gsrainvsq1;
+    frad2 = facrad*gsrainvsq2;
+  }
   facang = paramijk->lambda_epsilon2 * facexp*delcs;
   facang12 = rinv12*facang;
   csfacang = cs*facang;
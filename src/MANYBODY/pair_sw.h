@@ -56,10 +56,14 @@ class PairSW : public Pair {
   int skip_threebody_flag;    // whether to run threebody loop
   int params_mapped;          // whether parameters have been read and mapped to elements
 
+  enum { TAB_PHI2, TAB_EXP, NTAB };
+  class RadialTable *tab;    // tabulated radial functions, see pair_modify tabulate
+
   void settings(int, char **) override;
   virtual void allocate();
   virtual void read_file(char *);
   virtual void setup_params();
+  void setup_table();
   void twobody(Param *, double, double &, int, double &);
   virtual void threebody(Param *, Param *, Param *, double, double, double *, double *, double *,
                          double *, int, double &);
@@ -30,6 +30,7 @@
 #include "neigh_list.h"
 #include "neighbor.h"
 #include "potential_file_reader.h"
+#include "radial_table.h"
 #include "suffix.h"
 
 #include <cmath>
@@ -50,10 +51,13 @@ PairTersoff::PairTersoff(LAMMPS *lmp) : Pair(lmp)
   restartinfo = 0;
   one_coeff = 1;
   manybody_flag = 1;
+  energy_local_enable = 1;
   centroidstressflag = CENTROID_NOTAVAIL;
   unit_convert_flag = utils::get_supported_conversions(utils::ENERGY);
+  tabulate_enable = 1;
 
   params = nullptr;
+  tab = nullptr;
 
   maxshort = 10;
   neighshort = nullptr;
@@ -67,6 +71,7 @@ PairTersoff::~PairTersoff()
 {
   if (copymode) return;
 
+  delete tab;
   memory->destroy(params);
   memory->destroy(elem3param);
 
@@ -327,6 +332,107 @@ void PairTersoff::eval()
   if (vflag_fdotr) virial_fdotr_compute();
 }
 
+/* ----------------------------------------------------------------------
+   energy tallied to atom I by eval(): the two-body terms selected by
+     the same tag ordering plus all three-body terms with I as center
+------------------------------------------------------------------------- */
+
+double PairTersoff::energy_atom(NeighList *elist, int i)
+{
+  int j,k,jj,kk,jnum,itype,jtype,ktype,iparam_ij,iparam_ijk;
+  tagint itag,jtag;
+  double delx,dely,delz,rsq,rsq1,rsq2,fpair,fforce,prefactor,zeta_ij,evdwl;
+  double delr1[3],delr2[3],r1_hat[3],r2_hat[3];
+
+  double **x = atom->x;
+  tagint *tag = atom->tag;
+  int *type = atom->type;
+  const double cutshortsq = cutmax*cutmax;
+
+  itag = tag[i];
+  itype = map[type[i]];
+  int *jlist = elist->firstneigh[i];
+  jnum = elist->numneigh[i];
+  int numshort = 0;
+  double energy = 0.0;
+  evdwl = 0.0;
+
+  for (jj = 0; jj < jnum; jj++) {
+    j = jlist[jj];
+    j &= NEIGHMASK;
+
+    delx = x[i][0] - x[j][0];
+    dely = x[i][1] - x[j][1];
+    delz = x[i][2] - x[j][2];
+    rsq = delx*delx + dely*dely + delz*delz;
+    if (shift_flag) rsq += shift*shift + 2*sqrt(rsq)*shift;
+
+    if (rsq < cutshortsq) {
+      neighshort[numshort++] = j;
+      if (numshort >= maxshort) {
+        maxshort += maxshort/2;
+        memory->grow(neighshort,maxshort,"pair:neighshort");
+      }
+    }
+
+    jtag = tag[j];
+    if (itag > jtag) {
+      if ((itag+jtag) % 2 == 0) continue;
+    } else if (itag < jtag) {
+      if ((itag+jtag) % 2 == 1) continue;
+    } else {
+      if (x[j][2] < x[i][2]) continue;
+      if (x[j][2] == x[i][2] && x[j][1] < x[i][1]) continue;
+      if (x[j][2] == x[i][2] && x[j][1] == x[i][1] && x[j][0] < x[i][0]) continue;
+    }
+
+    jtype = map[type[j]];
+    iparam_ij = elem3param[itype][jtype][jtype];
+    if (rsq >= params[iparam_ij].cutsq) continue;
+
+    repulsive(&params[iparam_ij],rsq,fpair,1,evdwl);
+    energy += evdwl;
+  }
+
+  for (jj = 0; jj < numshort; jj++) {
+    j = neighshort[jj];
+    jtype = map[type[j]];
+    iparam_ij = elem3param[itype][jtype][jtype];
+
+    delr1[0] = x[j][0] - x[i][0];
+    delr1[1] = x[j][1] - x[i][1];
+    delr1[2] = x[j][2] - x[i][2];
+    rsq1 = delr1[0]*delr1[0] + delr1[1]*delr1[1] + delr1[2]*delr1[2];
+    if (shift_flag) rsq1 += shift*shift + 2*sqrt(rsq1)*shift;
+    if (rsq1 >= params[iparam_ij].cutsq) continue;
+
+    scale3(1.0/sqrt(dot3(delr1, delr1)), delr1, r1_hat);
+
+    zeta_ij = 0.0;
+    for (kk = 0; kk < numshort; kk++) {
+      if (jj == kk) continue;
+      k = neighshort[kk];
+      ktype = map[type[k]];
+      iparam_ijk = elem3param[itype][jtype][ktype];
+
+      delr2[0] = x[k][0] - x[i][0];
+      delr2[1] = x[k][1] - x[i][1];
+      delr2[2] = x[k][2] - x[i][2];
+      rsq2 = delr2[0]*delr2[0] + delr2[1]*delr2[1] + delr2[2]*delr2[2];
+      if (shift_flag) rsq2 += shift*shift + 2*sqrt(rsq2)*shift;
+      if (rsq2 >= params[iparam_ijk].cutsq) continue;
+
+      scale3(1.0/sqrt(dot3(delr2, delr2)), delr2, r2_hat);
+      zeta_ij += zeta(&params[iparam_ijk],rsq1,rsq2,r1_hat,r2_hat);
+    }
+
+    force_zeta(&params[iparam_ij],rsq1,zeta_ij,fforce,prefactor,1,evdwl);
+    energy += evdwl;
+  }
+
+  return energy;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void PairTersoff::allocate()
@@ -397,6 +503,12 @@ void PairTersoff::init_style()
   // need a full neighbor list
 
   neighbor->add_request(this,NeighConst::REQ_FULL);
+
+  // tabulate radial functions
+
+  delete tab;
+  tab = nullptr;
+  if (ntabulate) setup_table();
 }
 
 /* ----------------------------------------------------------------------
@@ -577,6 +689,63 @@ void PairTersoff::setup_params()
     if (params[m].cut > cutmax) cutmax = params[m].cut;
 }
 
+/* ----------------------------------------------------------------------
+   tabulate cutoff, attractive, repulsive and exponential zeta functions
+   for each parameter set. grid points are aligned with R+D and R-D where
+   the second derivative of the cutoff function is discontinuous
+------------------------------------------------------------------------- */
+
+void PairTersoff::setup_table()
+{
+  auto table = new RadialTable(lmp,NTAB,nparams);
+
+  table->set_function(TAB_FC,"fc",[this](int m, double r, double &f, double &df) {
+    f = ters_fc(r,&params[m]);
+    df = ters_fc_d(r,&params[m]);
+  });
+  table->set_function(TAB_FA,"fa",[this](int m, double r, double &f, double &df) {
+    f = ters_fa(r,&params[m]);
+    df = ters_fa_d(r,&params[m]);
+  });
+  table->set_function(TAB_FR,"fr",[this](int m, double r, double &f, double &df) {
+    Param *param = &params[m];
+    const double tmp_fc = ters_fc(r,param);
+    const double tmp_exp = param->biga * exp(-param->lam1 * r);
+    f = tmp_fc * tmp_exp;
+    df = tmp_exp * (ters_fc_d(r,param) - tmp_fc*param->lam1);
+  });
+  table->set_function(TAB_EXP,"exp",[this](int m, double r, double &f, double &df) {
+    const Param *param = &params[m];
+    double arg;
+    if (param->powermint == 3) arg = cube(param->lam3 * r);
+    else arg = param->lam3 * r;
+    if (arg > 69.0776) f = 1.e30;
+    else if (arg < -69.0776) f = 0.0;
+    else f = exp(arg);
+    if (param->powermint == 3) df = 3.0*cube(param->lam3) * square(r)*f;
+    else df = param->lam3 * f;
+  });
+
+  for (int m = 0; m < nparams; m++) {
+    const double rc = params[m].bigr + params[m].bigd;
+    const double rcinner = params[m].bigr - params[m].bigd;
+    table->set_range(TAB_FC,m,rcinner,rc);
+    table->set_range(TAB_FA,m,0.0,rc,rcinner);
+    table->set_range(TAB_FR,m,0.0,rc,rcinner);
+
+    // exclude the range where the argument of the exponential is capped
+
+    double dmax = cutmax;
+    if (params[m].lam3 != 0.0) {
+      if (params[m].powermint == 3) dmax = MIN(dmax,cbrt(69.0776)/fabs(params[m].lam3));
+      else dmax = MIN(dmax,69.0776/fabs(params[m].lam3));
+    }
+    table->set_range(TAB_EXP,m,-dmax,dmax);
+  }
+  table->build(ntabulate);
+  tab = table;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void PairTersoff::repulsive(Param *param, double rsq, double &fforce,
@@ -585,6 +754,12 @@ void PairTersoff::repulsive(Param *param, double rsq, double &fforce,
   double r,tmp_fc,tmp_fc_d,tmp_exp;
 
   r = sqrt(rsq);
+  if (tab && tab->lookup(TAB_FR,param-params,r,tmp_exp,tmp_fc_d)) {
+    fforce = -tmp_fc_d / r;
+    if (eflag) eng = tmp_exp;
+    return;
+  }
+
   tmp_fc = ters_fc(r,param);
   tmp_fc_d = ters_fc_d(r,param);
   tmp_exp = exp(-param->lam1 * r);
@@ -597,12 +772,20 @@ void PairTersoff::repulsive(Param *param, double rsq, double &fforce,
 double PairTersoff::zeta(Param *param, double rsqij, double rsqik,
                          double *rij_hat, double *rik_hat)
 {
-  double rij,rik,costheta,arg,ex_delr;
+  double rij,rik,costheta,arg,ex_delr,fc;
 
   rij = sqrt(rsqij);
   rik = sqrt(rsqik);
   costheta = dot3(rij_hat,rik_hat);
 
+  if (tab) {
+    const int m = param - params;
+    if (tab->value(TAB_EXP,m,rij-rik,ex_delr)) {
+      if (!tab->value(TAB_FC,m,rik,fc)) fc = ters_fc(rik,param);
+      return fc * ters_gijk(costheta,param) * ex_delr;
+    }
+  }
+
   if (param->powermint == 3) arg = cube(param->lam3 * (rij-rik));
   else arg = param->lam3 * (rij-rik);
 
@@ -622,8 +805,10 @@ void PairTersoff::force_zeta(Param *param, double rsq, double zeta_ij,
   double r,fa,fa_d,bij;
 
   r = sqrt(rsq);
-  fa = ters_fa(r,param);
-  fa_d = ters_fa_d(r,param);
+  if (!tab || !tab->lookup(TAB_FA,param-params,r,fa,fa_d)) {
+    fa = ters_fa(r,param);
+    fa_d = ters_fa_d(r,param);
+  }
   bij = ters_bij(zeta_ij,param);
   fforce = 0.5*bij*fa_d;
   prefactor = -0.5*fa * ters_bij_d(zeta_ij,param);
@@ -745,18 +930,24 @@ void PairTersoff::ters_zetaterm_d(double prefactor,
   double gijk,gijk_d,ex_delr,ex_delr_d,fc,dfc,cos_theta,tmp;
   double dcosdri[3],dcosdrj[3],dcosdrk[3];
 
-  fc = ters_fc(rik,param);
-  dfc = ters_fc_d(rik,param);
-  if (param->powermint == 3) tmp = cube(param->lam3 * (rij-rik));
-  else tmp = param->lam3 * (rij-rik);
+  const int m = param - params;
+  if (!tab || !tab->lookup(TAB_FC,m,rik,fc,dfc)) {
+    fc = ters_fc(rik,param);
+    dfc = ters_fc_d(rik,param);
+  }
 
-  if (tmp > 69.0776) ex_delr = 1.e30;
-  else if (tmp < -69.0776) ex_delr = 0.0;
-  else ex_delr = exp(tmp);
+  if (!tab || !tab->lookup(TAB_EXP,m,rij-rik,ex_delr,ex_delr_d)) {
+    if (param->powermint == 3) tmp = cube(param->lam3 * (rij-rik));
+    else tmp = param->lam3 * (rij-rik);
 
-  if (param->powermint == 3)
-    ex_delr_d = 3.0*cube(param->lam3) * square(rij-rik)*ex_delr;
-  else ex_delr_d = param->lam3 * ex_delr;
+    if (tmp > 69.0776) ex_delr = 1.e30;
+    else if (tmp < -69.0776) ex_delr = 0.0;
+    else ex_delr = exp(tmp);
+
+    if (param->powermint == 3)
+      ex_delr_d = 3.0*cube(param->lam3) * square(rij-rik)*ex_delr;
+    else ex_delr_d = param->lam3 * ex_delr;
+  }
 
   cos_theta = dot3(rij_hat,rik_hat);
   gijk = ters_gijk(cos_theta,param);
@@ -29,6 +29,7 @@ class PairTersoff : public Pair {
   PairTersoff(class LAMMPS *);
   ~PairTersoff() override;
   void compute(int, int) override;
+  double energy_atom(class NeighList *, int) override;
   void settings(int, char **) override;
   void coeff(int, char **) override;
   void init_style() override;
@@ -64,9 +65,13 @@ class PairTersoff : public Pair {
   int shift_flag;    // flag to turn on/off shift
   double shift;      // negative change in equilibrium bond length
 
+  enum { TAB_FC, TAB_FA, TAB_FR, TAB_EXP, NTAB };
+  class RadialTable *tab;    // tabulated radial functions, see pair_modify tabulate
+
   virtual void allocate();
   virtual void read_file(char *);
   virtual void setup_params();
+  void setup_table();
   virtual void repulsive(Param *, double, double &, int, double &);
   virtual double zeta(Param *, double, double, double *, double *);
   virtual void force_zeta(Param *, double, double, double &, double &, int, double &);
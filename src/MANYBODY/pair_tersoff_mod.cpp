@@ -26,6 +26,7 @@
 #include "math_special.h"
 #include "memory.h"
 #include "potential_file_reader.h"
+#include "radial_table.h"
 
 #include <cmath>
 #include <cstring>
@@ -212,12 +213,20 @@ void PairTersoffMOD::setup_params()
 double PairTersoffMOD::zeta(Param *param, double rsqij, double rsqik,
                          double *rij_hat, double *rik_hat)
 {
-  double rij,rik,costheta,arg,ex_delr;
+  double rij,rik,costheta,arg,ex_delr,fc;
 
   rij = sqrt(rsqij);
   rik = sqrt(rsqik);
   costheta = dot3(rij_hat,rik_hat);
 
+  if (tab) {
+    const int m = param - params;
+    if (tab->value(TAB_EXP,m,rij-rik,ex_delr)) {
+      if (!tab->value(TAB_FC,m,rik,fc)) fc = ters_fc(rik,param);
+      return fc * ters_gijk_mod(costheta,param) * ex_delr;
+    }
+  }
+
   if (param->powermint == 3) arg = cube(param->lam3 * (rij-rik));
   else arg = param->lam3 * (rij-rik);
 
@@ -289,18 +298,24 @@ void PairTersoffMOD::ters_zetaterm_d(double prefactor,
   double gijk,gijk_d,ex_delr,ex_delr_d,fc,dfc,cos_theta,tmp;
   double dcosdri[3],dcosdrj[3],dcosdrk[3];
 
-  fc = ters_fc(rik,param);
-  dfc = ters_fc_d(rik,param);
-  if (param->powermint == 3) tmp = cube(param->lam3 * (rij-rik));
-  else tmp = param->lam3 * (rij-rik);
+  const int m = param - params;
+  if (!tab || !tab->lookup(TAB_FC,m,rik,fc,dfc)) {
+    fc = ters_fc(rik,param);
+    dfc = ters_fc_d(rik,param);
+  }
+
+  if (!tab || !tab->lookup(TAB_EXP,m,rij-rik,ex_delr,ex_delr_d)) {
+    if (param->powermint == 3) tmp = cube(param->lam3 * (rij-rik));
+    else tmp = param->lam3 * (rij-rik);
 
-  if (tmp > 69.0776) ex_delr = 1.e30;
-  else if (tmp < -69.0776) ex_delr = 0.0;
-  else ex_delr = exp(tmp);
+    if (tmp > 69.0776) ex_delr = 1.e30;
+    else if (tmp < -69.0776) ex_delr = 0.0;
+    else ex_delr = exp(tmp);
 
-  if (param->powermint == 3)
-    ex_delr_d = 3.0*cube(param->lam3) * square(rij-rik)*ex_delr;
-  else ex_delr_d = param->lam3 * ex_delr;
+    if (param->powermint == 3)
+      ex_delr_d = 3.0*cube(param->lam3) * square(rij-rik)*ex_delr;
+    else ex_delr_d = param->lam3 * ex_delr;
+  }
 
   cos_theta = dot3(rij_hat,rik_hat);
   gijk = ters_gijk_mod(cos_theta,param);
@@ -27,6 +27,7 @@
 #include "neighbor.h"
 #include "neigh_list.h"
 #include "potential_file_reader.h"
+#include "radial_table.h"
 
 #include <cmath>
 #include <cstring>
@@ -45,8 +46,10 @@ PairVashishta::PairVashishta(LAMMPS *lmp) : Pair(lmp)
   manybody_flag = 1;
   centroidstressflag = CENTROID_NOTAVAIL;
   unit_convert_flag = utils::get_supported_conversions(utils::ENERGY);
+  tabulate_enable = 1;
 
   params = nullptr;
+  tab = nullptr;
 
   r0max = 0.0;
   maxshort = 10;
@@ -61,6 +64,7 @@ PairVashishta::~PairVashishta()
 {
   if (copymode) return;
 
+  delete tab;
   memory->destroy(params);
   memory->destroy(elem3param);
 
@@ -270,6 +274,12 @@ void PairVashishta::init_style()
   // need a full neighbor list
 
   neighbor->add_request(this, NeighConst::REQ_FULL);
+
+  // tabulate radial functions
+
+  delete tab;
+  tab = nullptr;
+  if (ntabulate) setup_table();
 }
 
 /* ----------------------------------------------------------------------
@@ -476,6 +486,38 @@ void PairVashishta::setup_params()
   if (r0max > cutmax) cutmax = r0max;
 }
 
+/* ----------------------------------------------------------------------
+   tabulate two-body energy and three-body radial factor for each parameter
+   set. the two-body term is singular at r = 0, so its table starts at the
+   pair_modify tabinner distance and shorter distances are not tabulated
+------------------------------------------------------------------------- */
+
+void PairVashishta::setup_table()
+{
+  auto table = new RadialTable(lmp,NTAB,nparams);
+
+  table->set_function(TAB_PHI2,"phi2",[this](int m, double r, double &f, double &df) {
+    twobody(&params[m],r*r,df,1,f);
+    df *= -r;
+  });
+  table->set_function(TAB_EXP,"exp",[this](int m, double r, double &f, double &df) {
+    f = df = 0.0;
+    if (r < params[m].r0) {
+      const double rainv = 1.0/(r - params[m].r0);
+      const double gsrainv = params[m].gamma * rainv;
+      f = exp(gsrainv);
+      df = -gsrainv*rainv*f;
+    }
+  });
+
+  for (int m = 0; m < nparams; m++) {
+    table->set_range(TAB_PHI2,m,tabinner,params[m].cut);
+    table->set_range(TAB_EXP,m,0.0,params[m].r0);
+  }
+  table->build(ntabulate);
+  tab = table;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void PairVashishta::twobody(Param *param, double rsq, double &fforce,
@@ -484,6 +526,11 @@ void PairVashishta::twobody(Param *param, double rsq, double &fforce,
   double r,rinvsq,r4inv,r6inv,reta,lam1r,lam4r,vc2,vc3;
 
   r = sqrt(rsq);
+  if (tab && tab->lookup(TAB_PHI2,param-params,r,eng,fforce)) {
+    fforce /= -r;
+    return;
+  }
+
   rinvsq = 1.0/rsq;
   r4inv = rinvsq*rinvsq;
   r6inv = rinvsq*r4inv;
@@ -513,20 +560,30 @@ void PairVashishta::threebody(Param *paramij, Param *paramik, Param *paramijk,
   double r2,rinvsq2,rainv2,gsrainv2,gsrainvsq2,expgsrainv2;
   double rinv12,cs,delcs,delcssq,facexp,facrad,frad1,frad2,pcsinv,pcsinvsq,pcs;
   double facang,facang12,csfacang,csfac1,csfac2;
+  double dexp1,dexp2;
+  int tabflag = 0;
 
   r1 = sqrt(rsq1);
   rinvsq1 = 1.0/rsq1;
-  rainv1 = 1.0/(r1 - paramij->r0);
-  gsrainv1 = paramij->gamma * rainv1;
-  gsrainvsq1 = gsrainv1*rainv1/r1;
-  expgsrainv1 = exp(gsrainv1);
-
   r2 = sqrt(rsq2);
   rinvsq2 = 1.0/rsq2;
-  rainv2 = 1.0/(r2 - paramik->r0);
-  gsrainv2 = paramik->gamma * rainv2;
-  gsrainvsq2 = gsrainv2*rainv2/r2;
-  expgsrainv2 = exp(gsrainv2);
+
+  // radial factors and their derivatives from the tables, if possible
+
+  if (tab && tab->lookup(TAB_EXP,paramij-params,r1,expgsrainv1,dexp1) &&
+      tab->lookup(TAB_EXP,paramik-params,r2,expgsrainv2,dexp2)) {
+    tabflag = 1;
+  } else {
+    rainv1 = 1.0/(r1 - paramij->r0);
+    gsrainv1 = paramij->gamma * rainv1;
+    gsrainvsq1 = gsrainv1*rainv1/r1;
+    expgsrainv1 = exp(gsrainv1);
+
+    rainv2 = 1.0/(r2 - paramik->r0);
+    gsrainv2 = paramik->gamma * rainv2;
+    gsrainvsq2 = gsrainv2*rainv2/r2;
+    expgsrainv2 = exp(gsrainv2);
+  }
 
   rinv12 = 1.0/(r1*r2);
   cs = (delr1[0]*delr2[0] + delr1[1]*delr2[1] + delr1[2]*delr2[2]) * rinv12;
@@ -539,8 +596,13 @@ void PairVashishta::threebody(Param *paramij, Param *paramik, Param *paramijk,
   facexp = expgsrainv1*expgsrainv2;
 
   facrad = paramijk->bigb * facexp * pcs;
-  frad1 = facrad*gsrainvsq1;
-  frad2 = facrad*gsrainvsq2;
+  if (tabflag) {
+    frad1 = -paramijk->bigb * pcs*expgsrainv2*dexp1/r1;
+    frad2 = -paramijk->bigb * pcs*expgsrainv1*dexp2/r2;
+  } else {
+    frad1 = facrad*gsrainvsq1;
+    frad2 = facrad*gsrainvsq2;
+  }
   facang = paramijk->big2b * facexp * delcs/pcsinvsq;
   facang12 = rinv12*facang;
   csfacang = cs*facang;
@@ -54,9 +54,13 @@ class PairVashishta : public Pair {
   int maxshort;       // size of short neighbor list array
   int *neighshort;    // short neighbor list array
 
+  enum { TAB_PHI2, TAB_EXP, NTAB };
+  class RadialTable *tab;    // tabulated radial functions, see pair_modify tabulate
+
   void allocate();
   void read_file(char *);
   virtual void setup_params();
+  void setup_table();
   void twobody(Param *, double, double &, int, double &);
   void threebody(Param *, Param *, Param *, double, double, double *, double *, double *, double *,
                  int, double &);
@@ -30,6 +30,7 @@ using namespace LAMMPS_NS;
 
 PairVashishtaTable::PairVashishtaTable(LAMMPS *lmp) : PairVashishta(lmp)
 {
+  tabulate_enable = 0;
   forceTable = nullptr;
   potentialTable = nullptr;
 }
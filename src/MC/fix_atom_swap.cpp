@@ -33,6 +33,7 @@
 #include "kspace.h"
 #include "memory.h"
 #include "modify.h"
+#include "neigh_list.h"
 #include "neighbor.h"
 #include "pair.h"
 #include "random_park.h"
@@ -43,6 +44,8 @@
 #include <cfloat>
 #include <cmath>
 #include <cstring>
+#include <utility>
+#include <vector>
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
@@ -53,7 +56,7 @@ FixAtomSwap::FixAtomSwap(LAMMPS *lmp, int narg, char **arg) :
     Fix(lmp, narg, arg), region(nullptr), idregion(nullptr), type_list(nullptr), mu(nullptr),
     qtype(nullptr), sqrt_mass_ratio(nullptr), local_swap_iatom_list(nullptr),
     local_swap_jatom_list(nullptr), local_swap_atom_list(nullptr), random_equal(nullptr),
-    random_unequal(nullptr), c_pe(nullptr)
+    random_unequal(nullptr), random_local(nullptr), c_pe(nullptr), list(nullptr)
 {
   if (narg < 10) error->all(FLERR, "Illegal fix atom/swap command");
 
@@ -96,6 +99,10 @@ FixAtomSwap::FixAtomSwap(LAMMPS *lmp, int narg, char **arg) :
 
   random_unequal = new RanPark(lmp, seed);
 
+  // random number generator for concurrent trials, different on each proc
+
+  if (checker_flag) random_local = new RanPark(lmp, seed + comm->me);
+
   // set up reneighboring
 
   force_reneighbor = 1;
@@ -134,6 +141,7 @@ FixAtomSwap::~FixAtomSwap()
   delete[] idregion;
   delete random_equal;
   delete random_unequal;
+  delete random_local;
 }
 
 /* ----------------------------------------------------------------------
@@ -146,6 +154,8 @@ void FixAtomSwap::options(int narg, char **arg)
 
   ke_flag = 1;
   semi_grand_flag = 0;
+  local_flag = 0;
+  checker_flag = 0;
   nswaptypes = 0;
   nmutypes = 0;
 
@@ -161,6 +171,14 @@ void FixAtomSwap::options(int narg, char **arg)
       if (iarg + 2 > narg) error->all(FLERR, "Illegal fix atom/swap command");
       ke_flag = utils::logical(FLERR, arg[iarg + 1], false, lmp);
       iarg += 2;
+    } else if (strcmp(arg[iarg], "local") == 0) {
+      if (iarg + 2 > narg) error->all(FLERR, "Illegal fix atom/swap command");
+      local_flag = utils::logical(FLERR, arg[iarg + 1], false, lmp);
+      iarg += 2;
+    } else if (strcmp(arg[iarg], "checkerboard") == 0) {
+      if (iarg + 2 > narg) error->all(FLERR, "Illegal fix atom/swap command");
+      checker_flag = utils::logical(FLERR, arg[iarg + 1], false, lmp);
+      iarg += 2;
     } else if (strcmp(arg[iarg], "semi-grand") == 0) {
       if (iarg + 2 > narg) error->all(FLERR, "Illegal fix atom/swap command");
       semi_grand_flag = utils::logical(FLERR, arg[iarg + 1], false, lmp);
@@ -282,6 +300,26 @@ void FixAtomSwap::init()
         if (cutsq[type_list[iswaptype]][ktype] != cutsq[type_list[jswaptype]][ktype])
           unequal_cutoffs = true;
 
+  // energy differences of trial swaps can be computed locally
+  // if only the pair style depends on atom types and cutoffs are equal
+  // requires a full neighbor list with neighbors of ghost atoms
+
+  local_energy = 0;
+  if (local_flag && force->pair && force->pair->energy_local_enable && !force->kspace &&
+      !unequal_cutoffs && (modify->n_pre_force == 0) && (modify->n_energy_global == 0))
+    local_energy = 1;
+
+  if (local_energy) neighbor->add_request(this, NeighConst::REQ_FULL | NeighConst::REQ_GHOST);
+
+  // concurrent trials in checkerboard cells rely on local energies
+
+  if (checker_flag) {
+    if (!local_energy)
+      error->all(FLERR, "Fix atom/swap checkerboard requires local energy differences");
+    if (domain->triclinic)
+      error->all(FLERR, "Fix atom/swap checkerboard does not support triclinic boxes");
+  }
+
   // check that no swappable atoms are in atom->firstgroup
   // swapping such an atom might not leave firstgroup atoms first
 
@@ -300,6 +338,13 @@ void FixAtomSwap::init()
   }
 }
 
+/* ---------------------------------------------------------------------- */
+
+void FixAtomSwap::init_list(int /*id*/, NeighList *ptr)
+{
+  list = ptr;
+}
+
 /* ----------------------------------------------------------------------
    attempt Monte Carlo swaps
 ------------------------------------------------------------------------- */
@@ -322,26 +367,50 @@ void FixAtomSwap::pre_exchange()
   if (modify->n_pre_neighbor) modify->pre_neighbor();
   neighbor->build(1);
 
-  // energy_stored = energy of current state
-  // will be updated after accepted swaps
+  // local energies need the images of swapped atoms
+  // create a temporary atom map if none exists, atoms do not move until it is deleted
 
-  energy_stored = energy_full();
+  int mapflag = 0;
+  if (local_energy && (atom->map_style == Atom::MAP_NONE)) {
+    mapflag = 1;
+    atom->map_init();
+    atom->map_set();
+  }
 
-  // attempt Ncycle atom swaps
+  // with checkerboard, all procs attempt swaps in their own cells at once
+  // otherwise, energy_stored = energy of current state
+  //   will be updated after accepted swaps
+
+  if (checker_flag) {
+    double nattempts;
+    int nsuccess = attempt_checkerboard(nattempts);
+    nswap_attempts += nattempts;
+    nswap_successes += nsuccess;
 
-  int nsuccess = 0;
-  if (semi_grand_flag) {
-    update_semi_grand_atoms_list();
-    for (int i = 0; i < ncycles; i++) nsuccess += attempt_semi_grand();
   } else {
-    update_swap_atoms_list();
-    for (int i = 0; i < ncycles; i++) nsuccess += attempt_swap();
-  }
+    energy_stored = energy_full();
+
+    // attempt Ncycle atom swaps
+
+    int nsuccess = 0;
+    if (semi_grand_flag) {
+      update_semi_grand_atoms_list();
+      for (int i = 0; i < ncycles; i++) nsuccess += attempt_semi_grand();
+    } else {
+      update_swap_atoms_list();
+      for (int i = 0; i < ncycles; i++) nsuccess += attempt_swap();
+    }
+
+    // udpate MC stats
 
-  // udpate MC stats
+    nswap_attempts += ncycles;
+    nswap_successes += nsuccess;
+  }
 
-  nswap_attempts += ncycles;
-  nswap_successes += nsuccess;
+  if (mapflag) {
+    atom->map_delete();
+    atom->map_style = Atom::MAP_NONE;
+  }
 
   next_reneighbor = update->ntimestep + nevery;
 
@@ -374,9 +443,20 @@ int FixAtomSwap::attempt_semi_grand()
       jswaptype = static_cast<int>(nswaptypes * random_unequal->uniform());
       jtype = type_list[jswaptype];
     }
-    atom->type[i] = jtype;
   }
 
+  // local energy of the neighborhood of the picked atom before the swap
+
+  tagint itag = 0;
+  double elocal_before = 0.0;
+  if (local_energy) {
+    tagint tmp = (i >= 0) ? atom->tag[i] : 0;
+    MPI_Allreduce(&tmp, &itag, 1, MPI_LMP_TAGINT, MPI_MAX, world);
+    elocal_before = energy_local(1, &itag);
+  }
+
+  if (i >= 0) atom->type[i] = jtype;
+
   // if unequal_cutoffs, call comm->borders() and rebuild neighbor list
   // else communicate ghost atoms
   // call to comm->exchange() is a no-op but clears ghost atoms
@@ -394,8 +474,13 @@ int FixAtomSwap::attempt_semi_grand()
 
   // post-swap energy
 
-  if (force->kspace) force->kspace->qsum_qsq();
-  double energy_after = energy_full();
+  double energy_after;
+  if (local_energy) {
+    energy_after = energy_before + energy_local(1, &itag) - elocal_before;
+  } else {
+    if (force->kspace) force->kspace->qsum_qsq();
+    energy_after = energy_full();
+  }
 
   int success = 0;
   if (i >= 0)
@@ -425,8 +510,10 @@ int FixAtomSwap::attempt_semi_grand()
   // restore the swapped atom
   // do not need to re-call comm->borders() and rebuild neighbor list
   //   since will be done on next cycle or in Verlet when this fix finishes
+  // local energies need restored ghost types before the next trial
 
   if (i >= 0) atom->type[i] = itype;
+  if (local_energy) comm->forward_comm(this);
   if (force->kspace) force->kspace->qsum_qsq();
 
   return 0;
@@ -453,6 +540,18 @@ int FixAtomSwap::attempt_swap()
   int itype = type_list[0];
   int jtype = type_list[1];
 
+  // local energy of the neighborhoods of both atoms before the swap
+
+  tagint tags[2] = {0, 0};
+  double elocal_before = 0.0;
+  if (local_energy) {
+    tagint tmp[2];
+    tmp[0] = (i >= 0) ? atom->tag[i] : 0;
+    tmp[1] = (j >= 0) ? atom->tag[j] : 0;
+    MPI_Allreduce(tmp, tags, 2, MPI_LMP_TAGINT, MPI_MAX, world);
+    elocal_before = energy_local(2, tags);
+  }
+
   if (i >= 0) {
     atom->type[i] = jtype;
     if (atom->q_flag) atom->q[i] = qtype[1];
@@ -480,7 +579,11 @@ int FixAtomSwap::attempt_swap()
 
   // post-swap energy
 
-  double energy_after = energy_full();
+  double energy_after;
+  if (local_energy)
+    energy_after = energy_before + energy_local(2, tags) - elocal_before;
+  else
+    energy_after = energy_full();
 
   // swap accepted, return 1
   // if ke_flag, rescale atom velocities
@@ -507,6 +610,7 @@ int FixAtomSwap::attempt_swap()
   // restore the swapped itype & jtype atoms
   // do not need to re-call comm->borders() and rebuild neighbor list
   //   since will be done on next cycle or in Verlet when this fix finishes
+  // local energies need restored ghost types before the next trial
 
   if (i >= 0) {
     atom->type[i] = type_list[0];
@@ -516,10 +620,241 @@ int FixAtomSwap::attempt_swap()
     atom->type[j] = type_list[1];
     if (atom->q_flag) atom->q[j] = qtype[1];
   }
+  if (local_energy) comm->forward_comm(this);
 
   return 0;
 }
 
+/* ----------------------------------------------------------------------
+   attempt Ncycle swaps concurrently on all procs
+   each subdomain is split into an even number of cells in each dim,
+     at least 2 pair cutoffs wide, and cells are colored like a checkerboard
+   cells of the same color are then 2 pair cutoffs apart, also across procs,
+     so swaps in them do not change each other's energy differences
+   the two atoms of a swap may be in different cells of the active color,
+     so that composition is exchanged between cells
+   colors are visited in random order, ghost atoms are updated after each
+   return # of accepted swaps on all procs and # of attempts in nattempts
+------------------------------------------------------------------------- */
+
+int FixAtomSwap::attempt_checkerboard(double &nattempts)
+{
+  const int dimension = domain->dimension;
+  const int ncolors = (dimension == 3) ? 8 : 4;
+  const double cutforce = force->pair->cutforce;
+
+  // ghost atoms must include the complete neighborhood of affected ghost atoms
+
+  for (int d = 0; d < dimension; d++)
+    if (comm->cutghost[d] < neighbor->cutneighmax + cutforce)
+      error->all(FLERR,
+                 "Fix atom/swap checkerboard requires a ghost atom cutoff of at least {:.8}, "
+                 "use comm_modify cutoff",
+                 neighbor->cutneighmax + cutforce);
+
+  // cell grid of this subdomain
+
+  int flag = 0;
+  for (int d = 0; d < 3; d++) {
+    checker_ncell[d] = 1;
+    checker_cellinv[d] = 0.0;
+    if (d >= dimension) continue;
+    double len = domain->subhi[d] - domain->sublo[d];
+    checker_ncell[d] = 2 * static_cast<int>(len / (4.0 * cutforce));
+    if (checker_ncell[d] < 2)
+      flag = 1;
+    else
+      checker_cellinv[d] = checker_ncell[d] / len;
+  }
+
+  int flagall;
+  MPI_Allreduce(&flag, &flagall, 1, MPI_INT, MPI_MAX, world);
+  if (flagall)
+    error->all(FLERR,
+               "Fix atom/swap checkerboard requires subdomains at least 4 pair cutoffs wide");
+
+  // sort candidate atoms by color
+  // for swaps, j atoms are picked from any cell of the color of the i atom
+
+  std::vector<int> cand[8], jcand[8];
+  int color, ntotal;
+
+  if (semi_grand_flag) {
+    update_semi_grand_atoms_list();
+    for (int m = 0; m < nswap_local; m++) {
+      int i = local_swap_atom_list[m];
+      cand[checker_color(atom->x[i])].push_back(i);
+    }
+    ntotal = nswap;
+  } else {
+    update_swap_atoms_list();
+    for (int m = 0; m < njswap_local; m++) {
+      int j = local_swap_jatom_list[m];
+      jcand[checker_color(atom->x[j])].push_back(j);
+    }
+    for (int m = 0; m < niswap_local; m++) {
+      int i = local_swap_iatom_list[m];
+      cand[checker_color(atom->x[i])].push_back(i);
+    }
+    ntotal = niswap;
+  }
+
+  int nattempt_local = 0;
+  int nsuccess_local = 0;
+
+  if ((ntotal > 0) && (semi_grand_flag || (njswap > 0))) {
+
+    // random order of colors, the same on all procs
+
+    int order[8];
+    for (int c = 0; c < ncolors; c++) order[c] = c;
+    for (int c = ncolors - 1; c > 0; c--) {
+      int k = static_cast<int>((c + 1) * random_equal->uniform());
+      if (k > c) k = c;
+      std::swap(order[c], order[k]);
+    }
+
+    // attempts per color are proportional to the candidates of that color on this proc
+    // fractional attempts are rounded stochastically
+
+    for (int c = 0; c < ncolors; c++) {
+      color = order[c];
+      int ncand = cand[color].size();
+      double expected = (double) ncycles * ncand / ntotal;
+      int nattempt = static_cast<int>(expected);
+      if (random_local->uniform() < expected - nattempt) nattempt++;
+
+      if (ncand > 0) {
+        for (int n = 0; n < nattempt; n++) {
+          int m = static_cast<int>(ncand * random_local->uniform());
+          if (m >= ncand) m = ncand - 1;
+          if (semi_grand_flag) {
+            nsuccess_local += attempt_semi_grand_cell(cand[color][m]);
+          } else {
+            std::vector<int> &jlist = jcand[color];
+            int njcand = jlist.size();
+            if (njcand == 0) continue;
+            int k = static_cast<int>(njcand * random_local->uniform());
+            if (k >= njcand) k = njcand - 1;
+            int i = cand[color][m];
+            int j = jlist[k];
+            if (attempt_swap_cell(i, j)) {
+              cand[color][m] = j;
+              jlist[k] = i;
+              nsuccess_local++;
+            }
+          }
+          nattempt_local++;
+        }
+      }
+
+      // make types of owned atoms in cells of this color known to other procs
+
+      comm->forward_comm(this);
+    }
+  }
+
+  double nattempt_one = nattempt_local;
+  MPI_Allreduce(&nattempt_one, &nattempts, 1, MPI_DOUBLE, MPI_SUM, world);
+  int nsuccess;
+  MPI_Allreduce(&nsuccess_local, &nsuccess, 1, MPI_INT, MPI_SUM, world);
+  return nsuccess;
+}
+
+/* ----------------------------------------------------------------------
+   attempt a semi-grand swap of owned atom I without communication
+------------------------------------------------------------------------- */
+
+int FixAtomSwap::attempt_semi_grand_cell(int i)
+{
+  int itype = atom->type[i];
+  int jtype = itype;
+  while (itype == jtype) {
+    int jswaptype = static_cast<int>(nswaptypes * random_local->uniform());
+    if (jswaptype >= nswaptypes) jswaptype = nswaptypes - 1;
+    jtype = type_list[jswaptype];
+  }
+
+  int sites[1] = {i};
+  double energy_before = force->pair->energy_local(list, 1, sites, 1);
+  set_type_images(i, jtype, 0.0);
+  double energy_after = force->pair->energy_local(list, 1, sites, 1);
+
+  if (random_local->uniform() <
+      exp(beta * (energy_before - energy_after + mu[jtype] - mu[itype]))) {
+    if (ke_flag) {
+      atom->v[i][0] *= sqrt_mass_ratio[itype][jtype];
+      atom->v[i][1] *= sqrt_mass_ratio[itype][jtype];
+      atom->v[i][2] *= sqrt_mass_ratio[itype][jtype];
+    }
+    return 1;
+  }
+
+  set_type_images(i, itype, 0.0);
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+   attempt a swap of owned atoms I and J in cells of the same color
+     without communication
+------------------------------------------------------------------------- */
+
+int FixAtomSwap::attempt_swap_cell(int i, int j)
+{
+  int itype = type_list[0];
+  int jtype = type_list[1];
+  double qi = atom->q_flag ? qtype[0] : 0.0;
+  double qj = atom->q_flag ? qtype[1] : 0.0;
+
+  int sites[2] = {i, j};
+  double energy_before = force->pair->energy_local(list, 2, sites, 1);
+  set_type_images(i, jtype, qj);
+  set_type_images(j, itype, qi);
+  double energy_after = force->pair->energy_local(list, 2, sites, 1);
+
+  if (random_local->uniform() < exp(beta * (energy_before - energy_after))) {
+    if (ke_flag) {
+      atom->v[i][0] *= sqrt_mass_ratio[itype][jtype];
+      atom->v[i][1] *= sqrt_mass_ratio[itype][jtype];
+      atom->v[i][2] *= sqrt_mass_ratio[itype][jtype];
+      atom->v[j][0] *= sqrt_mass_ratio[jtype][itype];
+      atom->v[j][1] *= sqrt_mass_ratio[jtype][itype];
+      atom->v[j][2] *= sqrt_mass_ratio[jtype][itype];
+    }
+    return 1;
+  }
+
+  set_type_images(i, itype, qi);
+  set_type_images(j, jtype, qj);
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+   color of the checkerboard cell of a point in this subdomain
+------------------------------------------------------------------------- */
+
+int FixAtomSwap::checker_color(double *xi)
+{
+  int c[3] = {0, 0, 0};
+  for (int d = 0; d < domain->dimension; d++) {
+    c[d] = static_cast<int>((xi[d] - domain->sublo[d]) * checker_cellinv[d]);
+    c[d] = MAX(0, MIN(c[d], checker_ncell[d] - 1));
+  }
+  return (c[0] & 1) + 2 * (c[1] & 1) + 4 * (c[2] & 1);
+}
+
+/* ----------------------------------------------------------------------
+   set type (and charge) of owned atom I and its ghost images on this proc
+------------------------------------------------------------------------- */
+
+void FixAtomSwap::set_type_images(int i, int itype, double qi)
+{
+  for (int m = atom->map(atom->tag[i]); m >= 0; m = atom->sametag[m]) {
+    atom->type[m] = itype;
+    if (atom->q_flag && !semi_grand_flag) atom->q[m] = qi;
+  }
+}
+
 /* ----------------------------------------------------------------------
    compute system potential energy
 ------------------------------------------------------------------------- */
@@ -550,6 +885,28 @@ double FixAtomSwap::energy_full()
   return total_energy;
 }
 
+/* ----------------------------------------------------------------------
+   pair energy of the neighborhood of the atoms with the given tags
+   includes all periodic images and ghost copies of these atoms
+------------------------------------------------------------------------- */
+
+double FixAtomSwap::energy_local(int n, tagint *tags)
+{
+  std::vector<int> sites;
+  for (int k = 0; k < n; k++) {
+    int i = atom->map(tags[k]);
+    while (i >= 0) {
+      sites.push_back(i);
+      i = atom->sametag[i];
+    }
+  }
+
+  double energy = force->pair->energy_local(list, sites.size(), sites.data(), 0);
+  double energy_all;
+  MPI_Allreduce(&energy, &energy_all, 1, MPI_DOUBLE, MPI_SUM, world);
+  return energy_all;
+}
+
 /* ----------------------------------------------------------------------
 ------------------------------------------------------------------------- */
 
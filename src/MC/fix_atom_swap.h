@@ -30,6 +30,7 @@ class FixAtomSwap : public Fix {
   ~FixAtomSwap() override;
   int setmask() override;
   void init() override;
+  void init_list(int, class NeighList *) override;
   void pre_exchange() override;
   int pack_forward_comm(int, int *, double *, int, int *) override;
   void unpack_forward_comm(int, int, double *) override;
@@ -43,6 +44,11 @@ class FixAtomSwap : public Fix {
   int nevery, seed;
   int ke_flag;            // yes = conserve ke, no = do not conserve ke
   int semi_grand_flag;    // yes = semi-grand canonical, no = constant composition
+  int local_flag;         // yes = use local energy differences when possible
+  int local_energy;       // 1 if trial energies come from Pair::energy_local()
+  int checker_flag;       // yes = concurrent trials on all procs in checkerboard cells
+  int checker_ncell[3];   // # of checkerboard cells in each dim of this subdomain
+  double checker_cellinv[3];    // inverse width of checkerboard cells
   int ncycles;
   int niswap, njswap;                  // # of i,j swap atoms on all procs
   int niswap_local, njswap_local;      // # of swap atoms on this proc
@@ -75,13 +81,21 @@ class FixAtomSwap : public Fix {
 
   class RanPark *random_equal;
   class RanPark *random_unequal;
+  class RanPark *random_local;    // different on each proc, for checkerboard trials
 
   class Compute *c_pe;
+  class NeighList *list;
 
   void options(int, char **);
   int attempt_semi_grand();
   int attempt_swap();
+  int attempt_checkerboard(double &);
+  int attempt_semi_grand_cell(int);
+  int attempt_swap_cell(int, int);
+  int checker_color(double *);
+  void set_type_images(int, int, double);
   double energy_full();
+  double energy_local(int, tagint *);
   int pick_semi_grand_atom();
   int pick_i_swap_atom();
   int pick_j_swap_atom();
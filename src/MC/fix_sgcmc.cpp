@@ -50,6 +50,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <vector>
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
@@ -84,6 +85,7 @@ FixSemiGrandCanonicalMC::FixSemiGrandCanonicalMC(LAMMPS *_lmp, int narg, char **
   nRejectedSwaps = 0;
   kappa = 0;
   serialMode = false;
+  localEnergy = false;
 
   if (domain->triclinic)
     error->all(FLERR, "Fix sgcmc does not support non-orthogonal simulation boxes.");
@@ -245,13 +247,23 @@ void FixSemiGrandCanonicalMC::init()
 
   // Save a pointer to the EAM potential.
   pairEAM = dynamic_cast<PairEAM*>(force->pair);
+  localEnergy = false;
   if (!pairEAM) {
-    if (comm->me == 0)
-      utils::logmesg(lmp, "  SGC - Using naive total energy calculation for MC -> SLOW!\n");
+    // Other pair styles may provide the energies of the neighborhood of a flipped atom,
+    // unless fixes add to the energy or change it in their pre_force() stage.
+    localEnergy = force->pair->energy_local_enable && !force->kspace &&
+      (modify->n_energy_global == 0) && (modify->n_pre_force == 0);
+
+    if (comm->me == 0) {
+      if (localEnergy)
+        utils::logmesg(lmp, "  SGC - Using local energy differences of pair style for MC.\n");
+      else
+        utils::logmesg(lmp, "  SGC - Using naive total energy calculation for MC -> SLOW!\n");
+    }
 
     if (comm->nprocs > 1)
-      error->all(FLERR, "Can not run fix sgcmc with naive total energy calculation "
-                 "and more than one MPI process.");
+      error->all(FLERR, "Can not run fix sgcmc with {} and more than one MPI process.",
+                 localEnergy ? "local energy differences" : "naive total energy calculation");
 
     // Get reference to a compute that will provide the total energy of the system.
     // This is needed by computeTotalEnergy().
@@ -260,8 +272,11 @@ void FixSemiGrandCanonicalMC::init()
   interactionRadius = force->pair->cutforce;
   if (comm->me == 0) utils::logmesg(lmp, "  SGC - Interaction radius: {}\n", interactionRadius);
 
-  // This fix needs a full neighbor list.
-  neighbor->add_request(this, NeighConst::REQ_FULL);
+  // This fix needs a full neighbor list. Local energies also need the neighbors of ghost atoms.
+  if (localEnergy)
+    neighbor->add_request(this, NeighConst::REQ_FULL | NeighConst::REQ_GHOST);
+  else
+    neighbor->add_request(this, NeighConst::REQ_FULL);
 
   // Count local number of atoms from each species.
   const int *type = atom->type;
@@ -823,6 +838,36 @@ double FixSemiGrandCanonicalMC::computeEnergyChangeEAM(int flipAtom, int flipAto
  *********************************************************************/
 double FixSemiGrandCanonicalMC::computeEnergyChangeGeneric(int flipAtom, int oldSpecies, int newSpecies)
 {
+  if (localEnergy) {
+    if (flipAtom < 0) return 0.0;
+
+    // Collect the flipped atom and all its periodic images.
+    std::vector<int> sites;
+    tagint flipTag = atom->tag[flipAtom];
+    if (atom->map_style != Atom::MAP_NONE) {
+      for (int i = atom->map(flipTag); i >= 0; i = atom->sametag[i]) sites.push_back(i);
+    } else {
+      int nall = atom->nlocal + atom->nghost;
+      for (int i = 0; i < nall; i++)
+        if (atom->tag[i] == flipTag) sites.push_back(i);
+    }
+
+    // Bring ghost atom types up to date with previously accepted flips.
+    communicationStage = 3;
+    comm->forward_comm(this);
+    double oldEnergy = force->pair->energy_local(neighborList, (int) sites.size(), sites.data(), 0);
+
+    // Perform trial move and compute the energy of the same neighborhood.
+    atom->type[flipAtom] = newSpecies;
+    comm->forward_comm(this);
+    double newEnergy = force->pair->energy_local(neighborList, (int) sites.size(), sites.data(), 0);
+
+    // Undo trial move. Ghost atoms are updated before the next trial move.
+    atom->type[flipAtom] = oldSpecies;
+
+    return newEnergy - oldEnergy;
+  }
+
   // This routine is called even when no trial move is being performed during the
   // the current iteration to keep the parallel processors in sync. If no trial
   // move is performed then the energy is calculated twice for the same state of the system.
@@ -165,6 +165,10 @@ class FixSemiGrandCanonicalMC : public Fix {
   // This is required to access the Rho arrays calculated by the potential class and its potential tables.
   class PairEAM *pairEAM;
 
+  // Indicates that energy changes of other potentials are computed from the local
+  // energies of the neighborhood of the flipped atom provided by the pair style.
+  bool localEnergy;
+
   // This array contains a boolean value per atom (real and ghosts) that indicates whether
   // the electron density or another property at that site has been affected by one of the accepted MC swaps.
   std::vector<bool> changedAtoms;
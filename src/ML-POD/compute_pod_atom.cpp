@@ -22,7 +22,7 @@
 #include "modify.h"
 #include "neigh_list.h"
 #include "neighbor.h"
-#include "pair.h"
+#include "pair_pod.h"
 #include "update.h"
 
 #include <cstring>
@@ -36,15 +36,15 @@ enum { SCALAR, VECTOR, ARRAY };
 ComputePODAtom::ComputePODAtom(LAMMPS *lmp, int narg, char **arg) :
     Compute(lmp, narg, arg), list(nullptr), podptr(nullptr), pod(nullptr), tmpmem(nullptr),
     rij(nullptr), elements(nullptr), map(nullptr), ai(nullptr), aj(nullptr), ti(nullptr),
-    tj(nullptr)
+    tj(nullptr), pairpod(nullptr)
 {
   int nargmin = 6;
 
   if (narg < nargmin) error->all(FLERR, "Illegal compute {} command", style);
   if (comm->nprocs > 1) error->all(FLERR, "compute command does not support multi processors");
 
-  std::string pod_file = std::string(arg[3]);      // pod input file
-  std::string coeff_file = std::string(arg[4]);    // coefficient input file
+  pod_file = std::string(arg[3]);      // pod input file
+  coeff_file = std::string(arg[4]);    // coefficient input file
   podptr = new EAPOD(lmp, pod_file, coeff_file);
 
   int ntypes = atom->ntypes;
@@ -87,6 +87,12 @@ void ComputePODAtom::init()
 
   if (modify->get_compute_by_style("pod").size() > 1 && comm->me == 0)
     error->warning(FLERR,"More than one compute pod");
+
+  // reuse the descriptors computed by pair style pod, if it uses the same model
+
+  pairpod = dynamic_cast<PairPOD *>(force->pair_match("^pod", 0));
+  if (pairpod && ((pairpod != force->pair) || !pairpod->share_descriptors(pod_file, coeff_file, map)))
+    pairpod = nullptr;
 }
 
 
@@ -118,6 +124,18 @@ void ComputePODAtom::compute_peratom()
       pod[i][icoeff] = 0.0;
     }
 
+  // copy descriptors from pair style pod, if it was computed on this step
+
+  if (pairpod) {
+    double **desc = pairpod->get_descriptors(update->ntimestep);
+    if (desc) {
+      const int nlocal = atom->nlocal;
+      for (int i = 0; i < nlocal; i++)
+        for (int icoeff = 0; icoeff < size_peratom_cols; icoeff++) pod[i][icoeff] = desc[i][icoeff];
+      return;
+    }
+  }
+
   // invoke full neighbor list (will copy or build if necessary)
 
   neighbor->build_one(list);
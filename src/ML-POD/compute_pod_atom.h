@@ -53,6 +53,10 @@ class ComputePODAtom : public Compute {
   int *aj;    // IDs of atoms J for all pairs (I, J)
   int *ti;    // types of atoms I for all pairs (I, J)
   int *tj;    // types of atoms J  for all pairs (I, J)
+
+  std::string pod_file;      // pod input file
+  std::string coeff_file;    // coefficient input file
+  class PairPOD *pairpod;    // pair style pod sharing its per-atom descriptors
 };
 
 }    // namespace LAMMPS_NS
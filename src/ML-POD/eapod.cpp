@@ -870,7 +870,9 @@ void EAPOD::peratombase_descriptors(double *bd1, double *bdd1, double *rij, doub
   double *rbfyt = &temp[4*n1 + n5 + 4*n2 + 2*n3]; // Nj*ns
   double *rbfzt = &temp[4*n1 + n5 + 4*n2 + 3*n3]; // Nj*ns
 
-  radialbasis(rbft, rbfxt, rbfyt, rbfzt, rij, besselparams, rin, rcut-rin, pdegree[0], pdegree[1], nbesselpars, Nj);
+  double *rbftmp = &temp[4*n1 + n5 + 4*n2 + 4*n3]; // 12*Nj
+
+  radialbasis(rbft, rbfxt, rbfyt, rbfzt, rij, rbftmp, besselparams, rin, rcut-rin, pdegree[0], pdegree[1], nbesselpars, Nj);
 
   char chn = 'N';
   double alpha = 1.0, beta = 0.0;
@@ -888,7 +890,7 @@ void EAPOD::peratombase_descriptors(double *bd1, double *bdd1, double *rij, doub
     double *abfx = &temp[4*n1 + n5 + 4*n2 + n4]; // Nj*K3
     double *abfy = &temp[4*n1 + n5 + 4*n2 + 2*n4]; // Nj*K3
     double *abfz = &temp[4*n1 + n5 + 4*n2 + 3*n4]; // Nj*K3
-    double *tm = &temp[4*n1 + n5 + 4*n2 + 4*n4]; // 4*K3
+    double *tm = &temp[4*n1 + n5 + 4*n2 + 4*n4]; // 12*Nj
 
     angularbasis(abf, abfx, abfy, abfz, rij, tm, pq3, Nj, K3);
 
@@ -1215,6 +1217,31 @@ void EAPOD::allbody_forces(double *fij, double *forcecoeff, double *Ux, double *
 double EAPOD::peratomenergyforce2(double *fij, double *rij, double *temp,
         int *ti, int *tj, int Nj)
 {
+  return peratomenergyforce2(fij, rij, temp, bd, bdd, nullptr, ti, tj, Nj);
+}
+
+/**
+ * @brief Calculates the energy of atom i and the pair forces (i,j) with caller provided scratch.
+ *
+ * All per-atom work arrays are passed in, so that concurrent calls from different
+ * threads with separate scratch memory are safe.
+ *
+ * @param fij   Pointer to the output pair forces, 3*Nj.
+ * @param rij   Pointer to the relative positions of neighboring atoms and atom i, 3*Nj.
+ * @param temp  Pointer to temporary memory of size ndblmem.
+ * @param bd    Pointer to the output base descriptors, Mdesc.
+ * @param cb    Pointer to temporary memory of size estimate_coeff_memory().
+ * @param pd    Pointer to the output environment probabilities, nClusters (may be nullptr).
+ * @param ti    Pointer to the types of atom i.
+ * @param tj    Pointer to the types of atoms j.
+ * @param Nj    Number of neighboring atoms.
+ * @return      The energy of atom i.
+ */
+double EAPOD::peratomenergyforce2(double *fij, double *rij, double *temp, double *bd,
+        double *cb, double *pd, int *ti, int *tj, int Nj)
+{
+  for (int i=0; i<Mdesc; i++) bd[i] = 0.0;
+
   if (Nj==0) {
     return coeff[nCoeffPerElement*(ti[0]-1)];
   }
@@ -1224,7 +1251,6 @@ double EAPOD::peratomenergyforce2(double *fij, double *rij, double *temp,
 
   //double *coeff1 = &coeff[nCoeffPerElement*(ti[0]-1)];
   double e = 0.0;
-  for (int i=0; i<Mdesc; i++) bd[i] = 0.0;
 
   double *d2 =  &bd[0]; // nl2
   double *d3 =  &bd[nl2]; // nl3
@@ -1256,7 +1282,9 @@ double EAPOD::peratomenergyforce2(double *fij, double *rij, double *temp,
   double *rbfyt = &temp[4*n1 + n5 + 4*n2 + 2*n3]; // Nj*ns
   double *rbfzt = &temp[4*n1 + n5 + 4*n2 + 3*n3]; // Nj*ns
 
-  radialbasis(rbft, rbfxt, rbfyt, rbfzt, rij, besselparams, rin, rcut-rin, pdegree[0], pdegree[1], nbesselpars, Nj);
+  double *rbftmp = &temp[4*n1 + n5 + 4*n2 + 4*n3]; // 12*Nj
+
+  radialbasis(rbft, rbfxt, rbfyt, rbfzt, rij, rbftmp, besselparams, rin, rcut-rin, pdegree[0], pdegree[1], nbesselpars, Nj);
 
   char chn = 'N';
   double alpha = 1.0, beta = 0.0;
@@ -1274,7 +1302,7 @@ double EAPOD::peratomenergyforce2(double *fij, double *rij, double *temp,
     double *abfx = &temp[4*n1 + n5 + 4*n2 + n4]; // Nj*K3
     double *abfy = &temp[4*n1 + n5 + 4*n2 + 2*n4]; // Nj*K3
     double *abfz = &temp[4*n1 + n5 + 4*n2 + 3*n4]; // Nj*K3
-    double *tm = &temp[4*n1 + n5 + 4*n2 + 4*n4]; // 4*K3
+    double *tm = &temp[4*n1 + n5 + 4*n2 + 4*n4]; // 12*Nj
 
     angularbasis(abf, abfx, abfy, abfz, rij, tm, pq3, Nj, K3);
 
@@ -1304,9 +1332,9 @@ double EAPOD::peratomenergyforce2(double *fij, double *rij, double *temp,
     }
   }
 
-  double *cb = &bdd[0];
   if (nClusters > 1) {
     e += peratom_environment_descriptors(cb, bd, &temp[4*n1 + n5 + 4*n2], ti);
+    if (pd) for (int k=0; k<nClusters; k++) pd[k] = temp[4*n1 + n5 + 4*n2 + k];
   }
   else {
     e += peratombase_coefficients(cb, bd, ti);
@@ -1927,11 +1955,16 @@ void EAPOD::twobodydescderiv(double *d2, double *dd2, double *rbf, double *rbfx,
 /**
  * @brief Calculates the radial basis functions and their derivatives.
  *
+ * The per-pair distance and cutoff terms are computed first and stored in tmp,
+ * so that the loops over the basis functions run with unit stride over all
+ * neighbors and can be vectorized by the compiler.
+ *
  * @param rbf           Pointer to the array of radial basis functions.
  * @param rbfx          Pointer to the array of derivatives of radial basis functions with respect to x.
  * @param rbfy          Pointer to the array of derivatives of radial basis functions with respect to y.
  * @param rbfz          Pointer to the array of derivatives of radial basis functions with respect to z.
  * @param rij           Pointer to the relative positions of neighboring atoms and atom i.
+ * @param tmp           Pointer to temporary array of size 12*N.
  * @param besselparams  Pointer to the array of Bessel function parameters.
  * @param rin           Minimum distance for radial basis functions.
  * @param rmax          Maximum distance for radial basis functions.
@@ -1940,21 +1973,38 @@ void EAPOD::twobodydescderiv(double *d2, double *dd2, double *rbf, double *rbfx,
  * @param nbesselpars   Number of Bessel function parameters.
  * @param N             Number of neighboring atoms.
  */
-void EAPOD::radialbasis(double *rbf, double *rbfx, double *rbfy, double *rbfz, double *rij, double *besselparams, double rin,
-        double rmax, int besseldegree, int inversedegree, int nbesselpars, int N)
+void EAPOD::radialbasis(double *rbf, double *rbfx, double *rbfy, double *rbfz, double *rij, double *tmp,
+        double *besselparams, double rin, double rmax, int besseldegree, int inversedegree,
+        int nbesselpars, int N)
 {
-  // Loop over all neighboring atoms
+  double *dij = &tmp[0];       // distances
+  double *dr1 = &tmp[N];       // unit vectors
+  double *dr2 = &tmp[2*N];
+  double *dr3 = &tmp[3*N];
+  double *rr = &tmp[4*N];      // dij - rin
+  double *fcut = &tmp[5*N];    // cutoff function
+  double *dfcut = &tmp[6*N];   // derivative of the cutoff function
+  double *f1 = &tmp[7*N];      // fcut/r
+  double *f2 = &tmp[8*N];      // fcut/r^2
+  double *df1 = &tmp[9*N];     // dfcut/r
+  double *xb = &tmp[10*N];     // scaled distance for the current Bessel parameter
+  double *dxb = &tmp[11*N];    // derivative of the scaled distance
+
+  const double expm1 = exp(-1.0);
+
+  // Loop over all neighboring atoms to compute the per-pair terms
   for (int n=0; n<N; n++) {
     double xij1 = rij[0+3*n];
     double xij2 = rij[1+3*n];
     double xij3 = rij[2+3*n];
 
-    double dij = sqrt(xij1*xij1 + xij2*xij2 + xij3*xij3);
-    double dr1 = xij1/dij;
-    double dr2 = xij2/dij;
-    double dr3 = xij3/dij;
+    double d = sqrt(xij1*xij1 + xij2*xij2 + xij3*xij3);
+    dij[n] = d;
+    dr1[n] = xij1/d;
+    dr2[n] = xij2/d;
+    dr3[n] = xij3/d;
 
-    double r = dij - rin;
+    double r = d - rin;
     double y = r/rmax;
     double y2 = y*y;
 
@@ -1965,128 +2015,68 @@ void EAPOD::radialbasis(double *rbf, double *rbfx, double *rbfy, double *rbfz, d
     double y7 = y4*sqrt(y4);
 
     // Calculate the final cutoff function as y6/exp(-1)
-    double fcut = y6/exp(-1.0);
+    double fc = y6/expm1;
 
     // Calculate the derivative of the final cutoff function
-    double dfcut = ((3.0/(rmax*exp(-1.0)))*(y2)*y6*(y*y2 - 1.0))/y7;
+    double dfc = ((3.0/(rmax*expm1))*(y2)*y6*(y*y2 - 1.0))/y7;
 
     // Calculate fcut/r, fcut/r^2, and dfcut/r
-    double f1 = fcut/r;
-    double f2 = f1/r;
-    double df1 = dfcut/r;
+    rr[n] = r;
+    fcut[n] = fc;
+    dfcut[n] = dfc;
+    f1[n] = fc/r;
+    f2[n] = f1[n]/r;
+    df1[n] = dfc/r;
+  }
 
-    double alpha = besselparams[0];
+  // Loop over all Bessel parameters and Bessel degrees
+  for (int p=0; p<nbesselpars; p++) {
+    double alpha = besselparams[p];
     double t1 = (1.0-exp(-alpha));
-    double t2 = exp(-alpha*r/rmax);
-    double x0 =  (1.0 - t2)/t1;
-    double dx0 = (alpha/rmax)*t2/t1;
-
-    if (nbesselpars==1) {
-      for (int i=0; i<besseldegree; i++) {
-        double a = (i+1)*MY_PI;
-        double b = (sqrt(2.0/(rmax))/(i+1));
-        double af1 = a*f1;
-
-        double sinax = sin(a*x0);
-        int nij = n + N*i;
-
-        rbf[nij] = b*f1*sinax;
-
-        double drbfdr = b*(df1*sinax - f2*sinax + af1*cos(a*x0)*dx0);
-        rbfx[nij] = drbfdr*dr1;
-        rbfy[nij] = drbfdr*dr2;
-        rbfz[nij] = drbfdr*dr3;
-      }
+    for (int n=0; n<N; n++) {
+      double t2 = exp(-alpha*rr[n]/rmax);
+      xb[n] = (1.0 - t2)/t1;
+      dxb[n] = (alpha/rmax)*t2/t1;
     }
-    else if (nbesselpars==2) {
-      alpha = besselparams[1];
-      t1 = (1.0-exp(-alpha));
-      t2 = exp(-alpha*r/rmax);
-      double x1 =  (1.0 - t2)/t1;
-      double dx1 = (alpha/rmax)*t2/t1;
-      for (int i=0; i<besseldegree; i++) {
-        double a = (i+1)*MY_PI;
-        double b = (sqrt(2.0/(rmax))/(i+1));
-        double af1 = a*f1;
-
-        double sinax = sin(a*x0);
-        int nij = n + N*i;
 
-        rbf[nij] = b*f1*sinax;
+    for (int i=0; i<besseldegree; i++) {
+      double a = (i+1)*MY_PI;
+      double b = (sqrt(2.0/(rmax))/(i+1));
+      int k = N*i + N*besseldegree*p;
+      for (int n=0; n<N; n++) {
+        double af1 = a*f1[n];
+        double sinax = sin(a*xb[n]);
 
-        double drbfdr = b*(df1*sinax - f2*sinax + af1*cos(a*x0)*dx0);
-        rbfx[nij] = drbfdr*dr1;
-        rbfy[nij] = drbfdr*dr2;
-        rbfz[nij] = drbfdr*dr3;
+        rbf[k + n] = b*f1[n]*sinax;
 
-        sinax = sin(a*x1);
-        nij = n + N*i + N*besseldegree*1;
-        rbf[nij] = b*f1*sinax;
-
-        drbfdr = b*(df1*sinax - f2*sinax + af1*cos(a*x1)*dx1);
-        rbfx[nij] = drbfdr*dr1;
-        rbfy[nij] = drbfdr*dr2;
-        rbfz[nij] = drbfdr*dr3;
-      }
-    }
-    else if (nbesselpars==3) {
-      alpha = besselparams[1];
-      t1 = (1.0-exp(-alpha));
-      t2 = exp(-alpha*r/rmax);
-      double x1 =  (1.0 - t2)/t1;
-      double dx1 = (alpha/rmax)*t2/t1;
-
-      alpha = besselparams[2];
-      t1 = (1.0-exp(-alpha));
-      t2 = exp(-alpha*r/rmax);
-      double x2 =  (1.0 - t2)/t1;
-      double dx2 = (alpha/rmax)*t2/t1;
-      for (int i=0; i<besseldegree; i++) {
-        double a = (i+1)*MY_PI;
-        double b = (sqrt(2.0/(rmax))/(i+1));
-        double af1 = a*f1;
-
-        double sinax = sin(a*x0);
-        int nij = n + N*i;
-
-        rbf[nij] = b*f1*sinax;
-        double drbfdr = b*(df1*sinax - f2*sinax + af1*cos(a*x0)*dx0);
-        rbfx[nij] = drbfdr*dr1;
-        rbfy[nij] = drbfdr*dr2;
-        rbfz[nij] = drbfdr*dr3;
-
-        sinax = sin(a*x1);
-        nij = n + N*i + N*besseldegree*1;
-
-        rbf[nij] = b*f1*sinax;
-        drbfdr = b*(df1*sinax - f2*sinax + af1*cos(a*x1)*dx1);
-        rbfx[nij] = drbfdr*dr1;
-        rbfy[nij] = drbfdr*dr2;
-        rbfz[nij] = drbfdr*dr3;
-
-        sinax = sin(a*x2);
-        nij = n + N*i + N*besseldegree*2;
-        rbf[nij] = b*f1*sinax;
-        drbfdr = b*(df1*sinax - f2*sinax + af1*cos(a*x2)*dx2);
-        rbfx[nij] = drbfdr*dr1;
-        rbfy[nij] = drbfdr*dr2;
-        rbfz[nij] = drbfdr*dr3;
+        double drbfdr = b*(df1[n]*sinax - f2[n]*sinax + af1*cos(a*xb[n])*dxb[n]);
+        rbfx[k + n] = drbfdr*dr1[n];
+        rbfy[k + n] = drbfdr*dr2[n];
+        rbfz[k + n] = drbfdr*dr3[n];
       }
     }
+  }
 
-    // Calculate fcut/dij and dfcut/dij
-    f1 = fcut/dij;
-    for (int i=0; i<inversedegree; i++) {
-      int p = besseldegree*nbesselpars + i;
-      int nij = n + N*p;
-      double a = powint(dij, i+1);
+  // Calculate fcut/dij and the inverse distance functions
+  double *fd = f1;
+  double *dpow = xb;
+  for (int n=0; n<N; n++) {
+    fd[n] = fcut[n]/dij[n];
+    dpow[n] = 1.0;
+  }
+  for (int i=0; i<inversedegree; i++) {
+    int p = besseldegree*nbesselpars + i;
+    int k = N*p;
+    for (int n=0; n<N; n++) {
+      dpow[n] *= dij[n];
+      double a = dpow[n];
 
-      rbf[nij] = fcut/a;
+      rbf[k + n] = fcut[n]/a;
 
-      double drbfdr = (dfcut - (i+1.0)*f1)/a;
-      rbfx[nij] = drbfdr*dr1;
-      rbfy[nij] = drbfdr*dr2;
-      rbfz[nij] = drbfdr*dr3;
+      double drbfdr = (dfcut[n] - (i+1.0)*fd[n])/a;
+      rbfx[k + n] = drbfdr*dr1[n];
+      rbfy[k + n] = drbfdr*dr2[n];
+      rbfz[k + n] = drbfdr*dr3[n];
     }
   }
 }
@@ -2094,28 +2084,27 @@ void EAPOD::radialbasis(double *rbf, double *rbfx, double *rbfy, double *rbfz, d
 /**
  * @brief Calculates the angular basis functions and their derivatives.
  *
+ * The monomials are generated by the recursion abf[n] = abf[m]*u (or v, w)
+ * applied directly to the derivatives w.r.t. x, y, and z. The loop over
+ * neighbors is innermost, so it has unit stride and vectorizes.
+ *
  * @param abf   Pointer to the angular basis functions.
  * @param abfx  Pointer to the derivative of the angular basis functions w.r.t. x.
  * @param abfy  Pointer to the derivative of the angular basis functions w.r.t. y.
  * @param abfz  Pointer to the derivative of the angular basis functions w.r.t. z.
  * @param rij   Pointer to the relative positions of neighboring atoms and atom i.
- * @param tm    Pointer to temporary array.
+ * @param tm    Pointer to temporary array of size 12*N.
  * @param pq    Pointer to array of indices for angular basis functions.
  * @param N     Number of neighboring atoms.
  * @param K     Number of angular basis functions.
  */
 void EAPOD::angularbasis(double *abf, double *abfx, double *abfy, double *abfz, double *rij, double *tm, int *pq, int N, int K)
 {
-  // Initialize temporary arrays
-  double *tmu = &tm[K];
-  double *tmv = &tm[2*K];
-  double *tmw = &tm[3*K];
-
-  // Initialize first angular basis function and its derivatives
-  tm[0] = 1.0;
-  tmu[0] = 0.0;
-  tmv[0] = 0.0;
-  tmw[0] = 0.0;
+  // unit vectors and their derivatives w.r.t. x, y, and z for all neighbors
+  double *uvw[3] = {&tm[0], &tm[N], &tm[2*N]};
+  double *duvw[3][3] = {{&tm[3*N], &tm[4*N], &tm[5*N]},
+                        {&tm[6*N], &tm[7*N], &tm[8*N]},
+                        {&tm[9*N], &tm[10*N], &tm[11*N]}};
 
   // Loop over all neighboring atoms
   for (int j=0; j<N; j++) {
@@ -2134,59 +2123,56 @@ void EAPOD::angularbasis(double *abf, double *abfx, double *abfy, double *abfz,
 
     // Calculate distance between neighboring atoms and unit vectors
     double dij = sqrt(xx + yy + zz);
-    double u = x/dij;
-    double v = y/dij;
-    double w = z/dij;
+    uvw[0][j] = x/dij;
+    uvw[1][j] = y/dij;
+    uvw[2][j] = z/dij;
 
     // Calculate derivatives of unit vectors
     double dij3 = dij*dij*dij;
-    double dudx = (yy+zz)/dij3;
-    double dudy = -xy/dij3;
-    double dudz = -xz/dij3;
+    duvw[0][0][j] = (yy+zz)/dij3;
+    duvw[0][1][j] = -xy/dij3;
+    duvw[0][2][j] = -xz/dij3;
 
-    double dvdx = -xy/dij3;
-    double dvdy = (xx+zz)/dij3;
-    double dvdz = -yz/dij3;
+    duvw[1][0][j] = -xy/dij3;
+    duvw[1][1][j] = (xx+zz)/dij3;
+    duvw[1][2][j] = -yz/dij3;
 
-    double dwdx = -xz/dij3;
-    double dwdy = -yz/dij3;
-    double dwdz = (xx+yy)/dij3;
+    duvw[2][0][j] = -xz/dij3;
+    duvw[2][1][j] = -yz/dij3;
+    duvw[2][2][j] = (xx+yy)/dij3;
 
     // Initialize first angular basis function and its derivatives
-    abf[j] = tm[0];
+    abf[j] = 1.0;
     abfx[j] = 0.0;
     abfy[j] = 0.0;
     abfz[j] = 0.0;
+  }
 
-    // Loop over all angular basis functions
-    for (int n=1; n<K; n++) {
-      // Get indices for angular basis function
-      int m = pq[n]-1;
-      int d = pq[n + K];
-
-      // Calculate angular basis function and its derivatives using recursion relation
-      if (d==1) {
-        tm[n] = tm[m]*u;
-        tmu[n] = tmu[m]*u + tm[m];
-        tmv[n] = tmv[m]*u;
-        tmw[n] = tmw[m]*u;
-      }
-      else if (d==2) {
-        tm[n] = tm[m]*v;
-        tmu[n] = tmu[m]*v;
-        tmv[n] = tmv[m]*v + tm[m];
-        tmw[n] = tmw[m]*v;
-      }
-      else if (d==3) {
-        tm[n] = tm[m]*w;
-        tmu[n] = tmu[m]*w;
-        tmv[n] = tmv[m]*w;
-        tmw[n] = tmw[m]*w + tm[m];
-      }
-      abf[j + N*n] = tm[n];
-      abfx[j + N*n] = tmu[n]*dudx + tmv[n]*dvdx + tmw[n]*dwdx;
-      abfy[j + N*n] = tmu[n]*dudy + tmv[n]*dvdy + tmw[n]*dwdy;
-      abfz[j + N*n] = tmu[n]*dudz + tmv[n]*dvdz + tmw[n]*dwdz;
+  // Loop over all angular basis functions
+  for (int n=1; n<K; n++) {
+    // Get indices for angular basis function
+    int m = pq[n]-1;
+    int d = pq[n + K]-1;
+
+    const double *a = &uvw[d][0];
+    const double *ax = &duvw[d][0][0];
+    const double *ay = &duvw[d][1][0];
+    const double *az = &duvw[d][2][0];
+    const double *tm0 = &abf[N*m];
+    const double *tmx = &abfx[N*m];
+    const double *tmy = &abfy[N*m];
+    const double *tmz = &abfz[N*m];
+    double *tn0 = &abf[N*n];
+    double *tnx = &abfx[N*n];
+    double *tny = &abfy[N*n];
+    double *tnz = &abfz[N*n];
+
+    // Calculate angular basis function and its derivatives using recursion relation
+    for (int j=0; j<N; j++) {
+      tnx[j] = tmx[j]*a[j] + tm0[j]*ax[j];
+      tny[j] = tmy[j]*a[j] + tm0[j]*ay[j];
+      tnz[j] = tmz[j]*a[j] + tm0[j]*az[j];
+      tn0[j] = tm0[j]*a[j];
     }
   }
 }
@@ -2597,11 +2583,11 @@ int EAPOD::estimate_temp_memory(int Nj)
   // rbf, rbfx, rbfy, rbfz
   int nmax4 = 4*Nj*nrbfmax;
 
-  // rbft, rbfxt, rbfyt, rbfzt
-  int nmax5 = 4*Nj*ns;
+  // rbft, rbfxt, rbfyt, rbfzt, and per-pair radial terms
+  int nmax5 = 4*Nj*ns + 12*Nj;
 
-  // abf, abfx, abfy, abfz
-  int nmax6 = 4*(Nj+1)*Kmax;
+  // abf, abfx, abfy, abfz, and per-pair unit vectors
+  int nmax6 = 4*(Nj+1)*Kmax + 12*Nj;
 
   // Determine the maximum amount of memory needed for U, Ux, Uy, Uz, sumU, cU, rbf, rbfx, rbfy, rbfz, abf, abfx, abfy, abfz
   int nmax7 = (nmax5 > nmax6) ? nmax5 : nmax6;
@@ -2620,6 +2606,14 @@ int EAPOD::estimate_temp_memory(int Nj)
   return ndblmem;
 }
 
+int EAPOD::estimate_coeff_memory()
+{
+  // cb for the base descriptors followed by the force coefficients of the 3- and 4-body terms
+  int Knrbf34 = (K3*nrbf3 > K4*nrbf4) ? K3*nrbf3 : K4*nrbf4;
+  int ncb = nl2 + nl3 + nl4 + nelements*Knrbf34;
+  return (ncb > Mdesc) ? ncb : Mdesc;
+}
+
 void EAPOD::allocate_temp_memory(int Nj)
 {
   estimate_temp_memory(Nj);
@@ -63,7 +63,7 @@ class EAPOD : protected Pointers {
   void myneighbors(double *rij, double *x, int *ai, int *aj, int *ti, int *tj, int *jlist,
                    int *pairnumsum, int *atomtype, int *alist, int i);
 
-  void radialbasis(double *rbf, double *rbfx, double *rbfy, double *rbfz, double *rij,
+  void radialbasis(double *rbf, double *rbfx, double *rbfy, double *rbfz, double *rij, double *tmp,
                    double *besselparams, double rin, double rmax, int besseldegree,
                    int inversedegree, int nbesselpars, int N);
 
@@ -218,6 +218,9 @@ class EAPOD : protected Pointers {
 
   double peratomenergyforce(double *fij, double *rij, double *temp, int *ti, int *tj, int Nj);
   double peratomenergyforce2(double *fij, double *rij, double *temp, int *ti, int *tj, int Nj);
+  double peratomenergyforce2(double *fij, double *rij, double *temp, double *bd1, double *cb1,
+                             double *pd1, int *ti, int *tj, int Nj);
+  int estimate_coeff_memory();
 
   double energyforce(double *force, double *x, int *atomtype, int *alist, int *jlist,
                      int *pairnumsum, int natom);
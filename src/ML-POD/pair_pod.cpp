@@ -27,6 +27,7 @@
 #include "neigh_list.h"
 #include "neighbor.h"
 #include "tokenizer.h"
+#include "update.h"
 
 #include <cmath>
 #include <cstring>
@@ -101,6 +102,11 @@ PairPOD::PairPOD(LAMMPS *lmp) : Pair(lmp), fastpodptr(nullptr)
   ind44l = nullptr;
   ind44r = nullptr;
   elemindex = nullptr;
+
+  desc_flag = 0;
+  desc_nmax = 0;
+  desc_step = -1;
+  desc = nullptr;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -150,6 +156,7 @@ PairPOD::~PairPOD()
   memory->destroy(ind44l);
   memory->destroy(ind44r);
   memory->destroy(elemindex);
+  memory->destroy(desc);
 
   delete fastpodptr;
 
@@ -185,6 +192,8 @@ void PairPOD::compute(int eflag, int vflag)
   double rcutsq = rcut*rcut;
   double evdwl = 0.0;
 
+  if (desc_flag) grow_descriptors();
+
   int blockMode = 0;
   if (blockMode==0) {
   for (int ii = 0; ii < inum; ii++) {
@@ -207,7 +216,9 @@ void PairPOD::compute(int eflag, int vflag)
     int *tj1 = &fastpodptr->tmpint[3*nijmax];
     lammpsNeighborList(rij1, ai1, aj1, ti1, tj1, x, firstneigh, type, map, numneigh, rcutsq, i);
 
-    evdwl = fastpodptr->peratomenergyforce2(fij1, rij1, tmp, ti1, tj1, nij);
+    evdwl = fastpodptr->peratomenergyforce2(fij1, rij1, tmp, fastpodptr->bd, fastpodptr->bdd,
+                                            fastpodptr->pd, ti1, tj1, nij);
+    if (desc_flag) store_descriptors(i, fastpodptr->bd, fastpodptr->pd, nij);
 
     // tally atomic energy to global energy
     ev_tally_full(i,2.0*evdwl,0.0,0.0,0.0,0.0,0.0);
@@ -268,6 +279,7 @@ void PairPOD::compute(int eflag, int vflag)
   }
 
   if (vflag_fdotr) virial_fdotr_compute();
+  if (desc_flag) desc_step = update->ntimestep;
 }
 
 /* ----------------------------------------------------------------------
@@ -296,9 +308,10 @@ void PairPOD::coeff(int narg, char **arg)
 
   if (narg < 5) utils::missing_cmd_args(FLERR, "pair_coeff", error);
 
-  std::string pod_file = std::string(arg[2]);      // pod input file
-  std::string coeff_file = std::string(arg[3]);    // coefficient input file
+  pod_file = std::string(arg[2]);      // pod input file
+  coeff_file = std::string(arg[3]);    // coefficient input file
   map_element2type(narg - 4, arg + 4);
+  desc_step = -1;
 
   delete fastpodptr;
   fastpodptr = new EAPOD(lmp, pod_file, coeff_file);
@@ -355,9 +368,68 @@ void PairPOD::allocate()
 double PairPOD::memory_usage()
 {
   double bytes = Pair::memory_usage();
+  if (desc) bytes += (double) desc_nmax * fastpodptr->Mdesc * fastpodptr->nClusters * sizeof(double);
   return bytes;
 }
 
+/* ----------------------------------------------------------------------
+   enable caching of per-atom descriptors for a compute that uses the
+   same POD model and element mapping as this pair style.
+   returns true if the descriptors can be shared.
+------------------------------------------------------------------------- */
+
+bool PairPOD::share_descriptors(const std::string &pod, const std::string &coeff, const int *cmap)
+{
+  if (!fastpodptr || (pod != pod_file) || (coeff != coeff_file)) return false;
+  for (int i = 1; i <= atom->ntypes; i++)
+    if (cmap[i] != map[i]) return false;
+
+  desc_flag = 1;
+  desc_step = -1;
+  return true;
+}
+
+/* ----------------------------------------------------------------------
+   return per-atom descriptors if they were computed on the given step
+------------------------------------------------------------------------- */
+
+double **PairPOD::get_descriptors(bigint ntimestep)
+{
+  if (desc_flag && (desc_step == ntimestep)) return desc;
+  return nullptr;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairPOD::grow_descriptors()
+{
+  if (atom->nmax > desc_nmax) {
+    memory->destroy(desc);
+    desc_nmax = atom->nmax;
+    memory->create(desc, desc_nmax, fastpodptr->Mdesc * fastpodptr->nClusters, "pair:desc");
+  }
+}
+
+/* ----------------------------------------------------------------------
+   store the descriptors of atom i in the same layout as compute pod/atom
+------------------------------------------------------------------------- */
+
+void PairPOD::store_descriptors(int i, const double *bd1, const double *pd1, int Nj)
+{
+  const int Mdesc1 = fastpodptr->Mdesc;
+  const int nClusters1 = fastpodptr->nClusters;
+  double *desci = desc[i];
+
+  if (Nj == 0) {
+    for (int m = 0; m < Mdesc1 * nClusters1; m++) desci[m] = 0.0;
+  } else if (nClusters1 > 1) {
+    for (int k = 0; k < nClusters1; k++)
+      for (int m = 0; m < Mdesc1; m++) desci[m + Mdesc1 * k] = pd1[k] * bd1[m];
+  } else {
+    for (int m = 0; m < Mdesc1; m++) desci[m] = bd1[m];
+  }
+}
+
 void PairPOD::lammpsNeighborList(double *rij1, int *ai1, int *aj1, int *ti1, int *tj1,
                                double **x, int **firstneigh, int *atomtypes, int *map,
                                int *numneigh, double rcutsq, int gi)
@@ -87,6 +87,9 @@ class PairPOD : public Pair {
   void fourbody_forcecoeff(double *fb4, double *cb4, int Ni);
   void allbody_forces(double *fij, double *forcecoeff, int Nij);
 
+  bool share_descriptors(const std::string &pod, const std::string &coeff, const int *cmap);
+  double **get_descriptors(bigint ntimestep);
+
   void savematrix2binfile(std::string filename, double *A, int nrows, int ncols);
   void saveintmatrix2binfile(std::string filename, int *A, int nrows, int ncols);
   void savedatafordebugging();
@@ -96,6 +99,8 @@ class PairPOD : public Pair {
   virtual void allocate();
   void grow_atoms(int Ni);
   void grow_pairs(int Nij);
+  void grow_descriptors();
+  void store_descriptors(int i, const double *bd1, const double *pd1, int Nj);
 
   int atomBlockSize;      // size of each atom block
   int nAtomBlocks;        // number of atoms blocks
@@ -167,6 +172,15 @@ class PairPOD : public Pair {
   int *elemindex;
 
   bool peratom_warn;    // print warning about missing per-atom energies or stresses
+
+  // per-atom descriptors cached for compute pod/atom
+
+  std::string pod_file;      // pod input file
+  std::string coeff_file;    // coefficient input file
+  int desc_flag;             // 1 if per-atom descriptors are cached during compute()
+  int desc_nmax;             // allocated rows of desc
+  bigint desc_step;          // timestep of the cached descriptors
+  double **desc;             // per-atom descriptors nmax x (Mdesc*nClusters)
 };
 
 }    // namespace LAMMPS_NS
@@ -0,0 +1,257 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "fix_hyper_local_omp.h"
+
+#include "atom.h"
+#include "domain.h"
+#include "memory.h"
+#include "neigh_list.h"
+
+#include <cmath>
+
+#include "omp_compat.h"
+
+using namespace LAMMPS_NS;
+
+static constexpr double BIG = 1.0e20;
+
+/* ---------------------------------------------------------------------- */
+
+FixHyperLocalOMP::FixHyperLocalOMP(LAMMPS *lmp, int narg, char **arg) :
+  FixHyperLocal(lmp, narg, arg), bondfirst(nullptr), bstrain(nullptr),
+  maxbondfirst(0), maxbstrain(0)
+{
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixHyperLocalOMP::~FixHyperLocalOMP()
+{
+  memory->destroy(bondfirst);
+  memory->destroy(bstrain);
+}
+
+/* ----------------------------------------------------------------------
+   also store offset of first bond of each old owned atom
+   so bond_strain() can loop over old atoms in parallel
+------------------------------------------------------------------------- */
+
+void FixHyperLocalOMP::build_bond_list(int natom)
+{
+  FixHyperLocal::build_bond_list(natom);
+
+  if (nlocal_old > maxbondfirst) {
+    memory->destroy(bondfirst);
+    maxbondfirst = maxlocal;
+    memory->create(bondfirst,maxbondfirst,"hyper/local/omp:bondfirst");
+  }
+  if (nblocal > maxbstrain) {
+    memory->destroy(bstrain);
+    maxbstrain = maxbond;
+    memory->create(bstrain,maxbstrain,"hyper/local/omp:bstrain");
+  }
+
+  int m = 0;
+  for (int iold = 0; iold < nlocal_old; iold++) {
+    bondfirst[iold] = m;
+    m += numbond[iold];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   stage 1 of pre_reverse(), threaded over old owned atoms
+   all bonds of old atom I share its current index, so maxhalf and
+     maxhalfstrain are private to a thread
+   J atoms are shared between threads, so bond strains are stored
+     and tallied into maxstrain afterwards
+------------------------------------------------------------------------- */
+
+void FixHyperLocalOMP::bond_strain()
+{
+  const auto * _noalias const x = atom->x;
+  double bondlen = maxbondlen;
+
+#if defined(_OPENMP)
+#pragma omp parallel for LMP_DEFAULT_NONE reduction(max:bondlen) schedule(static)
+#endif
+  for (int iold = 0; iold < nlocal_old; iold++) {
+    double halfstrain = 0.0;
+    int ijhalf = -1;
+    const int mfrom = bondfirst[iold];
+    const int mto = mfrom + numbond[iold];
+
+    for (int m = mfrom; m < mto; m++) {
+      const int i = blist[m].i;
+      const int j = blist[m].j;
+      const double delx = x[i][0] - x[j][0];
+      const double dely = x[i][1] - x[j][1];
+      const double delz = x[i][2] - x[j][2];
+      const double r = sqrt(delx*delx + dely*dely + delz*delz);
+      bondlen = MAX(r,bondlen);
+      const double r0 = blist[m].r0;
+      const double estrain = fabs(r-r0) / r0;
+      bstrain[m] = estrain;
+      if (estrain > halfstrain) {
+        halfstrain = estrain;
+        ijhalf = m;
+      }
+    }
+
+    maxhalf[iold] = ijhalf;
+    maxhalfstrain[iold] = halfstrain;
+  }
+
+  maxbondlen = bondlen;
+
+  for (int m = 0; m < nblocal; m++) {
+    const int i = blist[m].i;
+    const int j = blist[m].j;
+    maxstrain[i] = MAX(maxstrain[i],bstrain[m]);
+    maxstrain[j] = MAX(maxstrain[j],bstrain[m]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   stage 2 of pre_reverse(), threaded over owned atoms of Dcut neigh list
+   each I only writes its own eligible and maxstrain_domain values
+------------------------------------------------------------------------- */
+
+void FixHyperLocalOMP::domain_strain(double &rmax, double &rmaxbig)
+{
+  const auto * _noalias const x = atom->x;
+  const int nlocal = atom->nlocal;
+
+  const int inum = listfull->inum;
+  const int * _noalias const ilist = listfull->ilist;
+  const int * _noalias const numneigh = listfull->numneigh;
+  int ** const firstneigh = listfull->firstneigh;
+
+  const double * const sublo = domain->sublo;
+  const double * const subhi = domain->subhi;
+
+  double rmax_thr = rmax;
+  double rmaxbig_thr = rmaxbig;
+
+#if defined(_OPENMP)
+#pragma omp parallel for LMP_DEFAULT_NONE reduction(max:rmax_thr,rmaxbig_thr) schedule(dynamic,64)
+#endif
+  for (int ii = 0; ii < inum; ii++) {
+    const int iold = ilist[ii];
+    const int i = old2now[iold];
+
+    if (maxstrain[i] == 0.0) {
+      eligible[iold] = 0;
+      continue;
+    }
+
+    const int * const jlist = firstneigh[iold];
+    const int jnum = numneigh[iold];
+
+    const double selfstrain = maxstrain[i];
+    double emax = selfstrain;
+    int ncount = 0;
+
+    for (int jj = 0; jj < jnum; jj++) {
+      const int j = old2now[jlist[jj]];
+
+      // special case for missing (drifted) J atom
+
+      if (j < 0) {
+        emax = MAX(emax,qfactor);
+        if (selfstrain == qfactor) ncount++;
+        continue;
+      }
+
+      emax = MAX(emax,maxstrain[j]);
+      if (selfstrain == maxstrain[j]) ncount++;
+
+      if (checkghost && j >= nlocal) {
+        for (int k = 0; k < 3; k++) {
+          double dist = 0.0;
+          if (x[j][k] < sublo[k]) dist = sublo[k]-x[j][k];
+          else if (x[j][k] > subhi[k]) dist = x[j][k]-subhi[k];
+          rmaxbig_thr = MAX(rmaxbig_thr,dist);
+          if (maxstrain[j] < qfactor) rmax_thr = MAX(rmax_thr,dist);
+        }
+      }
+    }
+
+    if (maxhalfstrain[iold] < selfstrain) eligible[iold] = 0;
+    if (selfstrain < emax) eligible[iold] = 0;
+    else if (ncount > 1) {
+      eligible[iold] = 0;
+      emax = -emax;
+    }
+    maxstrain_domain[i] = emax;
+  }
+
+  rmax = rmax_thr;
+  rmaxbig = rmaxbig_thr;
+}
+
+/* ----------------------------------------------------------------------
+   stage 5 of pre_reverse(), threaded over owned bonds
+   each bond coeff is updated independently
+------------------------------------------------------------------------- */
+
+void FixHyperLocalOMP::boostostat(double &sumcoeff_me, double &sumboost_me)
+{
+  double sumcoeff = 0.0;
+  double sumboost = 0.0;
+  double mincoeff = BIG;
+  double maxcoeff = 0.0;
+
+#if defined(_OPENMP)
+#pragma omp parallel for LMP_DEFAULT_NONE reduction(+:sumcoeff,sumboost) reduction(min:mincoeff) reduction(max:maxcoeff) schedule(static)
+#endif
+  for (int m = 0; m < nblocal; m++) {
+    const double emax = MAX(maxstrain_domain[blist[m].i],maxstrain_domain[blist[m].j]);
+    double vbias = 0.0;
+    if (emax < qfactor) vbias = vmax * (1.0 - emax*emax*invqfactorsq);
+
+    const double boost_domain = exp(beta * biascoeff[m]*vbias);
+    double bc = biascoeff[m] - alpha*invvmax * (boost_domain-boost_target) / boost_target;
+
+    // enforce biascoeff bounds
+    // min value must always be >= 0.0
+
+    bc = MAX(bc,0.0);
+    if (boundflag) {
+      bc = MAX(bc,bound_lower);
+      bc = MIN(bc,bound_upper);
+    }
+    biascoeff[m] = bc;
+
+    sumcoeff += bc;
+    mincoeff = MIN(mincoeff,bc);
+    maxcoeff = MAX(maxcoeff,bc);
+    sumboost += boost_domain;
+  }
+
+  sumcoeff_me += sumcoeff;
+  sumboost_me += sumboost;
+  minbiascoeff = mincoeff;
+  maxbiascoeff = maxcoeff;
+}
+
+/* ---------------------------------------------------------------------- */
+
+double FixHyperLocalOMP::memory_usage()
+{
+  double bytes = FixHyperLocal::memory_usage();
+  bytes += (double)maxbondfirst * sizeof(int);
+  bytes += (double)maxbstrain * sizeof(double);
+  return bytes;
+}
@@ -0,0 +1,49 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+// clang-format off
+FixStyle(hyper/local/omp,FixHyperLocalOMP);
+// clang-format on
+#else
+
+#ifndef LMP_FIX_HYPER_LOCAL_OMP_H
+#define LMP_FIX_HYPER_LOCAL_OMP_H
+
+#include "fix_hyper_local.h"
+
+namespace LAMMPS_NS {
+
+class FixHyperLocalOMP : public FixHyperLocal {
+ public:
+  FixHyperLocalOMP(class LAMMPS *, int, char **);
+  ~FixHyperLocalOMP() override;
+
+  void build_bond_list(int) override;
+  double memory_usage() override;
+
+ protected:
+  int *bondfirst;      // index in blist of first bond of each old owned atom
+  double *bstrain;     // abs value strain of each owned bond on this step
+  int maxbondfirst;    // allocated size of bondfirst
+  int maxbstrain;      // allocated size of bstrain
+
+  void bond_strain() override;
+  void domain_strain(double &, double &) override;
+  void boostostat(double &, double &) override;
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
@@ -84,6 +84,9 @@ void FixQEqReaxFFOMP::post_constructor()
       s_hist[i][j] = t_hist[i][j] = 0;
 
   pertype_parameters(pertype_option);
+  if (dual_enabled && ((solver != SOLVER_STANDARD) || (precond != PRECOND_JACOBI)))
+    error->all(FLERR,"Fix {} dual keyword is not compatible with solver and precond keywords",
+               style);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -146,6 +149,14 @@ void FixQEqReaxFFOMP::init()
 
 void FixQEqReaxFFOMP::compute_H()
 {
+  // with reuse, the pattern is set up serially after neighbor list builds
+  // and the values are refreshed by the threaded update_H()
+
+  if (reuse_flag) {
+    FixQEqReaxFF::compute_H();
+    return;
+  }
+
   double SMALL = 0.0001;
 
   int *type = atom->type;
@@ -155,9 +166,8 @@ void FixQEqReaxFFOMP::compute_H()
 
   int ai, num_nbrs;
 
-  // sumscan of the number of neighbors per atom to determine the offsets
-  // most likely, we are overallocating. desirable to work on this part
-  // to reduce the memory footprint of the far_nbrs list.
+  // sumscan of the number of neighbors per atom to determine the offsets,
+  // so threads can fill in rows independently
 
   num_nbrs = 0;
 
@@ -167,6 +177,7 @@ void FixQEqReaxFFOMP::compute_H()
     num_nbrs += numneigh[ai];
   }
   m_fill = num_nbrs;
+  grow_matrix(m_fill);
 
   // fill in the H matrix
 
@@ -191,7 +202,7 @@ void FixQEqReaxFFOMP::compute_H()
         mfill = H.firstnbr[i];
 
         for (int jj = 0; jj < jnum; jj++) {
-          int j = jlist[jj];
+          int j = jlist[jj] & NEIGHMASK;
 
           dx = x[j][0] - x[i][0];
           dy = x[j][1] - x[i][1];
@@ -222,10 +233,46 @@ void FixQEqReaxFFOMP::compute_H()
       }
     }
   } // omp
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixQEqReaxFFOMP::update_H()
+{
+  const int *type = atom->type;
+  const int *mask = atom->mask;
+  double **x = atom->x;
+  const double swbsq = SQR(swb);
 
-  if (m_fill >= H.m)
-    error->all(FLERR,"Fix qeq/reaxff: H matrix size has been exceeded: m_fill={} H.m={}\n",
-               m_fill, H.m);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(guided) default(shared)
+#endif
+  for (int ii = 0; ii < nn; ii++) {
+    const int i = ilist[ii];
+    if (mask[i] & groupbit) {
+      const double *shldi = shld[type[i]];
+      int mfill = H.firstnbr[i];
+
+      for (int itr_j = Hc.firstnbr[i]; itr_j < Hc.firstnbr[i] + Hc.numnbrs[i]; itr_j++) {
+        const int j = Hc.jlist[itr_j];
+        const double dx = x[j][0] - x[i][0];
+        const double dy = x[j][1] - x[i][1];
+        const double dz = x[j][2] - x[i][2];
+        const double r_sqr = SQR(dx) + SQR(dy) + SQR(dz);
+        if (r_sqr > swbsq) continue;
+
+        const double r = sqrt(r_sqr);
+        if (fabs(r - Hc_dist[itr_j]) > reuse_tol) {
+          Hc_dist[itr_j] = r;
+          Hc.val[itr_j] = calculate_H(r, shldi[type[j]]);
+        }
+        H.jlist[mfill] = j;
+        H.val[mfill] = Hc.val[itr_j];
+        mfill++;
+      }
+      H.numnbrs[i] = mfill - H.firstnbr[i];
+    }
+  }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -270,12 +317,13 @@ void FixQEqReaxFFOMP::pre_force(int /* vflag */)
   // need to be atom->nmax in length
 
   if (atom->nmax > nmax) reallocate_storage();
-  if (atom->nlocal > n_cap*DANGER_ZONE || m_fill > m_cap*DANGER_ZONE)
+  if (atom->nlocal > n_cap*DANGER_ZONE)
     reallocate_matrix();
 
   if (efield) get_chi_field();
 
   init_matvec();
+  setup_precond();
 
   if (dual_enabled) {
     matvecs = dual_CG(b_s, b_t, s, t);
@@ -368,6 +416,12 @@ void FixQEqReaxFFOMP::init_matvec()
 
 int FixQEqReaxFFOMP::CG(double *b, double *x)
 {
+  // the pipelined solver and the incomplete Cholesky preconditioner use
+  // the serial implementation with the threaded matrix-vector product
+
+  if ((solver != SOLVER_STANDARD) || (precond != PRECOND_JACOBI))
+    return FixQEqReaxFF::CG(b, x);
+
   int  i;
   double alpha, beta, b_norm;
   double sig_old, sig_new;
@@ -47,6 +47,7 @@ class FixQEqReaxFFOMP : public FixQEqReaxFF {
   void deallocate_storage() override;
   void init_matvec() override;
   void compute_H() override;
+  void update_H() override;
 
   int CG(double *, double *) override;
   void sparse_matvec(sparse_matrix *, double *, double *) override;
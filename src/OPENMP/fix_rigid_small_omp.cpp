@@ -25,6 +25,7 @@
 #include "domain.h"
 #include "math_const.h"
 #include "math_extra.h"
+#include "memory.h"
 #include "rigid_const.h"
 
 #include <cmath>
@@ -47,6 +48,81 @@ typedef struct {
 // clang-format off
 /* ---------------------------------------------------------------------- */
 
+FixRigidSmallOMP::FixRigidSmallOMP(LAMMPS *lmp, int narg, char **arg) :
+  FixRigidSmall(lmp, narg, arg), bodyatom(nullptr), bodyfirst(nullptr), nbodyatom(0),
+  maxbodyatom(0), maxbodyfirst(0), sort_stale(1), partial_body(nullptr),
+  partial_sum(nullptr), maxpartial(0)
+{
+  centroidstressflag = CENTROID_NOTAVAIL;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixRigidSmallOMP::~FixRigidSmallOMP()
+{
+  memory->destroy(bodyatom);
+  memory->destroy(bodyfirst);
+  memory->destroy(partial_body);
+  memory->destroy(partial_sum);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixRigidSmallOMP::setup_pre_neighbor()
+{
+  FixRigidSmall::setup_pre_neighbor();
+  sort_stale = 1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixRigidSmallOMP::pre_neighbor()
+{
+  FixRigidSmall::pre_neighbor();
+  sort_stale = 1;
+}
+
+/* ----------------------------------------------------------------------
+   group owned atoms by the (owned or ghost) body they belong to
+   atom2body only changes on reneighboring steps
+------------------------------------------------------------------------- */
+
+void FixRigidSmallOMP::sort_body_atoms()
+{
+  const int nlocal = atom->nlocal;
+  const int nall_body = nlocal_body + nghost_body;
+
+  if (nlocal > maxbodyatom) {
+    maxbodyatom = atom->nmax;
+    memory->destroy(bodyatom);
+    memory->create(bodyatom,maxbodyatom,"rigid/small/omp:bodyatom");
+  }
+  if (nall_body+1 > maxbodyfirst) {
+    maxbodyfirst = nmax_body+1;
+    memory->destroy(bodyfirst);
+    memory->create(bodyfirst,maxbodyfirst,"rigid/small/omp:bodyfirst");
+  }
+
+  for (int ibody = 0; ibody <= nall_body; ibody++) bodyfirst[ibody] = 0;
+  for (int i = 0; i < nlocal; i++)
+    if (atom2body[i] >= 0) bodyfirst[atom2body[i]+1]++;
+  for (int ibody = 0; ibody < nall_body; ibody++)
+    bodyfirst[ibody+1] += bodyfirst[ibody];
+  nbodyatom = bodyfirst[nall_body];
+
+  // bodyfirst is used as insertion pointer and shifted back afterwards
+
+  for (int i = 0; i < nlocal; i++)
+    if (atom2body[i] >= 0) bodyatom[bodyfirst[atom2body[i]]++] = i;
+  for (int ibody = nall_body; ibody > 0; ibody--)
+    bodyfirst[ibody] = bodyfirst[ibody-1];
+  bodyfirst[0] = 0;
+
+  sort_stale = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
 void FixRigidSmallOMP::initial_integrate(int vflag)
 {
 
@@ -137,7 +213,6 @@ void FixRigidSmallOMP::compute_forces_and_torques()
   double * const * _noalias const x = atom->x;
   const auto * _noalias const f = (dbl3_t *) atom->f[0];
   const double * const * const torque_one = atom->torque;
-  const int nlocal = atom->nlocal;
 
 #if defined(_OPENMP)
 #pragma omp parallel for LMP_DEFAULT_NONE schedule(static)
@@ -150,15 +225,29 @@ void FixRigidSmallOMP::compute_forces_and_torques()
   }
 
   // sum over atoms to get force and torque on rigid body
-  // we likely have a large number of rigid objects with only a
-  // a few atoms each. so we loop over all atoms for all threads
-  // and then each thread only processes some bodies.
+  // atoms are grouped by body and split into equal ranges per thread,
+  // so the atoms of a large body are shared between threads.
+  // bodies complete within a range are summed directly, the first and
+  // last body of each range are summed per thread and added afterwards.
+
+  if (sort_stale) sort_body_atoms();
 
 #if defined(_OPENMP)
   const int nthreads=comm->nthreads;
-#pragma omp parallel LMP_DEFAULT_NONE
 #else
   const int nthreads=1;
+#endif
+
+  if (2*nthreads > maxpartial) {
+    maxpartial = 2*nthreads;
+    memory->destroy(partial_body);
+    memory->destroy(partial_sum);
+    memory->create(partial_body,maxpartial,"rigid/small/omp:partial_body");
+    memory->create(partial_sum,maxpartial,6,"rigid/small/omp:partial_sum");
+  }
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE
 #endif
   {
 #if defined(_OPENMP)
@@ -166,40 +255,77 @@ void FixRigidSmallOMP::compute_forces_and_torques()
 #else
     const int tid = 0;
 #endif
+    const int ifrom = (int) ((bigint) nbodyatom * tid / nthreads);
+    const int ito = (int) ((bigint) nbodyatom * (tid+1) / nthreads);
+
+    partial_body[2*tid] = partial_body[2*tid+1] = -1;
+
+    int k = ifrom;
+    while (k < ito) {
+      const int ibody = atom2body[bodyatom[k]];
+      const int kend = MIN(bodyfirst[ibody+1],ito);
+      const double * _noalias const xcm = body[ibody].xcm;
+      double sum[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
+      for (; k < kend; k++) {
+        const int i = bodyatom[k];
+        double unwrap[3];
+        domain->unmap(x[i],xcmimage[i],unwrap);
+
+        const double dx = unwrap[0] - xcm[0];
+        const double dy = unwrap[1] - xcm[1];
+        const double dz = unwrap[2] - xcm[2];
+
+        sum[0] += f[i].x;
+        sum[1] += f[i].y;
+        sum[2] += f[i].z;
+
+        sum[3] += dy*f[i].z - dz*f[i].y;
+        sum[4] += dz*f[i].x - dx*f[i].z;
+        sum[5] += dx*f[i].y - dy*f[i].x;
+
+        if (extended && (eflags[i] & TORQUE)) {
+          sum[3] += torque_one[i][0];
+          sum[4] += torque_one[i][1];
+          sum[5] += torque_one[i][2];
+        }
+      }
 
-    for (int i = 0; i < nlocal; i++) {
-      int ibody = atom2body[i];
-      if ((ibody < 0) || (ibody % nthreads != tid)) continue;
-
-      Body &b = body[ibody];
-
-      double unwrap[3];
-      domain->unmap(x[i],xcmimage[i],unwrap);
-
-      double * _noalias const fcm = b.fcm;
-      double * _noalias const xcm = b.xcm;
-      double * _noalias const tcm = b.torque;
-
-      const double dx = unwrap[0] - xcm[0];
-      const double dy = unwrap[1] - xcm[1];
-      const double dz = unwrap[2] - xcm[2];
-
-      fcm[0] += f[i].x;
-      fcm[1] += f[i].y;
-      fcm[2] += f[i].z;
-
-      tcm[0] += dy*f[i].z - dz*f[i].y;
-      tcm[1] += dz*f[i].x - dx*f[i].z;
-      tcm[2] += dx*f[i].y - dy*f[i].x;
-
-      if (extended && (eflags[i] & TORQUE)) {
-        tcm[0] += torque_one[i][0];
-        tcm[1] += torque_one[i][1];
-        tcm[2] += torque_one[i][2];
+      // a body starting before ifrom can only be the first in the range
+
+      int islot = -1;
+      if (bodyfirst[ibody] < ifrom) islot = 2*tid;
+      else if (bodyfirst[ibody+1] > ito) islot = 2*tid+1;
+
+      if (islot < 0) {
+        double * _noalias const fcm = body[ibody].fcm;
+        double * _noalias const tcm = body[ibody].torque;
+        fcm[0] = sum[0];
+        fcm[1] = sum[1];
+        fcm[2] = sum[2];
+        tcm[0] = sum[3];
+        tcm[1] = sum[4];
+        tcm[2] = sum[5];
+      } else {
+        partial_body[islot] = ibody;
+        for (int m = 0; m < 6; m++) partial_sum[islot][m] = sum[m];
       }
     }
   } // end of omp parallel region
 
+  for (int islot = 0; islot < 2*nthreads; islot++) {
+    const int ibody = partial_body[islot];
+    if (ibody < 0) continue;
+    double * _noalias const fcm = body[ibody].fcm;
+    double * _noalias const tcm = body[ibody].torque;
+    fcm[0] += partial_sum[islot][0];
+    fcm[1] += partial_sum[islot][1];
+    fcm[2] += partial_sum[islot][2];
+    tcm[0] += partial_sum[islot][3];
+    tcm[1] += partial_sum[islot][4];
+    tcm[2] += partial_sum[islot][5];
+  }
+
   // reverse communicate fcm, torque of all bodies
 
   commflag = FORCE_TORQUE;
@@ -665,3 +791,13 @@ void FixRigidSmallOMP::set_v_thr()
     }
   }
 }
+
+/* ---------------------------------------------------------------------- */
+
+double FixRigidSmallOMP::memory_usage()
+{
+  double bytes = FixRigidSmall::memory_usage();
+  bytes += (double)(maxbodyatom + maxbodyfirst) * sizeof(int);
+  bytes += (double)maxpartial * (sizeof(int) + 6*sizeof(double));
+  return bytes;
+}
@@ -27,16 +27,30 @@ namespace LAMMPS_NS {
 
 class FixRigidSmallOMP : public FixRigidSmall {
  public:
-  FixRigidSmallOMP(class LAMMPS *lmp, int narg, char **args) : FixRigidSmall(lmp, narg, args)
-  {
-    centroidstressflag = CENTROID_NOTAVAIL;
-  }
+  FixRigidSmallOMP(class LAMMPS *, int, char **);
+  ~FixRigidSmallOMP() override;
 
+  void setup_pre_neighbor() override;
+  void pre_neighbor() override;
   void initial_integrate(int) override;
   void final_integrate() override;
+  double memory_usage() override;
 
  protected:
+  // owned atoms in rigid bodies grouped by body, rebuilt after reneighboring
+  int *bodyatom;     // local atom indices sorted by body
+  int *bodyfirst;    // index into bodyatom of first atom of each body
+  int nbodyatom;     // # of atoms in bodyatom
+  int maxbodyatom, maxbodyfirst;
+  int sort_stale;    // 1 if bodyatom needs to be rebuilt
+
+  // per-thread sums of the bodies at both ends of a thread's atom range
+  int *partial_body;
+  double **partial_sum;
+  int maxpartial;
+
   void compute_forces_and_torques() override;
+  void sort_body_atoms();
 
  private:
   template <int, int, int> void set_xv_thr();
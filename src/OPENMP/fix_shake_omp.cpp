@@ -0,0 +1,228 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "fix_shake_omp.h"
+
+#include "atom.h"
+#include "comm.h"
+#include "memory.h"
+#include "update.h"
+
+#include <cstring>
+
+#include "omp_compat.h"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+FixShakeOMP::FixShakeOMP(LAMMPS *lmp, int narg, char **arg) :
+    FixShake(lmp, narg, arg), list_sort(nullptr), closest_sort(nullptr), maxsort(0),
+    virial_thr(nullptr), nthreads_thr(0), threaded(0)
+{
+  for (int k = 0; k < 5; k++) kindstart[k] = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixShakeOMP::~FixShakeOMP()
+{
+  memory->destroy(list_sort);
+  memory->destroy(closest_sort);
+  memory->destroy(virial_thr);
+}
+
+/* ----------------------------------------------------------------------
+   build cluster list in base class, then group it by cluster kind
+   so that each batch runs the same constraint kernel
+------------------------------------------------------------------------- */
+
+void FixShakeOMP::pre_neighbor()
+{
+  FixShake::pre_neighbor();
+
+  if (nlist > maxsort) {
+    maxsort = maxlist;
+    memory->destroy(list_sort);
+    memory->create(list_sort, maxsort, "shake/omp:list_sort");
+    memory->destroy(closest_sort);
+    memory->create(closest_sort, maxsort, 4, "shake/omp:closest_sort");
+  }
+
+  // stable counting sort: kind 0,1,2 = 2,3,4 atom bond cluster, 3 = angle cluster
+
+  int count[4] = {0, 0, 0, 0};
+  for (int i = 0; i < nlist; i++) {
+    const int flag = shake_flag[list[i]];
+    count[(flag == 1) ? 3 : flag - 2]++;
+  }
+
+  kindstart[0] = 0;
+  for (int k = 0; k < 4; k++) kindstart[k + 1] = kindstart[k] + count[k];
+
+  int next[4];
+  for (int k = 0; k < 4; k++) next[k] = kindstart[k];
+  for (int i = 0; i < nlist; i++) {
+    const int flag = shake_flag[list[i]];
+    const int j = next[(flag == 1) ? 3 : flag - 2]++;
+    list_sort[j] = list[i];
+    memcpy(closest_sort[j], closest_list[i], 4 * sizeof(int));
+  }
+
+  memcpy(list, list_sort, nlist * sizeof(int));
+  if (nlist) memcpy(closest_list[0], closest_sort[0], 4 * nlist * sizeof(int));
+}
+
+/* ----------------------------------------------------------------------
+   compute the force adjustment for SHAKE constraint
+   each owned atom belongs to a single cluster, so clusters are
+   processed concurrently and only the global virial needs reduction
+------------------------------------------------------------------------- */
+
+void FixShakeOMP::post_force(int vflag)
+{
+  if (update->ntimestep == next_output) stats();
+
+  // xshake = unconstrained move with current v,f
+  // communicate results if necessary
+
+  unconstrained_update();
+  comm->forward_comm(this);
+
+  // virial setup
+
+  int eflag = eflag_pre_reverse;
+  ev_init(eflag, vflag);
+  ebond = 0.0;
+
+  // per-atom virial is tallied through the serial base class path
+
+  const int nthreads = comm->nthreads;
+  threaded = (nthreads > 1) && !vflag_atom && !cvflag_atom;
+
+  if (threaded && vflag_global) {
+    if (nthreads > nthreads_thr) {
+      nthreads_thr = nthreads;
+      memory->destroy(virial_thr);
+      memory->create(virial_thr, 6 * nthreads_thr, "shake/omp:virial_thr");
+    }
+    memset(virial_thr, 0, 6 * nthreads * sizeof(double));
+  }
+
+  // loop over batches of clusters of the same kind to add constraint forces
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE if (threaded)
+#endif
+  {
+    int i;
+
+#if defined(_OPENMP)
+#pragma omp for schedule(static) nowait
+#endif
+    for (i = kindstart[0]; i < kindstart[1]; i++) shake(i);
+
+#if defined(_OPENMP)
+#pragma omp for schedule(static) nowait
+#endif
+    for (i = kindstart[1]; i < kindstart[2]; i++) shake3(i);
+
+#if defined(_OPENMP)
+#pragma omp for schedule(static) nowait
+#endif
+    for (i = kindstart[2]; i < kindstart[3]; i++) shake4(i);
+
+    if (settle_flag) {
+#if defined(_OPENMP)
+#pragma omp for schedule(static) nowait
+#endif
+      for (i = kindstart[3]; i < kindstart[4]; i++) settle(i);
+    } else {
+#if defined(_OPENMP)
+#pragma omp for schedule(static) nowait
+#endif
+      for (i = kindstart[3]; i < kindstart[4]; i++) shake3angle(i);
+    }
+  }
+
+  if (threaded && vflag_global) {
+    for (int t = 0; t < nthreads; t++)
+      for (int k = 0; k < 6; k++) virial[k] += virial_thr[6 * t + k];
+  }
+  threaded = 0;
+
+  // store vflag for coordinate_constraints_end_of_step()
+
+  vflag_post_force = vflag;
+}
+
+/* ----------------------------------------------------------------------
+   update the unconstrained position of each atom
+   only for SHAKE clusters, else set to 0.0
+------------------------------------------------------------------------- */
+
+void FixShakeOMP::unconstrained_update()
+{
+  const int nlocal = atom->nlocal;
+
+#if defined(_OPENMP)
+#pragma omp parallel for LMP_DEFAULT_NONE LMP_SHARED(nlocal) schedule(static)
+#endif
+  for (int i = 0; i < nlocal; i++) {
+    if (shake_flag[i]) {
+      const double dtfmsq = dtfsq / (rmass ? rmass[i] : mass[type[i]]);
+      xshake[i][0] = x[i][0] + dtv * v[i][0] + dtfmsq * f[i][0];
+      xshake[i][1] = x[i][1] + dtv * v[i][1] + dtfmsq * f[i][1];
+      xshake[i][2] = x[i][2] + dtv * v[i][2] + dtfmsq * f[i][2];
+    } else
+      xshake[i][2] = xshake[i][1] = xshake[i][0] = 0.0;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   tally global virial of one cluster into the accumulator of this thread
+------------------------------------------------------------------------- */
+
+void FixShakeOMP::shake_v_tally(int n, int *atomlist, double total, double *v, int npair,
+                                int pairlist[][2], double *fpairlist, double dellist[][3])
+{
+  if (!threaded) {
+    FixShake::shake_v_tally(n, atomlist, total, v, npair, pairlist, fpairlist, dellist);
+    return;
+  }
+
+  if (vflag_global) {
+#if defined(_OPENMP)
+    const int tid = omp_get_thread_num();
+#else
+    const int tid = 0;
+#endif
+    double *vthr = virial_thr + 6 * tid;
+    const double fraction = n / total;
+    for (int k = 0; k < 6; k++) vthr[k] += fraction * v[k];
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double FixShakeOMP::memory_usage()
+{
+  double bytes = FixShake::memory_usage();
+  bytes += (double) maxsort * 5 * sizeof(int);
+  bytes += (double) nthreads_thr * 6 * sizeof(double);
+  return bytes;
+}
@@ -0,0 +1,56 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+// clang-format off
+FixStyle(shake/omp,FixShakeOMP);
+// clang-format on
+#else
+
+#ifndef LMP_FIX_SHAKE_OMP_H
+#define LMP_FIX_SHAKE_OMP_H
+
+#include "fix_shake.h"
+
+namespace LAMMPS_NS {
+
+class FixShakeOMP : public FixShake {
+ public:
+  FixShakeOMP(class LAMMPS *, int, char **);
+  ~FixShakeOMP() override;
+
+  void pre_neighbor() override;
+  void post_force(int) override;
+  double memory_usage() override;
+
+ protected:
+  // cluster list is sorted by cluster kind (2,3,4 atom bonds, angle)
+  // kindstart[k] to kindstart[k+1]-1 = clusters of kind k
+  int kindstart[5];
+  int *list_sort;
+  int **closest_sort;
+  int maxsort;
+
+  // per-thread accumulators for the global virial
+  double *virial_thr;
+  int nthreads_thr;
+  int threaded;
+
+  void unconstrained_update() override;
+  void shake_v_tally(int, int *, double, double *, int, int[][2], double *, double[][3]) override;
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
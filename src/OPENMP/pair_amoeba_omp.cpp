@@ -0,0 +1,238 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "pair_amoeba_omp.h"
+
+#include "atom.h"
+#include "comm.h"
+#include "memory.h"
+#include "neigh_list.h"
+#include "suffix.h"
+
+#include <cstring>
+
+#include "omp_compat.h"
+using namespace LAMMPS_NS;
+
+enum{BUILD,APPLY};
+
+/* ---------------------------------------------------------------------- */
+
+PairAmoebaOMP::PairAmoebaOMP(LAMMPS *lmp) :
+  PairAmoeba(lmp), ThrOMP(lmp, THR_PAIR), nmax_thr(0), field_thr(nullptr)
+{
+  suffix_flag |= Suffix::OMP;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairAmoebaOMP::~PairAmoebaOMP()
+{
+  memory->destroy(field_thr);
+}
+
+/* ----------------------------------------------------------------------
+   per-thread buffers with 6 values per owned+ghost atom
+------------------------------------------------------------------------- */
+
+void PairAmoebaOMP::grow_thr()
+{
+  if (atom->nmax > nmax_thr) {
+    memory->destroy(field_thr);
+    nmax_thr = atom->nmax;
+    memory->create(field_thr,(bigint)comm->nthreads*nmax_thr*6,"amoeba/omp:field_thr");
+  }
+}
+
+/* ----------------------------------------------------------------------
+   umutual2b = Ewald real mutual field via list
+   same as PairAmoeba::umutual2b(), but each thread accumulates the
+     field of its chunk of the half list into its own buffer,
+     the buffers are then summed and added to field,fieldp
+------------------------------------------------------------------------- */
+
+void PairAmoebaOMP::umutual2b(double **field, double **fieldp)
+{
+  const int nall = atom->nlocal + atom->nghost;
+  const int nthreads = comm->nthreads;
+  const int inum = list->inum;
+
+  grow_thr();
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(field,fieldp)
+#endif
+  {
+    int ifrom, ito, tid;
+
+    loop_setup_thr(ifrom, ito, tid, inum, nthreads);
+    double *fld = field_thr + (bigint)tid*nall*6;
+    memset(fld, 0, sizeof(double)*nall*6);
+
+    const int * _noalias const ilist = list->ilist;
+
+    for (int ii = ifrom; ii < ito; ii++) {
+      const int i = ilist[ii];
+      const double *uindi = uind[i];
+      const double *uinpi = uinp[i];
+      const int *jlist = firstneigh_dipole[i];
+      const double *tdipdip = firstneigh_dipdip[i];
+      const int jnum = numneigh_dipole[i];
+      double *fldi = fld + 6*i;
+
+      for (int jj = 0; jj < jnum; jj++) {
+        const int j = jlist[jj];
+        const double *uindj = uind[j];
+        const double *uinpj = uinp[j];
+        double *fldj = fld + 6*j;
+
+        fldi[0] += tdipdip[0]*uindj[0] + tdipdip[1]*uindj[1] + tdipdip[2]*uindj[2];
+        fldi[1] += tdipdip[1]*uindj[0] + tdipdip[3]*uindj[1] + tdipdip[4]*uindj[2];
+        fldi[2] += tdipdip[2]*uindj[0] + tdipdip[4]*uindj[1] + tdipdip[5]*uindj[2];
+        fldi[3] += tdipdip[0]*uinpj[0] + tdipdip[1]*uinpj[1] + tdipdip[2]*uinpj[2];
+        fldi[4] += tdipdip[1]*uinpj[0] + tdipdip[3]*uinpj[1] + tdipdip[4]*uinpj[2];
+        fldi[5] += tdipdip[2]*uinpj[0] + tdipdip[4]*uinpj[1] + tdipdip[5]*uinpj[2];
+
+        fldj[0] += tdipdip[0]*uindi[0] + tdipdip[1]*uindi[1] + tdipdip[2]*uindi[2];
+        fldj[1] += tdipdip[1]*uindi[0] + tdipdip[3]*uindi[1] + tdipdip[4]*uindi[2];
+        fldj[2] += tdipdip[2]*uindi[0] + tdipdip[4]*uindi[1] + tdipdip[5]*uindi[2];
+        fldj[3] += tdipdip[0]*uinpi[0] + tdipdip[1]*uinpi[1] + tdipdip[2]*uinpi[2];
+        fldj[4] += tdipdip[1]*uinpi[0] + tdipdip[3]*uinpi[1] + tdipdip[4]*uinpi[2];
+        fldj[5] += tdipdip[2]*uinpi[0] + tdipdip[4]*uinpi[1] + tdipdip[5]*uinpi[2];
+
+        tdipdip += 6;
+      }
+    }
+
+    // sum per-thread buffers into the buffer of thread 0
+    // and add it to field,fieldp for owned and ghost atoms
+
+    data_reduce_thr(field_thr, nall, nthreads, 6, tid);
+    sync_threads();
+
+    loop_setup_thr(ifrom, ito, tid, nall, nthreads);
+    for (int i = ifrom; i < ito; i++) {
+      const double *sum = field_thr + 6*i;
+      for (int m = 0; m < 3; m++) {
+        field[i][m] += sum[m];
+        fieldp[i][m] += sum[m+3];
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   uscale0b = dipole preconditioner via neigh list
+   only applying the preconditioner is multi-threaded, it is done
+     in every PCG iteration, building it is left to the base class
+------------------------------------------------------------------------- */
+
+void PairAmoebaOMP::uscale0b(int mode, double **rsd, double **rsdp,
+                             double **zrsd, double **zrsdp)
+{
+  if (mode != APPLY) {
+    PairAmoeba::uscale0b(mode,rsd,rsdp,zrsd,zrsdp);
+    return;
+  }
+
+  const int nlocal = atom->nlocal;
+  const int nall = nlocal + atom->nghost;
+  const int nthreads = comm->nthreads;
+  const int inum = list->inum;
+
+  grow_thr();
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(rsd,rsdp,zrsd,zrsdp)
+#endif
+  {
+    int ifrom, ito, tid;
+
+    loop_setup_thr(ifrom, ito, tid, inum, nthreads);
+    double *zbuf = field_thr + (bigint)tid*nall*6;
+    memset(zbuf, 0, sizeof(double)*nall*6);
+
+    // off-diagonal preconditioner elements
+
+    const int * _noalias const ilist = list->ilist;
+
+    for (int ii = ifrom; ii < ito; ii++) {
+      const int i = ilist[ii];
+      const int *jlist = firstneigh_precond[i];
+      const double *pclist = firstneigh_pcpc[i];
+      const int jnum = numneigh_precond[i];
+      double *zi = zbuf + 6*i;
+
+      for (int jj = 0; jj < jnum; jj++) {
+        const int j = jlist[jj] & NEIGHMASK15;
+        double *zj = zbuf + 6*j;
+
+        const double m1 = pclist[0];
+        const double m2 = pclist[1];
+        const double m3 = pclist[2];
+        const double m4 = pclist[3];
+        const double m5 = pclist[4];
+        const double m6 = pclist[5];
+
+        zi[0] += m1*rsd[j][0] + m2*rsd[j][1] + m3*rsd[j][2];
+        zi[1] += m2*rsd[j][0] + m4*rsd[j][1] + m5*rsd[j][2];
+        zi[2] += m3*rsd[j][0] + m5*rsd[j][1] + m6*rsd[j][2];
+        zj[0] += m1*rsd[i][0] + m2*rsd[i][1] + m3*rsd[i][2];
+        zj[1] += m2*rsd[i][0] + m4*rsd[i][1] + m5*rsd[i][2];
+        zj[2] += m3*rsd[i][0] + m5*rsd[i][1] + m6*rsd[i][2];
+        zi[3] += m1*rsdp[j][0] + m2*rsdp[j][1] + m3*rsdp[j][2];
+        zi[4] += m2*rsdp[j][0] + m4*rsdp[j][1] + m5*rsdp[j][2];
+        zi[5] += m3*rsdp[j][0] + m5*rsdp[j][1] + m6*rsdp[j][2];
+        zj[3] += m1*rsdp[i][0] + m2*rsdp[i][1] + m3*rsdp[i][2];
+        zj[4] += m2*rsdp[i][0] + m4*rsdp[i][1] + m5*rsdp[i][2];
+        zj[5] += m3*rsdp[i][0] + m5*rsdp[i][1] + m6*rsdp[i][2];
+
+        pclist += 6;
+      }
+    }
+
+    data_reduce_thr(field_thr, nall, nthreads, 6, tid);
+    sync_threads();
+
+    // diagonal preconditioner elements for owned atoms
+    // plus the summed off-diagonal contributions for owned and ghost atoms
+
+    const double polmin = 0.00000001;
+    loop_setup_thr(ifrom, ito, tid, nall, nthreads);
+    for (int i = ifrom; i < ito; i++) {
+      const double *sum = field_thr + 6*i;
+      if (i < nlocal) {
+        const double poli = udiag * MAX(polmin,polarity[amtype[i]]);
+        for (int m = 0; m < 3; m++) {
+          zrsd[i][m] = poli * rsd[i][m] + sum[m];
+          zrsdp[i][m] = poli * rsdp[i][m] + sum[m+3];
+        }
+      } else {
+        for (int m = 0; m < 3; m++) {
+          zrsd[i][m] = sum[m];
+          zrsdp[i][m] = sum[m+3];
+        }
+      }
+    }
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairAmoebaOMP::memory_usage()
+{
+  double bytes = memory_usage_thr();
+  bytes += PairAmoeba::memory_usage();
+  bytes += (double)comm->nthreads * nmax_thr * 6 * sizeof(double);
+  return bytes;
+}
@@ -0,0 +1,51 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+// clang-format off
+PairStyle(amoeba/omp,PairAmoebaOMP);
+// clang-format on
+#else
+
+#ifndef LMP_PAIR_AMOEBA_OMP_H
+#define LMP_PAIR_AMOEBA_OMP_H
+
+#include "pair_amoeba.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+// multi-threaded real-space kernels of the induced dipole solver
+// these are evaluated in every iteration of the PCG solver in induce()
+
+class PairAmoebaOMP : public PairAmoeba, public ThrOMP {
+ public:
+  PairAmoebaOMP(class LAMMPS *);
+  ~PairAmoebaOMP() override;
+
+  double memory_usage() override;
+
+ protected:
+  int nmax_thr;
+  double *field_thr;    // per-thread copies of 2 vectors for owned+ghost atoms
+
+  void umutual2b(double **, double **) override;
+  void uscale0b(int, double **, double **, double **, double **) override;
+
+  void grow_thr();
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
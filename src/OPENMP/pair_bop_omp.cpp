@@ -0,0 +1,249 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "pair_bop_omp.h"
+
+#include "atom.h"
+#include "comm.h"
+#include "memory.h"
+#include "neigh_list.h"
+#include "suffix.h"
+
+#include "omp_compat.h"
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+PairBOPOMP::PairBOPOMP(LAMMPS *lmp) :
+  PairBOP(lmp), ThrOMP(lmp, THR_PAIR)
+{
+  suffix_flag |= Suffix::OMP;
+  respa_enable = 0;
+
+  nthreads = 0;
+  bt_sg_buf = nullptr;
+  bt_pi_buf = nullptr;
+  sglimit_buf = nullptr;
+  pilimit_buf = nullptr;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairBOPOMP::~PairBOPOMP()
+{
+  for (int i = 0; i < nthreads; ++i) {
+    memory->destroy(bt_sg_buf[i]);
+    memory->destroy(bt_pi_buf[i]);
+  }
+  delete[] bt_sg_buf;
+  delete[] bt_pi_buf;
+  delete[] sglimit_buf;
+  delete[] pilimit_buf;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairBOPOMP::compute(int eflag, int vflag)
+{
+  ev_init(eflag,vflag);
+
+  // the BOP neighbor lists and pair data are set up serially,
+  // the bond orders and forces are then computed by all threads
+
+  gneigh();
+
+  const int nall = atom->nlocal + atom->nghost;
+  const int inum = list->inum;
+
+  // per-thread bond order derivative buffers are kept between calls and only grow
+
+  if (nthreads != comm->nthreads) {
+    for (int i = 0; i < nthreads; ++i) {
+      memory->destroy(bt_sg_buf[i]);
+      memory->destroy(bt_pi_buf[i]);
+    }
+    delete[] bt_sg_buf;
+    delete[] bt_pi_buf;
+    delete[] sglimit_buf;
+    delete[] pilimit_buf;
+    nthreads = comm->nthreads;
+    bt_sg_buf = new B_SG*[nthreads];
+    bt_pi_buf = new B_PI*[nthreads];
+    sglimit_buf = new int[nthreads];
+    pilimit_buf = new int[nthreads];
+    for (int i = 0; i < nthreads; ++i) {
+      bt_sg_buf[i] = nullptr;
+      bt_pi_buf[i] = nullptr;
+      sglimit_buf[i] = -1;
+      pilimit_buf[i] = -1;
+    }
+  }
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(eflag,vflag)
+#endif
+  {
+    int ifrom, ito, tid;
+
+    loop_setup_thr(ifrom, ito, tid, inum, nthreads);
+    ThrData *thr = fix->get_thr(tid);
+    thr->timer(Timer::START);
+    ev_setup_thr(eflag, vflag, nall, eatom, vatom, nullptr, thr);
+
+    if (evflag) eval<1>(ifrom, ito, thr);
+    else eval<0>(ifrom, ito, thr);
+
+    thr->timer(Timer::PAIR);
+    reduce_thr(this, eflag, vflag, thr);
+  } // end of omp parallel region
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int EVFLAG>
+void PairBOPOMP::eval(int iifrom, int iito, ThrData * const thr)
+{
+  int i, ii, j, jj, n;
+  int nlisti, *ilist;
+  tagint i_tag, j_tag, itype, jtype;
+  int temp_ij, nb_t, loop, bt_i, bt_j;
+  double sigB_0, piB_0;
+  double dpr1, dpr2, ftmp1, ftmp2, ftmp3, dE, pp, ftmp[3];
+
+  const int tid = thr->get_tid();
+  B_SG *&bt_sg_thr = bt_sg_buf[tid];
+  B_PI *&bt_pi_thr = bt_pi_buf[tid];
+  int &sglimit_thr = sglimit_buf[tid];
+  int &pilimit_thr = pilimit_buf[tid];
+
+  const int nlocal = atom->nlocal;
+  double **x = atom->x;
+  double **f = thr->get_f();
+  int *type = atom->type;
+  tagint *tag = atom->tag;
+  int *iilist = list->ilist;
+  int **firstneigh = list->firstneigh;
+
+  for (ii = iifrom; ii < iito; ii++) {
+    i = iilist[ii];
+    i_tag = tag[i];
+    itype = map[type[i]];
+    ilist = firstneigh[i];
+    nlisti = BOP_total[i];
+    for (jj = 0; jj < nlisti; jj++) {
+      temp_ij = BOP_index[i] + jj;
+      j = ilist[neigh_index[temp_ij]];
+      j_tag = tag[j];
+      if (i_tag > j_tag) {
+        if ((i_tag+j_tag) % 2 == 0) continue;
+      } else if (i_tag < j_tag) {
+        if ((i_tag+j_tag) % 2 == 1) continue;
+      } else {
+        if (x[j][2] < x[i][2]) continue;
+        if (x[j][2] == x[i][2] && x[j][1] < x[i][1]) continue;
+        if (x[j][2] == x[i][2] && x[j][1] == x[i][1] && x[j][0] < x[i][0]) continue;
+      }
+      jtype = map[type[j]];
+      int param_ij = elem2param[itype][jtype];
+      PairList1 & pl_ij = pairlist1[temp_ij];
+
+      sigB_0 = SigmaBo(ii,jj,bt_sg_thr,sglimit_thr,nb_t);
+      pp = 2.0*pl_ij.betaS;
+      for (loop = 0; loop < nb_t; loop++) {
+        bt_i = bt_sg_thr[loop].i;
+        bt_j = bt_sg_thr[loop].j;
+        for (n = 0; n < 3; n++) {
+          ftmp[n] = pp*bt_sg_thr[loop].dSigB[n];
+          f[bt_i][n] -= ftmp[n];
+          f[bt_j][n] += ftmp[n];
+        }
+        if (EVFLAG) ev_tally_xyz_thr(this,bt_i,bt_j,nlocal,/* newton_pair */ 1,0.0,0.0,
+                                     -ftmp[0],-ftmp[1],-ftmp[2],x[bt_i][0]-x[bt_j][0],
+                                     x[bt_i][1]-x[bt_j][1],x[bt_i][2]-x[bt_j][2],thr);
+      }
+      if (pi_a[param_ij] == 0) {
+        piB_0 = 0.0;
+      } else {
+        piB_0 = PiBo(ii,jj,bt_pi_thr,pilimit_thr,nb_t);
+        pp = 2.0*pl_ij.betaP;
+        for (loop = 0; loop < nb_t; loop++) {
+          bt_i = bt_pi_thr[loop].i;
+          bt_j = bt_pi_thr[loop].j;
+          for (n = 0; n < 3; n++) {
+            ftmp[n] = pp*bt_pi_thr[loop].dPiB[n];
+            f[bt_i][n] -= ftmp[n];
+            f[bt_j][n] += ftmp[n];
+          }
+          if (EVFLAG) ev_tally_xyz_thr(this,bt_i,bt_j,nlocal,/* newton_pair */ 1,0.0,0.0,
+                                       -ftmp[0],-ftmp[1],-ftmp[2],x[bt_i][0]-x[bt_j][0],
+                                       x[bt_i][1]-x[bt_j][1],x[bt_i][2]-x[bt_j][2],thr);
+        }
+      }
+      dpr1 = (pl_ij.dRep - 2.0*pl_ij.dBetaS*sigB_0 -
+              2.0*pl_ij.dBetaP*piB_0) / pl_ij.r;
+      ftmp1 = dpr1 * pl_ij.dis[0];
+      ftmp2 = dpr1 * pl_ij.dis[1];
+      ftmp3 = dpr1 * pl_ij.dis[2];
+      f[i][0] += ftmp1;
+      f[i][1] += ftmp2;
+      f[i][2] += ftmp3;
+      f[j][0] -= ftmp1;
+      f[j][1] -= ftmp2;
+      f[j][2] -= ftmp3;
+      dE = pl_ij.rep - 2.0*pl_ij.betaS*sigB_0 - 2.0*pl_ij.betaP*piB_0;
+      if (EVFLAG) ev_tally_thr(this,i,j,nlocal,/* newton_pair */ 1,dE,0.0,-dpr1,
+                               pl_ij.dis[0],pl_ij.dis[1],pl_ij.dis[2],thr);
+    }
+    nlisti = BOP_total2[i];
+    for (jj = 0; jj < nlisti; jj++) {
+      temp_ij = BOP_index2[i] + jj;
+      j = ilist[neigh_index2[temp_ij]];
+      j_tag = tag[j];
+      if (i_tag > j_tag) {
+        if ((i_tag+j_tag) % 2 == 0) continue;
+      } else if (i_tag < j_tag) {
+        if ((i_tag+j_tag) % 2 == 1) continue;
+      } else {
+        if (x[j][2] < x[i][2]) continue;
+        if (x[j][2] == x[i][2] && x[j][1] < x[i][1]) continue;
+        if (x[j][2] == x[i][2] && x[j][1] == x[i][1] && x[j][0] < x[i][0]) continue;
+      }
+      PairList2 & p2_ij = pairlist2[temp_ij];
+      dpr2 = -p2_ij.dRep / p2_ij.r;
+      ftmp1 = dpr2 * p2_ij.dis[0];
+      ftmp2 = dpr2 * p2_ij.dis[1];
+      ftmp3 = dpr2 * p2_ij.dis[2];
+      f[i][0] += ftmp1;
+      f[i][1] += ftmp2;
+      f[i][2] += ftmp3;
+      f[j][0] -= ftmp1;
+      f[j][1] -= ftmp2;
+      f[j][2] -= ftmp3;
+      dE = -p2_ij.rep;
+      if (EVFLAG) ev_tally_thr(this,i,j,nlocal,/* newton_pair */ 1,dE,0.0,-dpr2,
+                               p2_ij.dis[0],p2_ij.dis[1],p2_ij.dis[2],thr);
+    }
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairBOPOMP::memory_usage()
+{
+  double bytes = memory_usage_thr();
+  bytes += PairBOP::memory_usage();
+  for (int i = 0; i < nthreads; ++i) {
+    if (bt_sg_buf[i]) bytes += (double)sglimit_buf[i] * sizeof(B_SG);
+    if (bt_pi_buf[i]) bytes += (double)pilimit_buf[i] * sizeof(B_PI);
+  }
+
+  return bytes;
+}
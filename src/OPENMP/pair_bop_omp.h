@@ -0,0 +1,51 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+// clang-format off
+PairStyle(bop/omp,PairBOPOMP);
+// clang-format on
+#else
+
+#ifndef LMP_PAIR_BOP_OMP_H
+#define LMP_PAIR_BOP_OMP_H
+
+#include "pair_bop.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairBOPOMP : public PairBOP, public ThrOMP {
+
+ public:
+  PairBOPOMP(class LAMMPS *);
+  ~PairBOPOMP() override;
+
+  void compute(int, int) override;
+  double memory_usage() override;
+
+ protected:
+  int nthreads;         // # of threads the buffers are allocated for
+  B_SG **bt_sg_buf;     // per-thread sigma bond order derivatives
+  B_PI **bt_pi_buf;     // per-thread pi bond order derivatives
+  int *sglimit_buf;     // allocated length of each sigma buffer
+  int *pilimit_buf;     // allocated length of each pi buffer
+
+ private:
+  template <int EVFLAG> void eval(int ifrom, int ito, ThrData *const thr);
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
@@ -0,0 +1,49 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+// clang-format off
+PairStyle(edip/multi/omp,PairEDIPMultiOMP);
+// clang-format on
+#else
+
+#ifndef LMP_PAIR_EDIP_MULTI_OMP_H
+#define LMP_PAIR_EDIP_MULTI_OMP_H
+
+#include "pair_edip_multi.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairEDIPMultiOMP : public PairEDIPMulti, public ThrOMP {
+
+ public:
+  PairEDIPMultiOMP(class LAMMPS *);
+  ~PairEDIPMultiOMP() override;
+
+  void compute(int, int) override;
+  double memory_usage() override;
+
+ protected:
+  int nthreads;           // # of threads the buffers are allocated for
+  int *maxcoord_buf;      // allocated # of coordination pairs per buffer
+  double **coord_buf;     // per-thread coordination force prefactors
+
+ private:
+  template <int EVFLAG> void eval(int ifrom, int ito, ThrData *const thr);
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
@@ -0,0 +1,460 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "pair_extep_omp.h"
+
+#include "atom.h"
+#include "comm.h"
+#include "error.h"
+#include "memory.h"
+#include "my_page.h"
+#include "neigh_list.h"
+#include "suffix.h"
+
+#include <cmath>
+
+#include "omp_compat.h"
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+PairExTePOMP::PairExTePOMP(LAMMPS *lmp) :
+  PairExTeP(lmp), ThrOMP(lmp, THR_PAIR)
+{
+  suffix_flag |= Suffix::OMP;
+  respa_enable = 0;
+
+  nthreads = 0;
+  maxshort_buf = nullptr;
+  neighshort_buf = nullptr;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairExTePOMP::~PairExTePOMP()
+{
+  for (int i = 0; i < nthreads; ++i) memory->destroy(neighshort_buf[i]);
+  delete[] neighshort_buf;
+  delete[] maxshort_buf;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairExTePOMP::compute(int eflag, int vflag)
+{
+  ev_init(eflag,vflag);
+
+  SR_neigh_thr();
+
+  const int nall = atom->nlocal + atom->nghost;
+  const int inum = list->inum;
+
+  // per-thread short neighbor lists are kept between calls and only grow
+
+  if (nthreads != comm->nthreads) {
+    for (int i = 0; i < nthreads; ++i) memory->destroy(neighshort_buf[i]);
+    delete[] neighshort_buf;
+    delete[] maxshort_buf;
+    nthreads = comm->nthreads;
+    neighshort_buf = new int*[nthreads];
+    maxshort_buf = new int[nthreads];
+    for (int i = 0; i < nthreads; ++i) {
+      maxshort_buf[i] = 10;
+      memory->create(neighshort_buf[i],maxshort_buf[i],"pair_thr:neighshort_thr");
+    }
+  }
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(eflag,vflag)
+#endif
+  {
+    int ifrom, ito, tid;
+
+    loop_setup_thr(ifrom, ito, tid, inum, nthreads);
+    ThrData *thr = fix->get_thr(tid);
+    thr->timer(Timer::START);
+    ev_setup_thr(eflag, vflag, nall, eatom, vatom, nullptr, thr);
+
+    if (evflag) {
+      if (eflag) {
+        if (vflag_either) eval<1,1,1>(ifrom, ito, thr);
+        else eval<1,1,0>(ifrom, ito, thr);
+      } else {
+        if (vflag_either) eval<1,0,1>(ifrom, ito, thr);
+        else eval<1,0,0>(ifrom, ito, thr);
+      }
+    } else eval<0,0,0>(ifrom, ito, thr);
+
+    thr->timer(Timer::PAIR);
+    reduce_thr(this, eflag, vflag, thr);
+  } // end of omp parallel region
+}
+
+/* ----------------------------------------------------------------------
+   create SR neighbor list from main neighbor list and compute the
+   coordination numbers Nt, Nd of owned and ghost atoms
+   each thread fills its own page allocator
+------------------------------------------------------------------------- */
+
+void PairExTePOMP::SR_neigh_thr()
+{
+  const int nthreads = comm->nthreads;
+
+  if (atom->nmax > maxlocal) {
+    maxlocal = atom->nmax;
+    memory->destroy(SR_numneigh);
+    memory->sfree(SR_firstneigh);
+    memory->destroy(Nt);
+    memory->destroy(Nd);
+    memory->create(SR_numneigh,maxlocal,"ExTeP:numneigh");
+    SR_firstneigh = (int **) memory->smalloc(maxlocal*sizeof(int *),
+                                             "ExTeP:firstneigh");
+    memory->create(Nt,maxlocal,"ExTeP:Nt");
+    memory->create(Nd,maxlocal,"ExTeP:Nd");
+  }
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE
+#endif
+  {
+    int i,j,ii,jj,n,jnum,itype,jtype,iparam_ij;
+    double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
+    int *ilist,*jlist,*numneigh,**firstneigh;
+    int *neighptr;
+
+    double **x = atom->x;
+    int *type = atom->type;
+
+    const int allnum = list->inum + list->gnum;
+    ilist = list->ilist;
+    numneigh = list->numneigh;
+    firstneigh = list->firstneigh;
+
+#if defined(_OPENMP)
+    const int tid = omp_get_thread_num();
+#else
+    const int tid = 0;
+#endif
+
+    const int iidelta = 1 + allnum/nthreads;
+    const int iifrom = tid*iidelta;
+    const int iito = ((iifrom+iidelta)>allnum) ? allnum : (iifrom+iidelta);
+
+    MyPage<int> &ipg = ipage[tid];
+    ipg.reset();
+
+    for (ii = iifrom; ii < iito; ii++) {
+      i = ilist[ii];
+      itype = map[type[i]];
+
+      n = 0;
+      neighptr = ipg.vget();
+
+      xtmp = x[i][0];
+      ytmp = x[i][1];
+      ztmp = x[i][2];
+
+      Nt[i] = 0.0;
+      Nd[i] = 0.0;
+
+      jlist = firstneigh[i];
+      jnum = numneigh[i];
+
+      for (jj = 0; jj < jnum; jj++) {
+        j = jlist[jj];
+        j &= NEIGHMASK;
+        delx = xtmp - x[j][0];
+        dely = ytmp - x[j][1];
+        delz = ztmp - x[j][2];
+        rsq = delx*delx + dely*dely + delz*delz;
+
+        jtype = map[type[j]];
+        iparam_ij = elem3param[itype][jtype][jtype];
+
+        if (rsq < params[iparam_ij].cutsq) {
+          neighptr[n++] = j;
+          double tmp_fc = ters_fc(sqrt(rsq),&params[iparam_ij]);
+          Nt[i] += tmp_fc;
+          if (itype != jtype) Nd[i] += tmp_fc;
+        }
+      }
+
+      SR_firstneigh[i] = neighptr;
+      SR_numneigh[i] = n;
+      ipg.vgot(n);
+      if (ipg.status())
+        error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
+    }
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int EVFLAG, int EFLAG, int VFLAG_EITHER>
+void PairExTePOMP::eval(int iifrom, int iito, ThrData * const thr)
+{
+  int i,j,k,ii,jj,kk,jnum,maxshort_thr;
+  tagint itag,jtag;
+  int itype,jtype,ktype,iparam_ij,iparam_ijk;
+  double xtmp,ytmp,ztmp,delx,dely,delz,evdwl,fpair;
+  double rsq,rsq1,rsq2,r2;
+  double delr1[3],delr2[3],fi[3],fj[3],fk[3];
+  double zeta_ij,prefactor;
+  int *ilist,*jlist,*numneigh,**firstneigh,*neighshort_thr;
+
+  evdwl = 0.0;
+
+  const auto * _noalias const x = (dbl3_t *) atom->x[0];
+  auto * _noalias const f = (dbl3_t *) thr->get_f()[0];
+  const tagint * _noalias const tag = atom->tag;
+  const int * _noalias const type = atom->type;
+  const int nlocal = atom->nlocal;
+  const double cutmaxsq = cutmax*cutmax;
+
+  ilist = list->ilist;
+  numneigh = list->numneigh;
+  firstneigh = list->firstneigh;
+  const int tid = thr->get_tid();
+  maxshort_thr = maxshort_buf[tid];
+  neighshort_thr = neighshort_buf[tid];
+
+  double fxtmp,fytmp,fztmp;
+
+  // loop over full neighbor list of my atoms
+
+  for (ii = iifrom; ii < iito; ++ii) {
+
+    i = ilist[ii];
+    itag = tag[i];
+    itype = map[type[i]];
+    xtmp = x[i].x;
+    ytmp = x[i].y;
+    ztmp = x[i].z;
+    fxtmp = fytmp = fztmp = 0.0;
+
+    // two-body interactions, skip half of them
+    // collect neighbors within the largest cutoff for the three-body part
+
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+    int numshort = 0;
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      j &= NEIGHMASK;
+
+      delx = xtmp - x[j].x;
+      dely = ytmp - x[j].y;
+      delz = ztmp - x[j].z;
+      rsq = delx*delx + dely*dely + delz*delz;
+
+      if (rsq <= cutmaxsq) {
+        neighshort_thr[numshort++] = j;
+        if (numshort >= maxshort_thr) {
+          maxshort_thr += maxshort_thr/2;
+          memory->grow(neighshort_thr,maxshort_thr,"pair_thr:neighshort_thr");
+        }
+      }
+
+      jtag = tag[j];
+      if (itag > jtag) {
+        if ((itag+jtag) % 2 == 0) continue;
+      } else if (itag < jtag) {
+        if ((itag+jtag) % 2 == 1) continue;
+      } else {
+        if (x[j].z < ztmp) continue;
+        if (x[j].z == ztmp && x[j].y < ytmp) continue;
+        if (x[j].z == ztmp && x[j].y == ytmp && x[j].x < xtmp) continue;
+      }
+
+      jtype = map[type[j]];
+      iparam_ij = elem3param[itype][jtype][jtype];
+      if (rsq > params[iparam_ij].cutsq) continue;
+
+      repulsive(&params[iparam_ij],rsq,fpair,EFLAG,evdwl);
+
+      fxtmp += delx*fpair;
+      fytmp += dely*fpair;
+      fztmp += delz*fpair;
+      f[j].x -= delx*fpair;
+      f[j].y -= dely*fpair;
+      f[j].z -= delz*fpair;
+
+      if (EVFLAG) ev_tally_thr(this,i,j,nlocal,/* newton_pair */ 1,
+                               evdwl,0.0,fpair,delx,dely,delz,thr);
+    }
+
+    // three-body interactions      -(bij + Fcorrection) * fA
+    // skip immediately if I-J is not within cutoff
+    double fjxtmp,fjytmp,fjztmp;
+
+    for (jj = 0; jj < numshort; jj++) {
+      j = neighshort_thr[jj];
+      jtype = map[type[j]];
+      iparam_ij = elem3param[itype][jtype][jtype];
+
+      delr1[0] = x[j].x - xtmp;
+      delr1[1] = x[j].y - ytmp;
+      delr1[2] = x[j].z - ztmp;
+      rsq1 = delr1[0]*delr1[0] + delr1[1]*delr1[1] + delr1[2]*delr1[2];
+      if (rsq1 > params[iparam_ij].cutsq) continue;
+
+      fjxtmp = fjytmp = fjztmp = 0.0;
+      zeta_ij = 0.0;
+
+      // correction to energy and forces from the spline F_IJ
+      // the conjugate term is computed when j is the central atom
+
+      double FXY, dFXY_dNdij, dFXY_dNdji, fa, fa_d, deng;
+      double Ntij = Nt[i];
+      double Ndij = Nd[i];
+      double Ntji = Nt[j];
+      double Ndji = Nd[j];
+      const double r = sqrt(rsq1);
+      const double fc_ij = ters_fc(r,&params[iparam_ij]);
+
+      Ntij -= fc_ij;
+      Ntji -= fc_ij;
+      if (jtype != itype) {
+        Ndij -= fc_ij;
+        Ndji -= fc_ij;
+      }
+      if (Ntij < 0) Ntij = 0.0;
+      if (Ndij < 0) Ndij = 0.0;
+      if (Ntji < 0) Ntji = 0.0;
+      if (Ndji < 0) Ndji = 0.0;
+      FXY = F_corr(itype, jtype, Ndij, Ndji, &dFXY_dNdij, &dFXY_dNdji);
+
+      double fenv, dfenv_ij;
+      fenv = envelop_function(Ntij, Ntji, &dfenv_ij);
+
+      const double Fc = fenv * FXY;
+      const double dFc_dNtij = dfenv_ij * FXY;
+      const double dFc_dNdij = fenv * dFXY_dNdij;
+
+      fa = ters_fa(r,&params[iparam_ij]);
+      fa_d = ters_fa_d(r,&params[iparam_ij]);
+      deng = 0.5 * fa * Fc;
+      fpair = 0.5 * fa_d * Fc / r;
+
+      fxtmp += delr1[0]*fpair;
+      fytmp += delr1[1]*fpair;
+      fztmp += delr1[2]*fpair;
+      fjxtmp -= delr1[0]*fpair;
+      fjytmp -= delr1[1]*fpair;
+      fjztmp -= delr1[2]*fpair;
+
+      if (EVFLAG) ev_tally_thr(this,i,j,nlocal,/* newton_pair */ 1,deng,0.0,
+                               -fpair,-delr1[0],-delr1[1],-delr1[2],thr);
+
+      // accumulate bondorder zeta for each i-j interaction via loop over k
+      // and add forces from the derivatives of the coordination numbers
+
+      for (kk = 0; kk < numshort; kk++) {
+        if (jj == kk) continue;
+        k = neighshort_thr[kk];
+        ktype = map[type[k]];
+        iparam_ijk = elem3param[itype][jtype][ktype];
+
+        delr2[0] = x[k].x - xtmp;
+        delr2[1] = x[k].y - ytmp;
+        delr2[2] = x[k].z - ztmp;
+        rsq2 = delr2[0]*delr2[0] + delr2[1]*delr2[1] + delr2[2]*delr2[2];
+        if (rsq2 > params[iparam_ijk].cutsq) continue;
+
+        r2 = sqrt(rsq2);
+
+        zeta_ij += zeta(&params[iparam_ijk],r,r2,delr1,delr2);
+
+        const int iparam_ik = elem3param[itype][ktype][0];
+        const double fc_ik_d = ters_fc_d(r2,&params[iparam_ik]);
+        const double fc_prefac_ik_0 = fc_ik_d * fa / r2;
+        double fc_prefac_ik = dFc_dNtij * fc_prefac_ik_0;
+        if (itype != ktype) fc_prefac_ik += dFc_dNdij * fc_prefac_ik_0;
+
+        fxtmp += fc_prefac_ik * delr2[0];
+        fytmp += fc_prefac_ik * delr2[1];
+        fztmp += fc_prefac_ik * delr2[2];
+        f[k].x -= fc_prefac_ik * delr2[0];
+        f[k].y -= fc_prefac_ik * delr2[1];
+        f[k].z -= fc_prefac_ik * delr2[2];
+        if (VFLAG_EITHER) v_tally2_thr(this,i,k,-fc_prefac_ik,delr2,thr);
+      }
+
+      // pairwise force due to zeta
+
+      force_zeta(&params[iparam_ij],r,zeta_ij,fpair,prefactor,EFLAG,evdwl);
+
+      fxtmp += delr1[0]*fpair;
+      fytmp += delr1[1]*fpair;
+      fztmp += delr1[2]*fpair;
+      fjxtmp -= delr1[0]*fpair;
+      fjytmp -= delr1[1]*fpair;
+      fjztmp -= delr1[2]*fpair;
+
+      if (EVFLAG) ev_tally_thr(this,i,j,nlocal,/* newton_pair */ 1,evdwl,0.0,
+                               -fpair,-delr1[0],-delr1[1],-delr1[2],thr);
+
+      // attractive term via loop over k
+
+      for (kk = 0; kk < numshort; kk++) {
+        if (jj == kk) continue;
+        k = neighshort_thr[kk];
+        ktype = map[type[k]];
+        iparam_ijk = elem3param[itype][jtype][ktype];
+
+        delr2[0] = x[k].x - xtmp;
+        delr2[1] = x[k].y - ytmp;
+        delr2[2] = x[k].z - ztmp;
+        rsq2 = delr2[0]*delr2[0] + delr2[1]*delr2[1] + delr2[2]*delr2[2];
+        if (rsq2 > params[iparam_ijk].cutsq) continue;
+
+        attractive(&params[iparam_ijk],prefactor,
+                   rsq1,rsq2,delr1,delr2,fi,fj,fk);
+
+        fxtmp += fi[0];
+        fytmp += fi[1];
+        fztmp += fi[2];
+        fjxtmp += fj[0];
+        fjytmp += fj[1];
+        fjztmp += fj[2];
+        f[k].x += fk[0];
+        f[k].y += fk[1];
+        f[k].z += fk[2];
+
+        if (VFLAG_EITHER) v_tally3_thr(this,i,j,k,fj,fk,delr1,delr2,thr);
+      }
+      f[j].x += fjxtmp;
+      f[j].y += fjytmp;
+      f[j].z += fjztmp;
+    }
+    f[i].x += fxtmp;
+    f[i].y += fytmp;
+    f[i].z += fztmp;
+  }
+  maxshort_buf[tid] = maxshort_thr;
+  neighshort_buf[tid] = neighshort_thr;
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairExTePOMP::memory_usage()
+{
+  double bytes = memory_usage_thr();
+  bytes += PairExTeP::memory_usage();
+  for (int i = 0; i < nthreads; ++i) bytes += (double)maxshort_buf[i] * sizeof(int);
+
+  return bytes;
+}
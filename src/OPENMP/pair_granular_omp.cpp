@@ -0,0 +1,352 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "omp_compat.h"
+#include "pair_granular_omp.h"
+
+#include "atom.h"
+#include "comm.h"
+#include "fix.h"
+#include "fix_neigh_history.h"
+#include "force.h"
+#include "granular_model.h"
+#include "math_extra.h"
+#include "memory.h"
+#include "neigh_list.h"
+#include "neighbor.h"
+#include "update.h"
+
+#include <cstring>
+
+#include "suffix.h"
+using namespace LAMMPS_NS;
+using namespace Granular_NS;
+using namespace MathExtra;
+
+/* ---------------------------------------------------------------------- */
+
+PairGranularOMP::PairGranularOMP(LAMMPS *lmp) :
+  PairGranular(lmp), ThrOMP(lmp, THR_PAIR)
+{
+  suffix_flag |= Suffix::OMP;
+  respa_enable = 0;
+
+  models_thr = nullptr;
+  nthreads_thr = nmodels_thr = 0;
+  models_stale = 1;
+
+  heatflow_thr = nullptr;
+  nmax_heat = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairGranularOMP::~PairGranularOMP()
+{
+  destroy_models();
+  memory->destroy(heatflow_thr);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairGranularOMP::compute(int eflag, int vflag)
+{
+  ev_init(eflag,vflag);
+
+  const int history_update = (update->setupflag) ? 0 : 1;
+  const int nall = atom->nlocal + atom->nghost;
+  const int nthreads = comm->nthreads;
+  const int inum = list->inum;
+
+  // refresh the per-thread model copies after init() or a timestep change
+
+  if (models_stale || (nthreads != nthreads_thr)) copy_models();
+
+  for (int t = 0; t < nthreads_thr; t++)
+    for (int n = 0; n < nmodels_thr; n++)
+      models_thr[t][n]->history_update = history_update;
+
+  // update rigid body info for owned & ghost atoms if using FixRigid masses
+  // body[i] = which body atom I is in, -1 if none
+  // mass_body = mass of each rigid body
+
+  if (fix_rigid && neighbor->ago == 0) {
+    int tmp;
+    int *body = (int *) fix_rigid->extract("body",tmp);
+    auto mass_body = (double *) fix_rigid->extract("masstotal",tmp);
+    if (atom->nmax > nmax) {
+      memory->destroy(mass_rigid);
+      nmax = atom->nmax;
+      memory->create(mass_rigid,nmax,"pair:mass_rigid");
+    }
+    int nlocal = atom->nlocal;
+    for (int i = 0; i < nlocal; i++)
+      if (body[i] >= 0) mass_rigid[i] = mass_body[body[i]];
+      else mass_rigid[i] = 0.0;
+    comm->forward_comm(this);
+  }
+
+  // heat flow is accumulated in one private block per thread and reduced
+
+  if (heat_flag && (nthreads * atom->nmax > nmax_heat)) {
+    memory->destroy(heatflow_thr);
+    nmax_heat = nthreads * atom->nmax;
+    memory->create(heatflow_thr,nmax_heat,"pair:heatflow_thr");
+  }
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(eflag,vflag)
+#endif
+  {
+    int ifrom, ito, tid;
+
+    loop_setup_thr(ifrom, ito, tid, inum, nthreads);
+    ThrData *thr = fix->get_thr(tid);
+    thr->timer(Timer::START);
+    ev_setup_thr(eflag, vflag, nall, eatom, vatom, nullptr, thr);
+
+    if (heat_flag) {
+      memset(heatflow_thr + tid*nall, 0, sizeof(double)*nall);
+
+      if (evflag) {
+        if (force->newton_pair) eval<1,1,1>(ifrom, ito, thr);
+        else eval<1,0,1>(ifrom, ito, thr);
+      } else {
+        if (force->newton_pair) eval<0,1,1>(ifrom, ito, thr);
+        else eval<0,0,1>(ifrom, ito, thr);
+      }
+
+      data_reduce_thr(heatflow_thr, nall, nthreads, 1, tid);
+    } else {
+      if (evflag) {
+        if (force->newton_pair) eval<1,1,0>(ifrom, ito, thr);
+        else eval<1,0,0>(ifrom, ito, thr);
+      } else {
+        if (force->newton_pair) eval<0,1,0>(ifrom, ito, thr);
+        else eval<0,0,0>(ifrom, ito, thr);
+      }
+    }
+
+    thr->timer(Timer::PAIR);
+    reduce_thr(this, eflag, vflag, thr);
+  } // end of omp parallel region
+
+  if (heat_flag) {
+    double *heatflow = atom->heatflow;
+    for (int i = 0; i < nall; i++) heatflow[i] += heatflow_thr[i];
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int EVFLAG, int NEWTON_PAIR, int HEATFLAG>
+void PairGranularOMP::eval(int iifrom, int iito, ThrData * const thr)
+{
+  int i,j,k,ii,jj,jnum,itype,jtype;
+  double factor_lj,mi,mj,meff,dq;
+  double *forces,*torquesi,*torquesj;
+  int *jlist,*touch;
+  double *history,*allhistory;
+  GranularModel *model;
+
+  const double * const * const x = atom->x;
+  const double * const * const v = atom->v;
+  const double * const * const omega = atom->omega;
+  const double * const radius = atom->radius;
+  const double * const rmass = atom->rmass;
+  const double * const temperature = atom->temperature;
+  const int * const type = atom->type;
+  const int * const mask = atom->mask;
+  const int nlocal = atom->nlocal;
+  const int nall = nlocal + atom->nghost;
+  const double * const special_lj = force->special_lj;
+  double * const * const f = thr->get_f();
+  double * const * const torque = thr->get_torque();
+  double * const heatflow = HEATFLAG ? heatflow_thr + thr->get_tid()*nall : nullptr;
+
+  GranularModel ** const models = models_thr[thr->get_tid()];
+
+  const int * const ilist = list->ilist;
+  const int * const numneigh = list->numneigh;
+  int ** const firstneigh = list->firstneigh;
+  int ** const firsttouch = use_history ? fix_history->firstflag : nullptr;
+  double ** const firsthistory = use_history ? fix_history->firstvalue : nullptr;
+
+  touch = nullptr;
+  allhistory = nullptr;
+
+  // each thread owns the history rows of its own I atoms,
+  // so touch and history updates need no synchronization
+
+  for (ii = iifrom; ii < iito; ++ii) {
+    i = ilist[ii];
+    itype = type[i];
+    if (use_history) {
+      touch = firsttouch[i];
+      allhistory = firsthistory[i];
+    }
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      factor_lj = special_lj[sbmask(j)];
+      j &= NEIGHMASK;
+
+      if (factor_lj == 0) continue;
+
+      jtype = type[j];
+      model = models[types_indices[itype][jtype]];
+
+      // Reset model and copy initial geometric data
+      model->xi = (double *) x[i];
+      model->xj = (double *) x[j];
+      model->radi = radius[i];
+      model->radj = radius[j];
+      if (use_history) model->touch = touch[jj];
+
+      if (!model->check_contact()) {
+        // unset non-touching neighbors
+        if (use_history) {
+          touch[jj] = 0;
+          history = &allhistory[size_history * jj];
+          for (k = 0; k < size_history; k++) history[k] = 0.0;
+        }
+        continue;
+      }
+
+      if (use_history) touch[jj] = 1;
+
+      // meff = effective mass of pair of particles
+      // if I or J part of rigid body, use body mass
+      // if I or J is frozen, meff is other particle
+      mi = rmass[i];
+      mj = rmass[j];
+      if (fix_rigid) {
+        if (mass_rigid[i] > 0.0) mi = mass_rigid[i];
+        if (mass_rigid[j] > 0.0) mj = mass_rigid[j];
+      }
+      meff = mi * mj / (mi + mj);
+      if (mask[i] & freeze_group_bit) meff = mj;
+      if (mask[j] & freeze_group_bit) meff = mi;
+
+      // Copy additional information and prepare force calculations
+      model->meff = meff;
+      model->vi = (double *) v[i];
+      model->vj = (double *) v[j];
+      model->omegai = (double *) omega[i];
+      model->omegaj = (double *) omega[j];
+      if (use_history) model->history = &allhistory[size_history * jj];
+
+      if (HEATFLAG) {
+        model->Ti = temperature[i];
+        model->Tj = temperature[j];
+      }
+
+      model->calculate_forces();
+
+      forces = model->forces;
+      torquesi = model->torquesi;
+      torquesj = model->torquesj;
+
+      // apply forces & torques
+      scale3(factor_lj, forces);
+      add3(f[i], forces, f[i]);
+
+      scale3(factor_lj, torquesi);
+      add3(torque[i], torquesi, torque[i]);
+
+      if (NEWTON_PAIR || j < nlocal) {
+        sub3(f[j], forces, f[j]);
+        scale3(factor_lj, torquesj);
+        add3(torque[j], torquesj, torque[j]);
+      }
+
+      if (HEATFLAG) {
+        dq = model->dq;
+        heatflow[i] += dq;
+        if (NEWTON_PAIR || j < nlocal) heatflow[j] -= dq;
+      }
+
+      if (EVFLAG) ev_tally_xyz_thr(this,i,j,nlocal,NEWTON_PAIR,0.0,0.0,
+                                   forces[0],forces[1],forces[2],
+                                   model->dx[0],model->dx[1],model->dx[2],thr);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   mixed models are (re)created and the timestep is set here,
+   so the per-thread copies must be rebuilt before the next compute()
+------------------------------------------------------------------------- */
+
+double PairGranularOMP::init_one(int i, int j)
+{
+  models_stale = 1;
+  return PairGranular::init_one(i, j);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairGranularOMP::reset_dt()
+{
+  PairGranular::reset_dt();
+
+  for (int t = 0; t < nthreads_thr; t++)
+    for (int n = 0; n < nmodels_thr; n++)
+      models_thr[t][n]->dt = update->dt;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairGranularOMP::copy_models()
+{
+  destroy_models();
+
+  nthreads_thr = comm->nthreads;
+  nmodels_thr = nmodels;
+  models_thr = new GranularModel **[nthreads_thr];
+  for (int t = 0; t < nthreads_thr; t++) {
+    models_thr[t] = new GranularModel *[nmodels_thr];
+    for (int n = 0; n < nmodels_thr; n++) {
+      models_thr[t][n] = new GranularModel(Pointers::lmp);
+      models_thr[t][n]->copy_model(models_list[n]);
+    }
+  }
+
+  models_stale = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairGranularOMP::destroy_models()
+{
+  if (models_thr) {
+    for (int t = 0; t < nthreads_thr; t++) {
+      for (int n = 0; n < nmodels_thr; n++) delete models_thr[t][n];
+      delete[] models_thr[t];
+    }
+    delete[] models_thr;
+  }
+  models_thr = nullptr;
+  nthreads_thr = nmodels_thr = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairGranularOMP::memory_usage()
+{
+  double bytes = memory_usage_thr();
+  bytes += PairGranular::memory_usage();
+  bytes += (double) nmax_heat * sizeof(double);
+
+  return bytes;
+}
@@ -0,0 +1,60 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+// clang-format off
+PairStyle(granular/omp,PairGranularOMP);
+// clang-format on
+#else
+
+#ifndef LMP_PAIR_GRANULAR_OMP_H
+#define LMP_PAIR_GRANULAR_OMP_H
+
+#include "pair_granular.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairGranularOMP : public PairGranular, public ThrOMP {
+
+ public:
+  PairGranularOMP(class LAMMPS *);
+  ~PairGranularOMP() override;
+
+  void compute(int, int) override;
+  double init_one(int, int) override;
+  void reset_dt() override;
+  double memory_usage() override;
+
+ protected:
+  // per-thread copies of models_list, contact models keep per-contact state
+  class Granular_NS::GranularModel ***models_thr;
+  int nthreads_thr, nmodels_thr;
+  int models_stale;
+
+  // per-thread heat flow accumulators
+  double *heatflow_thr;
+  int nmax_heat;
+
+  void copy_models();
+  void destroy_models();
+
+ private:
+  template <int EVFLAG, int NEWTON_PAIR, int HEATFLAG>
+  void eval(int ifrom, int ito, ThrData *const thr);
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
@@ -0,0 +1,50 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+// clang-format off
+PairStyle(gw/omp,PairGWOMP);
+// clang-format on
+#else
+
+#ifndef LMP_PAIR_GW_OMP_H
+#define LMP_PAIR_GW_OMP_H
+
+#include "pair_gw.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairGWOMP : public PairGW, public ThrOMP {
+
+ public:
+  PairGWOMP(class LAMMPS *);
+  ~PairGWOMP() override;
+
+  void compute(int, int) override;
+  double memory_usage() override;
+
+ protected:
+  int nthreads;            // # of threads the buffers are allocated for
+  int *maxshort_buf;       // allocated length of each buffer
+  int **neighshort_buf;    // per-thread short neighbor list
+
+ private:
+  template <int EVFLAG, int EFLAG, int VFLAG_EITHER>
+  void eval(int ifrom, int ito, ThrData *const thr);
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
@@ -20,7 +20,6 @@
 
 #include "atom.h"
 #include "comm.h"
-#include "domain.h"
 #include "error.h"
 #include "fix_drude.h"
 #include "force.h"
@@ -62,6 +61,7 @@ PairLJCutTholeLongOMP::PairLJCutTholeLongOMP(LAMMPS *lmp) :
 void PairLJCutTholeLongOMP::compute(int eflag, int vflag)
 {
   ev_init(eflag,vflag);
+  fix_drude->check_drudelocal();
 
   const int nall = atom->nlocal + atom->nghost;
   const int nthreads = comm->nthreads;
@@ -108,7 +108,7 @@ void PairLJCutTholeLongOMP::eval(int iifrom, int iito, ThrData * const thr)
   const int * _noalias const numneigh = list->numneigh;
   const int * const * const firstneigh = list->firstneigh;
   const int * _noalias const drudetype = fix_drude->drudetype;
-  const tagint * _noalias const drudeid = fix_drude->drudeid;
+  const int * _noalias const drudelocal = fix_drude->drudelocal;
 
   double xtmp,ytmp,ztmp,delx,dely,delz,fxtmp,fytmp,fztmp;
 
@@ -120,7 +120,7 @@ void PairLJCutTholeLongOMP::eval(int iifrom, int iito, ThrData * const thr)
   double fraction,table;
   double grij,expm2,prefactor,t,erfc,u;
   double factor_f,factor_e;
-  int di,dj;
+  int dj;
   double qj,dqi,dqj,dcoul,asr,exp_asr;
   int di_closest;
   const double qqrd2e = force->qqrd2e;
@@ -148,11 +148,10 @@ void PairLJCutTholeLongOMP::eval(int iifrom, int iito, ThrData * const thr)
     fxtmp=fytmp=fztmp=0.;
 
     if (drudetype[type[i]] != NOPOL_TYPE) {
-      di = atom->map(drudeid[i]);
-      if (di < 0) error->all(FLERR, "Drude partner not found");
-      di_closest = domain->closest_image(i, di);
+      di_closest = drudelocal[i];
+      if (di_closest < 0) error->all(FLERR, "Drude partner not found");
       if (drudetype[type[i]] == CORE_TYPE)
-        dqi = -q[di];
+        dqi = -q[di_closest];
       else
         dqi = qi;
     }
@@ -206,7 +205,7 @@ void PairLJCutTholeLongOMP::eval(int iifrom, int iito, ThrData * const thr)
               drudetype[type[j]] != NOPOL_TYPE) {
             if (j != di_closest) {
               if (drudetype[type[j]] == CORE_TYPE) {
-                dj = atom->map(drudeid[j]);
+                dj = drudelocal[j];
                 dqj = -q[dj];
               } else dqj = qj;
               asr = ascreen[type[i]][type[j]] * r;
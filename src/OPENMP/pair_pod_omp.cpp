@@ -0,0 +1,218 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "pair_pod_omp.h"
+
+#include "atom.h"
+#include "comm.h"
+#include "force.h"
+#include "memory.h"
+#include "neigh_list.h"
+#include "suffix.h"
+#include "update.h"
+
+#include "eapod.h"
+
+#include "omp_compat.h"
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+PairPODOMP::PairPODOMP(LAMMPS *lmp) :
+  PairPOD(lmp), ThrOMP(lmp, THR_PAIR), nthreads_thr(0), nijmax_thr(0), ndbl_thr(0), ncb_thr(0),
+  tmpmem_thr(nullptr), tmpint_thr(nullptr), bd_thr(nullptr), cb_thr(nullptr), pd_thr(nullptr)
+{
+  suffix_flag |= Suffix::OMP;
+  respa_enable = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairPODOMP::~PairPODOMP()
+{
+  memory->destroy(tmpmem_thr);
+  memory->destroy(tmpint_thr);
+  memory->destroy(bd_thr);
+  memory->destroy(cb_thr);
+  memory->destroy(pd_thr);
+}
+
+/* ----------------------------------------------------------------------
+   grow per-thread scratch memory, one contiguous block per thread,
+   so that each thread can process up to nijmax pairs (i,j) per atom
+   the memory is kept between calls and only reallocated when the
+   number of pairs grows or the number of threads changes
+------------------------------------------------------------------------- */
+
+void PairPODOMP::grow_thr(int nijmax_new, int nthreads)
+{
+  if ((nijmax_new <= nijmax_thr) && (nthreads == nthreads_thr)) return;
+  nijmax_thr = MAX(nijmax_new, nijmax_thr);
+  nthreads_thr = nthreads;
+
+  memory->destroy(tmpmem_thr);
+  memory->destroy(tmpint_thr);
+  memory->destroy(bd_thr);
+  memory->destroy(cb_thr);
+  memory->destroy(pd_thr);
+
+  ndbl_thr = 6*nijmax_thr + fastpodptr->estimate_temp_memory(nijmax_thr);
+  ncb_thr = fastpodptr->estimate_coeff_memory();
+
+  memory->create(tmpmem_thr, nthreads, ndbl_thr, "pair:tmpmem_thr");
+  memory->create(tmpint_thr, nthreads, 4*nijmax_thr, "pair:tmpint_thr");
+  memory->create(bd_thr, nthreads, fastpodptr->Mdesc, "pair:bd_thr");
+  memory->create(cb_thr, nthreads, ncb_thr, "pair:cb_thr");
+  memory->create(pd_thr, nthreads, fastpodptr->nClusters, "pair:pd_thr");
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairPODOMP::compute(int eflag, int vflag)
+{
+  ev_init(eflag,vflag);
+
+  const int nall = atom->nlocal + atom->nghost;
+  const int nthreads = comm->nthreads;
+  const int inum = list->inum;
+  const int * const ilist = list->ilist;
+  const int * const numneigh = list->numneigh;
+
+  // size per-thread scratch for the largest neighbor count
+
+  int jnummax = 1;
+  for (int ii = 0; ii < inum; ii++) jnummax = MAX(jnummax, numneigh[ilist[ii]]);
+  grow_thr(jnummax, nthreads);
+
+  if (desc_flag) grow_descriptors();
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(eflag,vflag)
+#endif
+  {
+    int ifrom, ito, tid;
+
+    loop_setup_thr(ifrom, ito, tid, inum, nthreads);
+    ThrData *thr = fix->get_thr(tid);
+    thr->timer(Timer::START);
+    ev_setup_thr(eflag, vflag, nall, eatom, vatom, nullptr, thr);
+
+    if (evflag) {
+      if (vflag_either) eval<1,1>(ifrom, ito, thr);
+      else eval<1,0>(ifrom, ito, thr);
+    } else eval<0,0>(ifrom, ito, thr);
+
+    thr->timer(Timer::PAIR);
+    reduce_thr(this, eflag, vflag, thr);
+  } // end of omp parallel region
+
+  if (desc_flag) desc_step = update->ntimestep;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int EVFLAG, int VFLAG>
+void PairPODOMP::eval(int iifrom, int iito, ThrData * const thr)
+{
+  const int tid = thr->get_tid();
+  const auto * _noalias const x = (dbl3_t *) atom->x[0];
+  auto * _noalias const f = (dbl3_t *) thr->get_f()[0];
+  const int * _noalias const type = atom->type;
+  const int nlocal = atom->nlocal;
+  const int newton_pair = force->newton_pair;
+  const double rcutsq = rcut*rcut;
+
+  const int * const ilist = list->ilist;
+  const int * const numneigh = list->numneigh;
+  int ** const firstneigh = list->firstneigh;
+
+  double *rij1 = &tmpmem_thr[tid][0];
+  double *fij1 = &tmpmem_thr[tid][3*nijmax_thr];
+  double *tmp = &tmpmem_thr[tid][6*nijmax_thr];
+  int *aj1 = &tmpint_thr[tid][0];
+  int *ti1 = &tmpint_thr[tid][nijmax_thr];
+  int *tj1 = &tmpint_thr[tid][2*nijmax_thr];
+  double *bd1 = bd_thr[tid];
+  double *cb1 = cb_thr[tid];
+  double *pd1 = pd_thr[tid];
+
+  for (int ii = iifrom; ii < iito; ++ii) {
+    const int i = ilist[ii];
+    const int * const jlist = firstneigh[i];
+    const int jnum = numneigh[i];
+    const double xtmp = x[i].x;
+    const double ytmp = x[i].y;
+    const double ztmp = x[i].z;
+    const int itype = map[type[i]] + 1;
+
+    // build the list of pairs (i,j) within the cutoff
+
+    int nij1 = 0;
+    ti1[0] = itype;
+    for (int jj = 0; jj < jnum; jj++) {
+      const int j = jlist[jj] & NEIGHMASK;
+      const double delx = x[j].x - xtmp;
+      const double dely = x[j].y - ytmp;
+      const double delz = x[j].z - ztmp;
+      const double rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq < rcutsq && rsq > 1e-20) {
+        rij1[3*nij1 + 0] = delx;
+        rij1[3*nij1 + 1] = dely;
+        rij1[3*nij1 + 2] = delz;
+        aj1[nij1] = j;
+        ti1[nij1] = itype;
+        tj1[nij1] = map[type[j]] + 1;
+        nij1++;
+      }
+    }
+
+    const double evdwl = fastpodptr->peratomenergyforce2(fij1, rij1, tmp, bd1, cb1, pd1,
+                                                         ti1, tj1, nij1);
+    if (desc_flag) store_descriptors(i, bd1, pd1, nij1);
+
+    if (EVFLAG) ev_tally_full_thr(this, i, 2.0*evdwl, 0.0, 0.0, 0.0, 0.0, 0.0, thr);
+
+    double fxtmp = 0.0, fytmp = 0.0, fztmp = 0.0;
+    for (int jj = 0; jj < nij1; jj++) {
+      const int j = aj1[jj];
+      const double fx = fij1[3*jj + 0];
+      const double fy = fij1[3*jj + 1];
+      const double fz = fij1[3*jj + 2];
+      fxtmp += fx;
+      fytmp += fy;
+      fztmp += fz;
+      f[j].x -= fx;
+      f[j].y -= fy;
+      f[j].z -= fz;
+
+      if (VFLAG)
+        ev_tally_xyz_thr(this, i, j, nlocal, newton_pair, 0.0, 0.0, fx, fy, fz,
+                         -rij1[3*jj + 0], -rij1[3*jj + 1], -rij1[3*jj + 2], thr);
+    }
+    f[i].x += fxtmp;
+    f[i].y += fytmp;
+    f[i].z += fztmp;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairPODOMP::memory_usage()
+{
+  double bytes = memory_usage_thr();
+  bytes += PairPOD::memory_usage();
+  const int nthreads = nthreads_thr;
+  bytes += (double) nthreads * ndbl_thr * sizeof(double);
+  bytes += (double) nthreads * 4 * nijmax_thr * sizeof(int);
+  bytes += (double) nthreads * (ncb_thr + fastpodptr->Mdesc + fastpodptr->nClusters) * sizeof(double);
+
+  return bytes;
+}
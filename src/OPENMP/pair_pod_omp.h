@@ -0,0 +1,55 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+// clang-format off
+PairStyle(pod/omp,PairPODOMP);
+// clang-format on
+#else
+
+#ifndef LMP_PAIR_POD_OMP_H
+#define LMP_PAIR_POD_OMP_H
+
+#include "pair_pod.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairPODOMP : public PairPOD, public ThrOMP {
+
+ public:
+  PairPODOMP(class LAMMPS *);
+  ~PairPODOMP() override;
+
+  void compute(int, int) override;
+  double memory_usage() override;
+
+ private:
+  int nthreads_thr;      // number of threads the per-thread scratch is allocated for
+  int nijmax_thr;        // max number of pairs (i,j) the per-thread scratch is sized for
+  int ndbl_thr;          // doubles of per-thread scratch
+  int ncb_thr;           // doubles of per-thread coefficient scratch
+  double **tmpmem_thr;   // per-thread rij, fij, and EAPOD work memory
+  int **tmpint_thr;      // per-thread ai, aj, ti, tj
+  double **bd_thr;       // per-thread base descriptors
+  double **cb_thr;       // per-thread descriptor coefficients
+  double **pd_thr;       // per-thread environment probabilities
+
+  void grow_thr(int, int);
+  template <int EVFLAG, int VFLAG> void eval(int ifrom, int ito, ThrData *const thr);
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
@@ -0,0 +1,458 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "pair_polymorphic_omp.h"
+
+#include "atom.h"
+#include "comm.h"
+#include "memory.h"
+#include "neigh_list.h"
+#include "suffix.h"
+#include "tabular_function.h"
+
+#include <cmath>
+
+#include "omp_compat.h"
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+PairPolymorphicOMP::PairPolymorphicOMP(LAMMPS *lmp) :
+  PairPolymorphic(lmp), ThrOMP(lmp, THR_PAIR)
+{
+  suffix_flag |= Suffix::OMP;
+  respa_enable = 0;
+
+  nthreads = 0;
+  neighbuf = nullptr;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairPolymorphicOMP::~PairPolymorphicOMP()
+{
+  free_neighbuf();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairPolymorphicOMP::free_neighbuf()
+{
+  for (int i = 0; i < nthreads; ++i) {
+    memory->destroy(neighbuf[i].neighV);
+    memory->destroy(neighbuf[i].neighW);
+    memory->destroy(neighbuf[i].neighW1);
+    memory->destroy(neighbuf[i].delV);
+    memory->destroy(neighbuf[i].delW);
+  }
+  delete[] neighbuf;
+  neighbuf = nullptr;
+  nthreads = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairPolymorphicOMP::compute(int eflag, int vflag)
+{
+  ev_init(eflag,vflag);
+
+  const int nall = atom->nlocal + atom->nghost;
+  const int inum = list->inum;
+
+  // per-thread neighbor sublists are kept between calls and only grow
+
+  if (nthreads != comm->nthreads) {
+    free_neighbuf();
+    nthreads = comm->nthreads;
+    neighbuf = new NeighBuf[nthreads];
+    for (int i = 0; i < nthreads; ++i) {
+      neighbuf[i].maxneigh = 0;
+      neighbuf[i].neighV = neighbuf[i].neighW = neighbuf[i].neighW1 = nullptr;
+      neighbuf[i].delV = neighbuf[i].delW = nullptr;
+    }
+  }
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(eflag,vflag)
+#endif
+  {
+    int ifrom, ito, tid;
+
+    loop_setup_thr(ifrom, ito, tid, inum, nthreads);
+    ThrData *thr = fix->get_thr(tid);
+    thr->timer(Timer::START);
+    ev_setup_thr(eflag, vflag, nall, eatom, vatom, nullptr, thr);
+
+    if (evflag) {
+      if (eflag) {
+        if (vflag_either) eval<1,1,1>(ifrom, ito, thr);
+        else eval<1,1,0>(ifrom, ito, thr);
+      } else {
+        if (vflag_either) eval<1,0,1>(ifrom, ito, thr);
+        else eval<1,0,0>(ifrom, ito, thr);
+      }
+    } else eval<0,0,0>(ifrom, ito, thr);
+
+    thr->timer(Timer::PAIR);
+    reduce_thr(this, eflag, vflag, thr);
+  } // end of omp parallel region
+}
+
+/* ----------------------------------------------------------------------
+   the V and W neighbor sublists of the serial version are class members,
+   here each thread keeps its own copy with x,y,z,r packed per neighbor,
+   which is reused in the next call
+------------------------------------------------------------------------- */
+
+template <int EVFLAG, int EFLAG, int VFLAG_EITHER>
+void PairPolymorphicOMP::eval(int iifrom, int iito, ThrData * const thr)
+{
+  tagint itag,jtag;
+  int i,j,k,ii,jj,kk,kk1,jnum;
+  int itype,jtype,ktype;
+  int iparam_ii,iparam_jj,iparam_kk,iparam_ij,iparam_ik,iparam_ijk;
+  double xtmp,ytmp,ztmp,delx,dely,delz,evdwl,fpair;
+  double rsq,r0,r1,r2;
+  double delr1[3],delr2[3],fi[3],fj[3],fk[3];
+  double zeta_ij,prefactor,wfac,pfac,gfac,fa,fa_d,bij,bij_d;
+  double costheta;
+  int *ilist,*jlist,*numneigh,**firstneigh;
+  double emb = 0.0;
+
+  int maxneigh_thr,numneighV_thr,numneighW_thr,numneighW1_thr;
+  int *neighV_thr,*neighW_thr,*neighW1_thr;
+  double *delV_thr,*delW_thr;
+
+  evdwl = 0.0;
+  delx = dely = delz = 0.0;
+
+  const auto * _noalias const x = (dbl3_t *) atom->x[0];
+  auto * _noalias const f = (dbl3_t *) thr->get_f()[0];
+  const tagint * _noalias const tag = atom->tag;
+  const int * _noalias const type = atom->type;
+  const int nlocal = atom->nlocal;
+
+  ilist = list->ilist;
+  numneigh = list->numneigh;
+  firstneigh = list->firstneigh;
+
+  NeighBuf &buf = neighbuf[thr->get_tid()];
+  maxneigh_thr = buf.maxneigh;
+  neighV_thr = buf.neighV;
+  neighW_thr = buf.neighW;
+  neighW1_thr = buf.neighW1;
+  delV_thr = buf.delV;
+  delW_thr = buf.delW;
+
+  double fxtmp,fytmp,fztmp;
+
+  // loop over full neighbor list of my atoms
+
+  for (ii = iifrom; ii < iito; ++ii) {
+
+    i = ilist[ii];
+    itag = tag[i];
+    itype = map[type[i]];
+    xtmp = x[i].x;
+    ytmp = x[i].y;
+    ztmp = x[i].z;
+    fxtmp = fytmp = fztmp = 0.0;
+
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    if (maxneigh_thr < jnum) {
+      maxneigh_thr = jnum + 20;
+      memory->grow(neighV_thr,maxneigh_thr,"pair_thr:neighV_thr");
+      memory->grow(neighW_thr,maxneigh_thr,"pair_thr:neighW_thr");
+      memory->grow(neighW1_thr,maxneigh_thr,"pair_thr:neighW1_thr");
+      memory->grow(delV_thr,4*maxneigh_thr,"pair_thr:delV_thr");
+      memory->grow(delW_thr,4*maxneigh_thr,"pair_thr:delW_thr");
+    }
+
+    if (eta == 1) {
+      iparam_ii = elem2param[itype][itype];
+      PairParameters &p = pairParameters[iparam_ii];
+      emb = (p.F)->get_vmax();
+    }
+
+    numneighV_thr = 0;
+    numneighW_thr = 0;
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      j &= NEIGHMASK;
+      jtype = map[type[j]];
+
+      delx = xtmp - x[j].x;
+      dely = ytmp - x[j].y;
+      delz = ztmp - x[j].z;
+      rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq >= cutmaxsq) continue;
+      r0 = sqrt(rsq);
+
+      iparam_ij = elem2param[itype][jtype];
+      PairParameters &p = pairParameters[iparam_ij];
+
+      // do not include the neighbor if get_vmax() <= epsilon because the function is near zero
+
+      if (eta == 1) {
+        if (emb > epsilon) {
+          iparam_jj = elem2param[jtype][jtype];
+          PairParameters &q = pairParameters[iparam_jj];
+          if (rsq < (q.W)->get_xmaxsq() && (q.W)->get_vmax() > epsilon) {
+            double * const dW = delW_thr + 4*numneighW_thr;
+            dW[0] = delx;
+            dW[1] = dely;
+            dW[2] = delz;
+            dW[3] = r0;
+            neighW_thr[numneighW_thr++] = j;
+          }
+        }
+      } else {
+        if ((p.F)->get_vmax() > epsilon) {
+          if (rsq < (p.V)->get_xmaxsq() && (p.V)->get_vmax() > epsilon) {
+            double * const dV = delV_thr + 4*numneighV_thr;
+            dV[0] = delx;
+            dV[1] = dely;
+            dV[2] = delz;
+            dV[3] = r0;
+            neighV_thr[numneighV_thr++] = j;
+          }
+          if (rsq < (p.W)->get_xmaxsq() && (p.W)->get_vmax() > epsilon) {
+            double * const dW = delW_thr + 4*numneighW_thr;
+            dW[0] = delx;
+            dW[1] = dely;
+            dW[2] = delz;
+            dW[3] = r0;
+            neighW_thr[numneighW_thr++] = j;
+          }
+        }
+      }
+
+      // two-body interactions, skip half of them
+
+      jtag = tag[j];
+      if (itag > jtag) {
+        if ((itag+jtag) % 2 == 0) continue;
+      } else if (itag < jtag) {
+        if ((itag+jtag) % 2 == 1) continue;
+      } else {
+        if (x[j].z < ztmp) continue;
+        if (x[j].z == ztmp && x[j].y < ytmp) continue;
+        if (x[j].z == ztmp && x[j].y == ytmp && x[j].x < xtmp) continue;
+      }
+
+      if (rsq >= (p.U)->get_xmaxsq() || (p.U)->get_vmax() <= epsilon) continue;
+      (p.U)->value(r0,evdwl,EFLAG,fpair,1);
+      fpair = -fpair/r0;
+
+      fxtmp += delx*fpair;
+      fytmp += dely*fpair;
+      fztmp += delz*fpair;
+      f[j].x -= delx*fpair;
+      f[j].y -= dely*fpair;
+      f[j].z -= delz*fpair;
+
+      if (EVFLAG) ev_tally_thr(this,i,j,nlocal,/* newton_pair */ 1,
+                               evdwl,0.0,fpair,delx,dely,delz,thr);
+    }
+
+    if (eta == 1) {
+
+      if (emb > epsilon) {
+
+        iparam_ii = elem2param[itype][itype];
+        PairParameters &p = pairParameters[iparam_ii];
+
+        // accumulate bondorder zeta for each i-j interaction via loop over k
+
+        zeta_ij = 0.0;
+
+        for (kk = 0; kk < numneighW_thr; kk++) {
+          k = neighW_thr[kk];
+          ktype = map[type[k]];
+
+          iparam_kk = elem2param[ktype][ktype];
+          PairParameters &q = pairParameters[iparam_kk];
+
+          (q.W)->value(delW_thr[4*kk+3],wfac,1,fpair,0);
+
+          zeta_ij += wfac;
+        }
+
+        // pairwise force due to zeta
+
+        (p.F)->value(zeta_ij,bij,1,bij_d,1);
+
+        prefactor = 0.5* bij_d;
+        if (EFLAG) evdwl = -0.5*bij;
+
+        if (EVFLAG) ev_tally_thr(this,i,i,nlocal,/* newton_pair */ 1,
+                                 evdwl,0.0,0.0,delx,dely,delz,thr);
+
+        // attractive term via loop over k
+
+        for (kk = 0; kk < numneighW_thr; kk++) {
+          k = neighW_thr[kk];
+          ktype = map[type[k]];
+
+          delr2[0] = -delW_thr[4*kk];
+          delr2[1] = -delW_thr[4*kk+1];
+          delr2[2] = -delW_thr[4*kk+2];
+          r2 = delW_thr[4*kk+3];
+
+          iparam_kk = elem2param[ktype][ktype];
+          PairParameters &q = pairParameters[iparam_kk];
+
+          (q.W)->value(r2,wfac,0,fpair,1);
+          fpair = -prefactor*fpair/r2;
+
+          fxtmp += delr2[0]*fpair;
+          fytmp += delr2[1]*fpair;
+          fztmp += delr2[2]*fpair;
+          f[k].x -= delr2[0]*fpair;
+          f[k].y -= delr2[1]*fpair;
+          f[k].z -= delr2[2]*fpair;
+
+          if (VFLAG_EITHER) v_tally2_thr(this,i,k,-fpair,delr2,thr);
+        }
+      }
+
+    } else {
+
+      double fjxtmp,fjytmp,fjztmp;
+
+      for (jj = 0; jj < numneighV_thr; jj++) {
+        j = neighV_thr[jj];
+        jtype = map[type[j]];
+
+        iparam_ij = elem2param[itype][jtype];
+        PairParameters &p = pairParameters[iparam_ij];
+
+        delr1[0] = -delV_thr[4*jj];
+        delr1[1] = -delV_thr[4*jj+1];
+        delr1[2] = -delV_thr[4*jj+2];
+        r1 = delV_thr[4*jj+3];
+
+        fjxtmp = fjytmp = fjztmp = 0.0;
+
+        // accumulate bondorder zeta for each i-j interaction via loop over k
+
+        zeta_ij = 0.0;
+
+        numneighW1_thr = 0;
+        for (kk = 0; kk < numneighW_thr; kk++) {
+          k = neighW_thr[kk];
+          if (j == k) continue;
+          ktype = map[type[k]];
+          iparam_ijk = elem3param[jtype][itype][ktype];
+          TripletParameters &trip = tripletParameters[iparam_ijk];
+          if ((trip.G)->get_vmax() <= epsilon) continue;
+
+          neighW1_thr[numneighW1_thr++] = kk;
+
+          delr2[0] = -delW_thr[4*kk];
+          delr2[1] = -delW_thr[4*kk+1];
+          delr2[2] = -delW_thr[4*kk+2];
+          r2 = delW_thr[4*kk+3];
+
+          costheta = (delr1[0]*delr2[0] + delr1[1]*delr2[1] +
+                      delr1[2]*delr2[2]) / (r1*r2);
+
+          iparam_ik = elem2param[itype][ktype];
+          PairParameters &q = pairParameters[iparam_ik];
+
+          (q.W)->value(r2,wfac,1,fpair,0);
+          (trip.P)->value(r1-(p.xi)*r2,pfac,1,fpair,0);
+          (trip.G)->value(costheta,gfac,1,fpair,0);
+
+          zeta_ij += wfac*pfac*gfac;
+        }
+
+        // pairwise force due to zeta
+
+        (p.V)->value(r1,fa,1,fa_d,1);
+        (p.F)->value(zeta_ij,bij,1,bij_d,1);
+        fpair = -0.5*bij*fa_d / r1;
+        prefactor = 0.5* fa * bij_d;
+        if (EFLAG) evdwl = -0.5*bij*fa;
+
+        fxtmp += delr1[0]*fpair;
+        fytmp += delr1[1]*fpair;
+        fztmp += delr1[2]*fpair;
+        fjxtmp -= delr1[0]*fpair;
+        fjytmp -= delr1[1]*fpair;
+        fjztmp -= delr1[2]*fpair;
+
+        if (EVFLAG) ev_tally_thr(this,i,j,nlocal,/* newton_pair */ 1,evdwl,0.0,
+                                 -fpair,-delr1[0],-delr1[1],-delr1[2],thr);
+
+        // attractive term via loop over k
+
+        for (kk1 = 0; kk1 < numneighW1_thr; kk1++) {
+          kk = neighW1_thr[kk1];
+          k = neighW_thr[kk];
+          ktype = map[type[k]];
+          iparam_ijk = elem3param[jtype][itype][ktype];
+          TripletParameters &trip = tripletParameters[iparam_ijk];
+
+          delr2[0] = -delW_thr[4*kk];
+          delr2[1] = -delW_thr[4*kk+1];
+          delr2[2] = -delW_thr[4*kk+2];
+          r2 = delW_thr[4*kk+3];
+
+          iparam_ik = elem2param[itype][ktype];
+          PairParameters &q = pairParameters[iparam_ik];
+
+          attractive(&p,&q,&trip,prefactor,r1,r2,delr1,delr2,fi,fj,fk);
+
+          fxtmp += fi[0];
+          fytmp += fi[1];
+          fztmp += fi[2];
+          fjxtmp += fj[0];
+          fjytmp += fj[1];
+          fjztmp += fj[2];
+          f[k].x += fk[0];
+          f[k].y += fk[1];
+          f[k].z += fk[2];
+
+          if (VFLAG_EITHER) v_tally3_thr(this,i,j,k,fj,fk,delr1,delr2,thr);
+        }
+        f[j].x += fjxtmp;
+        f[j].y += fjytmp;
+        f[j].z += fjztmp;
+      }
+    }
+    f[i].x += fxtmp;
+    f[i].y += fytmp;
+    f[i].z += fztmp;
+  }
+
+  buf.maxneigh = maxneigh_thr;
+  buf.neighV = neighV_thr;
+  buf.neighW = neighW_thr;
+  buf.neighW1 = neighW1_thr;
+  buf.delV = delV_thr;
+  buf.delW = delW_thr;
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairPolymorphicOMP::memory_usage()
+{
+  double bytes = memory_usage_thr();
+  bytes += PairPolymorphic::memory_usage();
+  for (int i = 0; i < nthreads; ++i)
+    bytes += (double)neighbuf[i].maxneigh * (3*sizeof(int) + 8*sizeof(double));
+
+  return bytes;
+}
@@ -0,0 +1,56 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+// clang-format off
+PairStyle(polymorphic/omp,PairPolymorphicOMP);
+// clang-format on
+#else
+
+#ifndef LMP_PAIR_POLYMORPHIC_OMP_H
+#define LMP_PAIR_POLYMORPHIC_OMP_H
+
+#include "pair_polymorphic.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairPolymorphicOMP : public PairPolymorphic, public ThrOMP {
+
+ public:
+  PairPolymorphicOMP(class LAMMPS *);
+  ~PairPolymorphicOMP() override;
+
+  void compute(int, int) override;
+  double memory_usage() override;
+
+ protected:
+  struct NeighBuf {
+    int maxneigh;                  // allocated # of neighbors
+    int *neighV, *neighW, *neighW1;
+    double *delV, *delW;           // x,y,z,r of each neighbor
+  };
+  NeighBuf *neighbuf;    // per-thread neighbor sublists
+  int nthreads;          // # of threads neighbuf is allocated for
+
+  void free_neighbuf();
+
+ private:
+  template <int EVFLAG, int EFLAG, int VFLAG_EITHER>
+  void eval(int ifrom, int ito, ThrData *const thr);
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
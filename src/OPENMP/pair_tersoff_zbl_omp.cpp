@@ -200,29 +200,23 @@ void PairTersoffZBLOMP::read_file(char *file)
 
 /* ---------------------------------------------------------------------- */
 
-void PairTersoffZBLOMP::force_zeta(Param *param, double rsq, double zeta_ij,
-                                   double &fforce, double &prefactor,
-                                   int eflag, double &eng)
+double PairTersoffZBLOMP::ters_fa(double r, Param *param)
 {
-  double r,fa,fa_d,bij;
-
-  r = sqrt(rsq);
-
-  fa = (r > param->bigr + param->bigd) ? 0.0 :
-    -param->bigb * exp(-param->lam2 * r) * ters_fc(r,param) *
+  if (r > param->bigr + param->bigd) return 0.0;
+  return -param->bigb * exp(-param->lam2 * r) * ters_fc(r,param) *
     F_fermi(r,param->ZBLexpscale,param->ZBLcut);
+}
 
-  fa_d = (r > param->bigr + param->bigd) ? 0.0 :
-    param->bigb * exp(-param->lam2 * r) *
+/* ---------------------------------------------------------------------- */
+
+double PairTersoffZBLOMP::ters_fa_d(double r, Param *param)
+{
+  if (r > param->bigr + param->bigd) return 0.0;
+  return param->bigb * exp(-param->lam2 * r) *
     (param->lam2 * ters_fc(r,param) *
      F_fermi(r,param->ZBLexpscale,param->ZBLcut) -
      ters_fc_d(r,param) * F_fermi(r,param->ZBLexpscale,param->ZBLcut)
      - ters_fc(r,param) * F_fermi_d(r,param->ZBLexpscale,param->ZBLcut));
-
-  bij = ters_bij(zeta_ij,param);
-  fforce = 0.5*bij*fa_d;
-  prefactor = -0.5*fa * ters_bij_d(zeta_ij,param);
-  if (eflag) eng = 0.5*bij*fa;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -34,7 +34,8 @@ class PairTersoffZBLOMP : public PairTersoffOMP {
 
   void read_file(char *) override;
   void repulsive(Param *, double, double &, int, double &) override;
-  void force_zeta(Param *, double, double, double &, double &, int, double &) override;
+  double ters_fa(double, Param *) override;
+  double ters_fa_d(double, Param *) override;
 };
 
 }    // namespace LAMMPS_NS
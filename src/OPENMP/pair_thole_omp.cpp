@@ -0,0 +1,193 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "pair_thole_omp.h"
+
+#include "atom.h"
+#include "comm.h"
+#include "fix_drude.h"
+#include "force.h"
+#include "neigh_list.h"
+#include "suffix.h"
+
+#include <cmath>
+
+#include "omp_compat.h"
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+PairTholeOMP::PairTholeOMP(LAMMPS *lmp) :
+    PairThole(lmp), ThrOMP(lmp, THR_PAIR)
+{
+  suffix_flag |= Suffix::OMP;
+  respa_enable = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairTholeOMP::compute(int eflag, int vflag)
+{
+  ev_init(eflag,vflag);
+  fix_drude->check_drudelocal();
+
+  const int nall = atom->nlocal + atom->nghost;
+  const int nthreads = comm->nthreads;
+  const int inum = list->inum;
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(eflag,vflag)
+#endif
+  {
+    int ifrom, ito, tid;
+
+    loop_setup_thr(ifrom, ito, tid, inum, nthreads);
+    ThrData *thr = fix->get_thr(tid);
+    thr->timer(Timer::START);
+    ev_setup_thr(eflag, vflag, nall, eatom, vatom, nullptr, thr);
+
+    if (evflag) {
+      if (eflag) {
+        if (force->newton_pair) eval<1,1,1>(ifrom, ito, thr);
+        else eval<1,1,0>(ifrom, ito, thr);
+      } else {
+        if (force->newton_pair) eval<1,0,1>(ifrom, ito, thr);
+        else eval<1,0,0>(ifrom, ito, thr);
+      }
+    } else {
+      if (force->newton_pair) eval<0,0,1>(ifrom, ito, thr);
+      else eval<0,0,0>(ifrom, ito, thr);
+    }
+    thr->timer(Timer::PAIR);
+    reduce_thr(this, eflag, vflag, thr);
+  } // end of omp parallel region
+}
+
+template <int EVFLAG, int EFLAG, int NEWTON_PAIR>
+void PairTholeOMP::eval(int iifrom, int iito, ThrData * const thr)
+{
+  const auto * _noalias const x = (dbl3_t *) atom->x[0];
+  auto * _noalias const f = (dbl3_t *) thr->get_f()[0];
+  const double * _noalias const q = atom->q;
+  const int * _noalias const type = atom->type;
+  const double * _noalias const special_coul = force->special_coul;
+  const int * _noalias const ilist = list->ilist;
+  const int * _noalias const numneigh = list->numneigh;
+  const int * const * const firstneigh = list->firstneigh;
+  const int * _noalias const drudetype = fix_drude->drudetype;
+  const int * _noalias const drudelocal = fix_drude->drudelocal;
+
+  double xtmp,ytmp,ztmp,delx,dely,delz,fxtmp,fytmp,fztmp;
+  double r,rsq,r2inv,rinv,factor_coul,factor_f,factor_e;
+  double qi,qj,ecoul,fpair,dcoul,asr,exp_asr;
+  int j,jj,jnum,jtype,di,dj;
+
+  const int nlocal = atom->nlocal;
+  const double qqrd2e = force->qqrd2e;
+
+  ecoul = factor_e = 0.0;
+
+  // loop over neighbors of my atoms
+
+  for (int ii = iifrom; ii < iito; ++ii) {
+    const int i = ilist[ii];
+
+    // only on core-drude pair
+    if (drudetype[type[i]] == NOPOL_TYPE)
+      continue;
+
+    // get dq of the core via the drude charge
+    di = drudelocal[i];
+    if (drudetype[type[i]] == DRUDE_TYPE)
+      qi = q[i];
+    else
+      qi = -q[di];
+
+    const int itype = type[i];
+    const int * _noalias const jlist = firstneigh[i];
+    const double * _noalias const cutsqi = cutsq[itype];
+    const double * _noalias const scalei = scale[itype];
+    const double * _noalias const ascreeni = ascreen[itype];
+
+    xtmp = x[i].x;
+    ytmp = x[i].y;
+    ztmp = x[i].z;
+    jnum = numneigh[i];
+    fxtmp=fytmp=fztmp=0.0;
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      factor_coul = special_coul[sbmask(j)];
+      j &= NEIGHMASK;
+
+      // only on core-drude pair, but not into the same pair
+      if (drudetype[type[j]] == NOPOL_TYPE || j == di)
+        continue;
+
+      // get dq of the core via the drude charge
+      if (drudetype[type[j]] == DRUDE_TYPE)
+        qj = q[j];
+      else {
+        dj = drudelocal[j];
+        qj = -q[dj];
+      }
+
+      delx = xtmp - x[j].x;
+      dely = ytmp - x[j].y;
+      delz = ztmp - x[j].z;
+      rsq = delx*delx + dely*dely + delz*delz;
+      jtype = type[j];
+
+      if (rsq < cutsqi[jtype]) {
+        r2inv = 1.0/rsq;
+        rinv = sqrt(r2inv);
+
+        r = sqrt(rsq);
+        asr = ascreeni[jtype] * r;
+        exp_asr = exp(-asr);
+        dcoul = qqrd2e * qi * qj * scalei[jtype] * rinv;
+        factor_f = 0.5*(2.0 + (exp_asr * (-2.0 - asr * (2.0 + asr)))) - factor_coul;
+        if (EFLAG) factor_e = 0.5*(2.0 - (exp_asr * (2.0 + asr))) - factor_coul;
+        fpair = factor_f * dcoul * r2inv;
+
+        fxtmp += delx*fpair;
+        fytmp += dely*fpair;
+        fztmp += delz*fpair;
+        if (NEWTON_PAIR || j < nlocal) {
+          f[j].x -= delx*fpair;
+          f[j].y -= dely*fpair;
+          f[j].z -= delz*fpair;
+        }
+
+        if (EFLAG) ecoul = factor_e * dcoul;
+
+        if (EVFLAG) ev_tally_thr(this,i,j,nlocal,NEWTON_PAIR,
+                                 0.0,ecoul,fpair,delx,dely,delz,thr);
+      }
+    }
+    f[i].x += fxtmp;
+    f[i].y += fytmp;
+    f[i].z += fztmp;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairTholeOMP::memory_usage()
+{
+  double bytes = memory_usage_thr();
+  bytes += PairThole::memory_usage();
+
+  return bytes;
+}
@@ -0,0 +1,495 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "pair_uf3_omp.h"
+
+#include "atom.h"
+#include "comm.h"
+#include "math_const.h"
+#include "memory.h"
+#include "neigh_list.h"
+#include "suffix.h"
+
+#include <cmath>
+
+#include "omp_compat.h"
+using namespace LAMMPS_NS;
+using MathConst::THIRD;
+
+/* ----------------------------------------------------------------------
+   evaluate the 4 non-zero cubic B-spline basis functions at r from a
+   flat table of cached constants with stride 16 per basis function
+------------------------------------------------------------------------- */
+
+static inline void basis3(const double *c, const int knot, const double r, const double rsq,
+                          const double rth, double *b)
+{
+  const double *c0 = c + 16*(knot - 3);
+  const double *c1 = c + 16*(knot - 2);
+  const double *c2 = c + 16*(knot - 1);
+  const double *c3 = c + 16*knot;
+  b[0] = c0[12] + r*c0[13] + rsq*c0[14] + rth*c0[15];
+  b[1] = c1[8] + r*c1[9] + rsq*c1[10] + rth*c1[11];
+  b[2] = c2[4] + r*c2[5] + rsq*c2[6] + rth*c2[7];
+  b[3] = c3[0] + r*c3[1] + rsq*c3[2] + rth*c3[3];
+}
+
+/* ----------------------------------------------------------------------
+   evaluate the 3 non-zero quadratic B-spline basis functions of the
+   derivative at r from a flat table with stride 9 per basis function
+------------------------------------------------------------------------- */
+
+static inline void basis2(const double *c, const int knot, const double r, const double rsq,
+                          double *b)
+{
+  const double *c0 = c + 9*(knot - 3);
+  const double *c1 = c + 9*(knot - 2);
+  const double *c2 = c + 9*(knot - 1);
+  b[0] = c0[6] + r*c0[7] + rsq*c0[8];
+  b[1] = c1[3] + r*c1[4] + rsq*c1[5];
+  b[2] = c2[0] + r*c2[1] + rsq*c2[2];
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairUF3OMP::PairUF3OMP(LAMMPS *lmp) :
+  PairUF3(lmp), ThrOMP(lmp, THR_PAIR)
+{
+  suffix_flag |= Suffix::OMP;
+  respa_enable = 0;
+
+  nthreads_thr = 0;
+  short_thr = nullptr;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairUF3OMP::~PairUF3OMP()
+{
+  for (int i = 0; i < nthreads_thr; ++i) destroy_short(short_thr[i]);
+  delete[] short_thr;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairUF3OMP::compute(int eflag, int vflag)
+{
+  ev_init(eflag,vflag);
+
+  const int nall = atom->nlocal + atom->nghost;
+  const int nthreads = comm->nthreads;
+  const int inum = list->inum;
+  const int uniform = (knot_spacing_type_2b[1][1] == 0);
+
+  // per-thread short lists are kept between calls and only grow
+
+  if (nthreads_thr != nthreads) {
+    for (int i = 0; i < nthreads_thr; ++i) destroy_short(short_thr[i]);
+    delete[] short_thr;
+    nthreads_thr = nthreads;
+    short_thr = new ShortList[nthreads];
+    for (int i = 0; i < nthreads; ++i) {
+      ShortList &s = short_thr[i];
+      s.max = 0;
+      s.j = s.k = s.map_to = s.knot = nullptr;
+      s.del = s.r = s.rr = s.delkj = s.basis = s.dbasis = nullptr;
+    }
+  }
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(eflag,vflag)
+#endif
+  {
+    int ifrom, ito, tid;
+
+    loop_setup_thr(ifrom, ito, tid, inum, nthreads);
+    ThrData *thr = fix->get_thr(tid);
+    thr->timer(Timer::START);
+    ev_setup_thr(eflag, vflag, nall, eatom, vatom, cvatom, thr);
+
+    if (uniform) {
+      if (evflag) {
+        if (eflag) eval<1,1,1>(ifrom, ito, thr);
+        else eval<1,0,1>(ifrom, ito, thr);
+      } else eval<0,0,1>(ifrom, ito, thr);
+    } else {
+      if (evflag) {
+        if (eflag) eval<1,1,0>(ifrom, ito, thr);
+        else eval<1,0,0>(ifrom, ito, thr);
+      } else eval<0,0,0>(ifrom, ito, thr);
+    }
+
+    thr->timer(Timer::PAIR);
+    reduce_thr(this, eflag, vflag, thr);
+  } // end of omp parallel region
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairUF3OMP::grow_short(ShortList &s, int n)
+{
+  s.max = n;
+  memory->grow(s.j, n, "pair:short_j");
+  memory->grow(s.del, 3*n, "pair:short_del");
+  memory->grow(s.r, 2*n, "pair:short_r");
+  memory->grow(s.k, n, "pair:short_k");
+  memory->grow(s.map_to, n, "pair:short_map_to");
+  memory->grow(s.rr, 3*n, "pair:short_rr");
+  memory->grow(s.delkj, 3*n, "pair:short_delkj");
+  memory->grow(s.knot, 3*n, "pair:short_knot");
+  memory->grow(s.basis, 12*n, "pair:short_basis");
+  memory->grow(s.dbasis, 9*n, "pair:short_dbasis");
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairUF3OMP::destroy_short(ShortList &s)
+{
+  memory->destroy(s.j);
+  memory->destroy(s.del);
+  memory->destroy(s.r);
+  memory->destroy(s.k);
+  memory->destroy(s.map_to);
+  memory->destroy(s.rr);
+  memory->destroy(s.delkj);
+  memory->destroy(s.knot);
+  memory->destroy(s.basis);
+  memory->destroy(s.dbasis);
+  s.max = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int EVFLAG, int EFLAG, int UNIFORM>
+void PairUF3OMP::eval(int iifrom, int iito, ThrData * const thr)
+{
+  const auto * _noalias const x = (dbl3_t *) atom->x[0];
+  auto * _noalias const f = (dbl3_t *) thr->get_f()[0];
+  const int * _noalias const type = atom->type;
+  const int nlocal = atom->nlocal;
+  double ** const cvatom_thr = thr->get_cvatom_pair();
+  const int cvflag = EVFLAG && vflag_either && cvflag_atom && cvatom_thr;
+
+  const int * const ilist = list->ilist;
+  const int * const numneigh = list->numneigh;
+  int ** const firstneigh = list->firstneigh;
+
+  // strides of the flat 3-body tables
+
+  const int ncoeff = max_num_coeff_3b;
+  const int stride_coeff = ncoeff*ncoeff*ncoeff;
+  const int stride_c3 = 16*ncoeff;
+  const int stride_d3 = 9*(ncoeff - 1);
+  const double *c3 = nullptr, *d3 = nullptr;
+  const double *coeff3 = nullptr, *cder_ij = nullptr, *cder_ik = nullptr, *cder_jk = nullptr;
+  if (pot_3b) {
+    c3 = &cached_constants_3b[0][0][0][0];
+    d3 = &cached_constants_3b_deri[0][0][0][0];
+    coeff3 = &n3b_coeff_array[0][0][0][0];
+    cder_ij = &coeff_for_der_ij[0][0][0][0];
+    cder_ik = &coeff_for_der_ik[0][0][0][0];
+    cder_jk = &coeff_for_der_jk[0][0][0][0];
+  }
+
+  ShortList &s = short_thr[thr->get_tid()];
+  if (s.max < maxshort) grow_short(s, maxshort);
+
+  double evdwl = 0.0;
+
+  for (int ii = iifrom; ii < iito; ++ii) {
+    const int i = ilist[ii];
+    const double xtmp = x[i].x;
+    const double ytmp = x[i].y;
+    const double ztmp = x[i].z;
+    const int itype = type[i];
+    const int * const jlist = firstneigh[i];
+    const int jnum = numneigh[i];
+    double fxtmp = 0.0, fytmp = 0.0, fztmp = 0.0;
+    int numshort = 0;
+
+    // 2-body interactions; collect the short list for the 3-body term
+
+    for (int jj = 0; jj < jnum; jj++) {
+      const int j = jlist[jj] & NEIGHMASK;
+      const double delx = xtmp - x[j].x;
+      const double dely = ytmp - x[j].y;
+      const double delz = ztmp - x[j].z;
+      const double rsq = delx*delx + dely*dely + delz*delz;
+      const int jtype = type[j];
+
+      if (rsq >= cutsq[itype][jtype]) continue;
+      const double rij = sqrt(rsq);
+
+      if (pot_3b && (rij <= cut_3b_list[itype][jtype])) {
+        if (numshort >= s.max) grow_short(s, s.max + s.max/2 + 1);
+        s.j[numshort] = j;
+        s.del[3*numshort + 0] = -delx;
+        s.del[3*numshort + 1] = -dely;
+        s.del[3*numshort + 2] = -delz;
+        s.r[2*numshort + 0] = rij;
+        s.r[2*numshort + 1] = rsq;
+        numshort++;
+      }
+
+      int knot;
+      if (UNIFORM)
+        knot = 3 + (int) ((rij - n2b_knots_array[itype][jtype][0]) / knot_spacing_2b[itype][jtype]);
+      else knot = get_starting_index_nonuniform_2b(itype, jtype, rij);
+
+      const double *cd1 = cached_constants_2b_deri[itype][jtype][knot - 1];
+      const double *cd2 = cached_constants_2b_deri[itype][jtype][knot - 2];
+      const double *cd3 = cached_constants_2b_deri[itype][jtype][knot - 3];
+      const double force_2b = cd1[0] + rij*cd1[1] + rsq*cd1[2] + cd2[3] + rij*cd2[4] +
+        rsq*cd2[5] + cd3[6] + rij*cd3[7] + rsq*cd3[8];
+
+      const double fpair = -1 * force_2b / rij;
+      const double fx = delx*fpair;
+      const double fy = dely*fpair;
+      const double fz = delz*fpair;
+
+      fxtmp += fx;
+      fytmp += fy;
+      fztmp += fz;
+      f[j].x -= fx;
+      f[j].y -= fy;
+      f[j].z -= fz;
+
+      if (EFLAG) {
+        const double rth = rsq*rij;
+        double b[4];
+        basis3(&cached_constants_2b[itype][jtype][0][0], knot, rij, rsq, rth, b);
+        evdwl = b[3] + b[2] + b[1] + b[0];
+      }
+
+      if (EVFLAG) {
+        ev_tally_xyz_thr(this, i, j, nlocal, /* newton_pair */ 1, evdwl, 0.0,
+                         fx, fy, fz, delx, dely, delz, thr);
+
+        // centroid stress
+        if (cvflag) {
+          double v[6];
+          v[0] = 0.5*delx*fx;
+          v[1] = 0.5*dely*fy;
+          v[2] = 0.5*delz*fz;
+          v[3] = 0.5*delx*fy;
+          v[4] = 0.5*delx*fz;
+          v[5] = 0.5*dely*fz;
+          double * const cvi = cvatom_thr[i];
+          double * const cvj = cvatom_thr[j];
+          cvi[0] += v[0]; cvi[1] += v[1]; cvi[2] += v[2];
+          cvi[3] += v[3]; cvi[4] += v[4]; cvi[5] += v[5];
+          cvi[6] += v[3]; cvi[7] += v[4]; cvi[8] += v[5];
+          cvj[0] += v[0]; cvj[1] += v[1]; cvj[2] += v[2];
+          cvj[3] += v[3]; cvj[4] += v[4]; cvj[5] += v[5];
+          cvj[6] += v[3]; cvj[7] += v[4]; cvj[8] += v[5];
+        }
+      }
+    }
+
+    // 3-body interactions over the short list.
+    // for each j the valid triplets (i,j,k) are gathered into a batch,
+    // then the basis functions are evaluated in unit stride loops over
+    // the batch, and finally the spline coefficients are contracted.
+
+    for (int jj = 0; jj < numshort - 1; jj++) {
+      const int j = s.j[jj];
+      const int jtype = type[j];
+      const double * const del_rji = &s.del[3*jj];
+      const double rij = s.r[2*jj];
+      double fjxtmp = 0.0, fjytmp = 0.0, fjztmp = 0.0;
+
+      int nt = 0;
+      for (int kk = jj + 1; kk < numshort; kk++) {
+        const int k = s.j[kk];
+        const int ktype = type[k];
+        const double rik = s.r[2*kk];
+
+        if ((rij <= cut_3b[itype][jtype][ktype]) && (rik <= cut_3b[itype][ktype][jtype]) &&
+            (rij >= min_cut_3b[itype][jtype][ktype][2]) &&
+            (rik >= min_cut_3b[itype][jtype][ktype][1])) {
+          const double dx = x[k].x - x[j].x;
+          const double dy = x[k].y - x[j].y;
+          const double dz = x[k].z - x[j].z;
+          const double rjk = sqrt(dx*dx + dy*dy + dz*dz);
+          if (rjk < min_cut_3b[itype][jtype][ktype][0]) continue;
+
+          const int map_to = map_3b[itype][jtype][ktype];
+          s.k[nt] = kk;
+          s.map_to[nt] = map_to;
+          s.rr[3*nt + 0] = rij;
+          s.rr[3*nt + 1] = rik;
+          s.rr[3*nt + 2] = rjk;
+          s.delkj[3*nt + 0] = dx;
+          s.delkj[3*nt + 1] = dy;
+          s.delkj[3*nt + 2] = dz;
+          if (UNIFORM) {
+            s.knot[3*nt + 0] = 3 + (int) ((rij - n3b_knots_array[map_to][2][0]) /
+                                          knot_spacing_3b[itype][jtype][ktype][2]);
+            s.knot[3*nt + 1] = 3 + (int) ((rik - n3b_knots_array[map_to][1][0]) /
+                                          knot_spacing_3b[itype][jtype][ktype][1]);
+            s.knot[3*nt + 2] = 3 + (int) ((rjk - n3b_knots_array[map_to][0][0]) /
+                                          knot_spacing_3b[itype][jtype][ktype][0]);
+          } else {
+            s.knot[3*nt + 0] = get_starting_index_nonuniform_3b(itype, jtype, ktype, rij, 2);
+            s.knot[3*nt + 1] = get_starting_index_nonuniform_3b(itype, jtype, ktype, rik, 1);
+            s.knot[3*nt + 2] = get_starting_index_nonuniform_3b(itype, jtype, ktype, rjk, 0);
+          }
+          nt++;
+        }
+      }
+
+      // basis functions and their derivatives for ij (0), ik (1), and jk (2)
+
+      for (int t = 0; t < nt; t++) {
+        const int map_to = s.map_to[t];
+        for (int d = 0; d < 3; d++) {
+          const double r = s.rr[3*t + d];
+          const double r2 = r*r;
+          basis3(c3 + map_to*3*stride_c3 + d*stride_c3, s.knot[3*t + d], r, r2, r*r2,
+                 &s.basis[12*t + 4*d]);
+          basis2(d3 + map_to*3*stride_d3 + d*stride_d3, s.knot[3*t + d], r, r2,
+                 &s.dbasis[9*t + 3*d]);
+        }
+      }
+
+      // contract with the spline coefficients and apply forces
+
+      for (int t = 0; t < nt; t++) {
+        const int kk = s.k[t];
+        const int k = s.j[kk];
+        const double * const del_rki = &s.del[3*kk];
+        const double * const del_rkj = &s.delkj[3*t];
+        const double rik = s.rr[3*t + 1];
+        const double rjk = s.rr[3*t + 2];
+        const double * const basis_ij = &s.basis[12*t];
+        const double * const basis_ik = &s.basis[12*t + 4];
+        const double * const basis_jk = &s.basis[12*t + 8];
+        const double * const basis_ij_der = &s.dbasis[9*t];
+        const double * const basis_ik_der = &s.dbasis[9*t + 3];
+        const double * const basis_jk_der = &s.dbasis[9*t + 6];
+
+        const int map_to = s.map_to[t];
+        const int iknot_ij = s.knot[3*t + 0] - 3;
+        const int iknot_ik = s.knot[3*t + 1] - 3;
+        const int iknot_jk = s.knot[3*t + 2] - 3;
+        const int offset = map_to*stride_coeff + iknot_ij*ncoeff*ncoeff + iknot_ik*ncoeff + iknot_jk;
+
+        double triangle_eval[4] = {0.0, 0.0, 0.0, 0.0};
+
+        for (int l = 0; l < 3; l++) {
+          for (int m = 0; m < 4; m++) {
+            const double factor = basis_ij_der[l]*basis_ik[m];
+            const double *slice = cder_ij + offset + l*ncoeff*ncoeff + m*ncoeff;
+            triangle_eval[1] += factor*(slice[0]*basis_jk[0] + slice[1]*basis_jk[1] +
+                                        slice[2]*basis_jk[2] + slice[3]*basis_jk[3]);
+          }
+        }
+
+        for (int l = 0; l < 4; l++) {
+          for (int m = 0; m < 3; m++) {
+            const double factor = basis_ij[l]*basis_ik_der[m];
+            const double *slice = cder_ik + offset + l*ncoeff*ncoeff + m*ncoeff;
+            triangle_eval[2] += factor*(slice[0]*basis_jk[0] + slice[1]*basis_jk[1] +
+                                        slice[2]*basis_jk[2] + slice[3]*basis_jk[3]);
+          }
+        }
+
+        for (int l = 0; l < 4; l++) {
+          for (int m = 0; m < 4; m++) {
+            const double factor = basis_ij[l]*basis_ik[m];
+            const double *slice = cder_jk + offset + l*ncoeff*ncoeff + m*ncoeff;
+            triangle_eval[3] += factor*(slice[0]*basis_jk_der[0] + slice[1]*basis_jk_der[1] +
+                                        slice[2]*basis_jk_der[2]);
+          }
+        }
+
+        double fij[3], fik[3], fjk[3], Fi[3], Fj[3], Fk[3];
+        for (int d = 0; d < 3; d++) {
+          fij[d] = triangle_eval[1]*(del_rji[d]/rij);
+          fik[d] = triangle_eval[2]*(del_rki[d]/rik);
+          fjk[d] = triangle_eval[3]*(del_rkj[d]/rjk);
+          Fi[d] = fij[d] + fik[d];
+          Fj[d] = -fij[d] + fjk[d];
+          Fk[d] = -fik[d] - fjk[d];
+        }
+
+        fxtmp += Fi[0];
+        fytmp += Fi[1];
+        fztmp += Fi[2];
+        fjxtmp += Fj[0];
+        fjytmp += Fj[1];
+        fjztmp += Fj[2];
+        f[k].x += Fk[0];
+        f[k].y += Fk[1];
+        f[k].z += Fk[2];
+
+        if (EFLAG) {
+          for (int l = 0; l < 4; l++) {
+            for (int m = 0; m < 4; m++) {
+              const double factor = basis_ij[l]*basis_ik[m];
+              const double *slice = coeff3 + offset + l*ncoeff*ncoeff + m*ncoeff;
+              triangle_eval[0] += factor*(slice[0]*basis_jk[0] + slice[1]*basis_jk[1] +
+                                          slice[2]*basis_jk[2] + slice[3]*basis_jk[3]);
+            }
+          }
+          evdwl = triangle_eval[0];
+        }
+
+        if (EVFLAG) {
+          ev_tally3_thr(this, i, j, k, evdwl, 0.0, Fj, Fk, del_rji, del_rki, thr);
+
+          // centroid stress 3-body term
+          if (cvflag) {
+            double ric[3], rjc[3], rkc[3];
+            for (int d = 0; d < 3; d++) {
+              ric[d] = THIRD*(-del_rji[d] - del_rki[d]);
+              rjc[d] = THIRD*(del_rji[d] - del_rkj[d]);
+              rkc[d] = THIRD*(del_rki[d] + del_rkj[d]);
+            }
+            const double *rc[3] = {ric, rjc, rkc};
+            const double *fc[3] = {Fi, Fj, Fk};
+            const int idx[3] = {i, j, k};
+            for (int n = 0; n < 3; n++) {
+              double * const cv = cvatom_thr[idx[n]];
+              cv[0] += rc[n][0]*fc[n][0];
+              cv[1] += rc[n][1]*fc[n][1];
+              cv[2] += rc[n][2]*fc[n][2];
+              cv[3] += rc[n][0]*fc[n][1];
+              cv[4] += rc[n][0]*fc[n][2];
+              cv[5] += rc[n][1]*fc[n][2];
+              cv[6] += rc[n][1]*fc[n][0];
+              cv[7] += rc[n][2]*fc[n][0];
+              cv[8] += rc[n][2]*fc[n][1];
+            }
+          }
+        }
+      }
+      f[j].x += fjxtmp;
+      f[j].y += fjytmp;
+      f[j].z += fjztmp;
+    }
+    f[i].x += fxtmp;
+    f[i].y += fytmp;
+    f[i].z += fztmp;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairUF3OMP::memory_usage()
+{
+  double bytes = memory_usage_thr();
+  bytes += PairUF3::memory_usage();
+  for (int i = 0; i < nthreads_thr; ++i)
+    bytes += (double)short_thr[i].max * (6*sizeof(int) + 32*sizeof(double));
+
+  return bytes;
+}
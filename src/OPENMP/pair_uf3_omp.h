@@ -0,0 +1,66 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+// clang-format off
+PairStyle(uf3/omp,PairUF3OMP);
+// clang-format on
+#else
+
+#ifndef LMP_PAIR_UF3_OMP_H
+#define LMP_PAIR_UF3_OMP_H
+
+#include "pair_uf3.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairUF3OMP : public PairUF3, public ThrOMP {
+
+ public:
+  PairUF3OMP(class LAMMPS *);
+  ~PairUF3OMP() override;
+
+  void compute(int, int) override;
+  double memory_usage() override;
+
+ private:
+  // per-thread short neighbor list and triplet batch in SoA layout
+  struct ShortList {
+    int max;         // allocated length of all arrays
+    int *j;          // neighbor index
+    double *del;     // 3*max: x_j - x_i
+    double *r;       // distance |x_j - x_i|
+    int *k;          // triplet batch: index into the short list
+    int *map_to;     // triplet batch: 3-body interaction index
+    double *rr;      // triplet batch: rij, rik, rjk for each triplet, 3*max
+    double *delkj;   // triplet batch: x_k - x_j, 3*max
+    int *knot;       // triplet batch: starting knot index for ij, ik, jk, 3*max
+    double *basis;   // triplet batch: 4 basis values for ij, ik, jk, 12*max
+    double *dbasis;  // triplet batch: 3 derivative basis values for ij, ik, jk, 9*max
+  };
+
+  ShortList *short_thr;    // per-thread short lists, kept between calls
+  int nthreads_thr;        // # of threads short_thr is allocated for
+
+  void grow_short(ShortList &, int);
+  void destroy_short(ShortList &);
+
+  template <int EVFLAG, int EFLAG, int UNIFORM>
+  void eval(int ifrom, int ito, ThrData *const thr);
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
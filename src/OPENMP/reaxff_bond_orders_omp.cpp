@@ -156,6 +156,120 @@ namespace ReaxFF {
     }
   }
 
+/* ---------------------------------------------------------------------- */
+
+  void bond_candidates::resize(int nmax)
+  {
+    if ((int) d.size() >= nmax) return;
+    for (auto v : {&d, &r_s, &r_p, &r_pp, &p_bo1, &p_bo2, &p_bo3, &p_bo4, &p_bo5, &p_bo6,
+                   &f_s, &f_pi, &f_pi2, &C12, &C34, &C56, &BO, &BO_s, &BO_pi, &BO_pi2})
+      v->resize(nmax);
+    pj.resize(nmax);
+  }
+
+/* ----------------------------------------------------------------------
+   uncorrected bond orders of all far neighbors of atom i within the bond
+   cutoff, see Uncorrected_BO(). the pair parameters are gathered first,
+   then the bond orders are computed in SIMD loops. the power laws are
+   evaluated as exp(p log(d/r)) with the vectorizable approximations.
+   the bond counting and the bond list setup both use this, so that they
+   agree bit for bit on which pairs are bonded
+------------------------------------------------------------------------- */
+
+  void Uncorrected_BO_OMP(reax_system *system, control_params *control,
+                          reax_list *far_nbrs, int i, bond_candidates &bc)
+  {
+    const int type_i = system->my_atoms[i].type;
+    const int start_i = Start_Index(i, far_nbrs);
+    const int end_i = End_Index(i, far_nbrs);
+    const double bond_cut = control->bond_cut;
+    const double bo_cut = control->bo_cut;
+    single_body_parameters *sbp_i = &(system->reax_param.sbp[type_i]);
+    int n = 0;
+
+    bc.resize(end_i - start_i);
+
+    for (int pj = start_i; pj < end_i; ++pj) {
+      far_neighbor_data *nbr_pj = &(far_nbrs->select.far_nbr_list[pj]);
+      if (nbr_pj->d > bond_cut) continue;
+      const int type_j = system->my_atoms[nbr_pj->nbr].type;
+      if (type_j < 0) continue;
+      single_body_parameters *sbp_j = &(system->reax_param.sbp[type_j]);
+      two_body_parameters *twbp = &(system->reax_param.tbp[type_i][type_j]);
+
+      bc.pj[n] = pj;
+      bc.d[n] = nbr_pj->d;
+      bc.f_s[n] = (sbp_i->r_s > 0.0 && sbp_j->r_s > 0.0) ? 1.0 : 0.0;
+      bc.f_pi[n] = (sbp_i->r_pi > 0.0 && sbp_j->r_pi > 0.0) ? 1.0 : 0.0;
+      bc.f_pi2[n] = (sbp_i->r_pi_pi > 0.0 && sbp_j->r_pi_pi > 0.0) ? 1.0 : 0.0;
+      bc.r_s[n] = (bc.f_s[n] != 0.0) ? twbp->r_s : 1.0;
+      bc.r_p[n] = (bc.f_pi[n] != 0.0) ? twbp->r_p : 1.0;
+      bc.r_pp[n] = (bc.f_pi2[n] != 0.0) ? twbp->r_pp : 1.0;
+      bc.p_bo1[n] = twbp->p_bo1;
+      bc.p_bo2[n] = twbp->p_bo2;
+      bc.p_bo3[n] = twbp->p_bo3;
+      bc.p_bo4[n] = twbp->p_bo4;
+      bc.p_bo5[n] = twbp->p_bo5;
+      bc.p_bo6[n] = twbp->p_bo6;
+      ++n;
+    }
+    bc.n = n;
+
+    double *_noalias const d = bc.d.data();
+    double *_noalias const C12 = bc.C12.data();
+    double *_noalias const C34 = bc.C34.data();
+    double *_noalias const C56 = bc.C56.data();
+    double *_noalias const BO = bc.BO.data();
+    double *_noalias const BO_s = bc.BO_s.data();
+    double *_noalias const BO_pi = bc.BO_pi.data();
+    double *_noalias const BO_pi2 = bc.BO_pi2.data();
+    const double *const r_s = bc.r_s.data();
+    const double *const r_p = bc.r_p.data();
+    const double *const r_pp = bc.r_pp.data();
+    const double *const p_bo1 = bc.p_bo1.data();
+    const double *const p_bo2 = bc.p_bo2.data();
+    const double *const p_bo3 = bc.p_bo3.data();
+    const double *const p_bo4 = bc.p_bo4.data();
+    const double *const p_bo5 = bc.p_bo5.data();
+    const double *const p_bo6 = bc.p_bo6.data();
+    const double *const f_s = bc.f_s.data();
+    const double *const f_pi = bc.f_pi.data();
+    const double *const f_pi2 = bc.f_pi2.data();
+
+    // exponents of the sigma, pi and pi-pi bond orders
+
+#if defined(_OPENMP)
+#pragma omp simd
+#endif
+    for (int k = 0; k < n; ++k) {
+      C12[k] = f_s[k] * p_bo1[k] * exp_simd(p_bo2[k] * log_simd(d[k] / r_s[k]));
+      C34[k] = f_pi[k] * p_bo3[k] * exp_simd(p_bo4[k] * log_simd(d[k] / r_p[k]));
+      C56[k] = f_pi2[k] * p_bo5[k] * exp_simd(p_bo6[k] * log_simd(d[k] / r_pp[k]));
+    }
+
+    // the exponents are clamped to the range of exp_simd() in a separate
+    // loop, since the compiler would otherwise branch around the constant
+
+#if defined(_OPENMP)
+#pragma omp simd
+#endif
+    for (int k = 0; k < n; ++k) {
+      BO_s[k] = (C12[k] < -1000.0) ? -1000.0 : ((C12[k] > 1000.0) ? 1000.0 : C12[k]);
+      BO_pi[k] = (C34[k] < -1000.0) ? -1000.0 : ((C34[k] > 1000.0) ? 1000.0 : C34[k]);
+      BO_pi2[k] = (C56[k] < -1000.0) ? -1000.0 : ((C56[k] > 1000.0) ? 1000.0 : C56[k]);
+    }
+
+#if defined(_OPENMP)
+#pragma omp simd
+#endif
+    for (int k = 0; k < n; ++k) {
+      BO_s[k] = f_s[k] * (1.0 + bo_cut) * exp_simd(BO_s[k]);
+      BO_pi[k] = f_pi[k] * exp_simd(BO_pi[k]);
+      BO_pi2[k] = f_pi2[k] * exp_simd(BO_pi2[k]);
+      BO[k] = BO_s[k] + BO_pi[k] + BO_pi2[k];
+    }
+  }
+
 /* ---------------------------------------------------------------------- */
 
   int BOp_OMP(storage * /* workspace */, reax_list *bonds, double bo_cut,
@@ -154,71 +154,81 @@ namespace ReaxFF {
 
 /* ---------------------------------------------------------------------- */
 
-  static void Validate_ListsOMP(reax_system *system, reax_list **lists,
-                         int step, int N, int numH)
+  /* first pass: exact number of bonds of each atom and of hydrogen bonds
+     of each local H atom, so the lists can be laid out without any slack */
+
+  static void Count_BondsOMP(reax_system *system, control_params *control, reax_list **lists)
   {
-    int comp, Hindex;
-    reax_list *bonds, *hbonds;
-    double saferzone = system->saferzone;
+    reax_list *far_nbrs = *lists + FAR_NBRS;
+    reax_atom *my_atoms = system->my_atoms;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(shared) private(comp,Hindex)
+#pragma omp parallel default(shared)
 #endif
     {
-
-      /* bond list */
-      if (N > 0) {
-        bonds = *lists + BONDS;
+      bond_candidates bc;
 
 #if defined(_OPENMP)
-#pragma omp for schedule(guided)
+#pragma omp for schedule(static)
 #endif
-        for (int i = 0; i < N; ++i) {
-          system->my_atoms[i].num_bonds = MAX(Num_Entries(i,bonds)*2, MIN_BONDS);
-
-          if (i < N-1)
-            comp = Start_Index(i+1, bonds);
-          else comp = bonds->num_intrs;
-
-          if (End_Index(i, bonds) > comp)
-            system->error_ptr->one(FLERR, fmt::format("step {}: bondchk failed: "
-                                                      "i={} end(i)={} str(i+1)={}\n",
-                                                      step,i,End_Index(i,bonds),comp));
-        }
+      for (int i = 0; i < system->N; ++i) {
+        my_atoms[i].num_bonds = 0;
+        my_atoms[i].num_hbonds = 0;
       }
 
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic,50)
+#endif
+      for (int i = 0; i < system->N; ++i) {
+        const int type_i = my_atoms[i].type;
+        if (type_i < 0) continue;
 
-      /* hbonds list */
-      if (numH > 0) {
-        hbonds = *lists + HBONDS;
+        if ((i < system->n) && (control->hbond_cut > 0)) {
+          const int ihb = system->reax_param.sbp[type_i].p_hbond;
+          if (ihb == 1 || ihb == 2) {
+            for (int pj = Start_Index(i, far_nbrs); pj < End_Index(i, far_nbrs); ++pj) {
+              far_neighbor_data *nbr_pj = &(far_nbrs->select.far_nbr_list[pj]);
+              if (nbr_pj->d > control->hbond_cut) continue;
+              const int j = nbr_pj->nbr;
+              const int type_j = my_atoms[j].type;
+              if (type_j < 0) continue;
+
+              const int jhb = system->reax_param.sbp[type_j].p_hbond;
+              if (ihb == 1 && jhb == 2) {
+#if defined(_OPENMP)
+#pragma omp atomic
+#endif
+                ++my_atoms[i].num_hbonds;
+              } else if (j < system->n && ihb == 2 && jhb == 1) {
+#if defined(_OPENMP)
+#pragma omp atomic
+#endif
+                ++my_atoms[j].num_hbonds;
+              }
+            }
+          }
+        }
 
+        Uncorrected_BO_OMP(system, control, far_nbrs, i, bc);
+        for (int k = 0; k < bc.n; ++k) {
+          if (bc.BO[k] >= control->bo_cut) {
+            const int j = far_nbrs->select.far_nbr_list[bc.pj[k]].nbr;
 #if defined(_OPENMP)
-#pragma omp for schedule(guided)
+#pragma omp atomic
+#endif
+            ++my_atoms[i].num_bonds;
+#if defined(_OPENMP)
+#pragma omp atomic
 #endif
-        for (int i = 0; i < N; ++i) {
-          Hindex = system->my_atoms[i].Hindex;
-          if (Hindex > -1) {
-            system->my_atoms[i].num_hbonds =
-              (int)(MAX(Num_Entries(Hindex,hbonds)*saferzone,system->minhbonds));
-
-            if (Hindex < numH-1)
-              comp = Start_Index(Hindex+1, hbonds);
-            else comp = hbonds->num_intrs;
-
-            if (End_Index(Hindex, hbonds) > comp)
-              system->error_ptr->one(FLERR, fmt::format("step {}: hbondchk failed: "
-                                                        "H={} end(H)={} str(H+1)={}\n",
-                                                        step, Hindex,End_Index(Hindex,hbonds),comp));
+            ++my_atoms[j].num_bonds;
           }
         }
       }
-
-    } // omp parallel
+    } // parallel region
   }
 
-
   void Init_Forces_noQEq_OMP(reax_system *system, control_params *control,
-                              simulation_data *data, storage *workspace,
+                              simulation_data * /*data*/, storage *workspace,
                               reax_list **lists) {
     int j, pj;
     int start_i, end_i;
@@ -235,6 +245,7 @@ namespace ReaxFF {
     int num_bonds = 0;
     int num_hbonds = 0;
     int btop_i = 0;
+    int overflow = 0;
 
     // We will use CdDeltaReduction as a temporary (double) buffer to accumulate total_bond_order
     // This is safe because CdDeltaReduction is currently zeroed and its accumulation doesn't start until BondsOMP()
@@ -244,8 +255,8 @@ namespace ReaxFF {
     // This is safe because forceReduction is currently zeroed and its accumulation does start until Hydrogen_BondsOMP()
     rvec * tmp_ddelta = workspace->forceReduction;
 
-    /* uncorrected bond orders */
-    cutoff = control->bond_cut;
+    Count_BondsOMP(system, control, lists);
+    Reset_Neighbor_Lists(system, control, lists);
 
 #if defined(_OPENMP)
 #pragma omp parallel default(shared)                                    \
@@ -258,6 +269,7 @@ namespace ReaxFF {
       int tid = get_tid();
       long reductionOffset = (bigint)system->N * tid;
       long totalReductionSize = (bigint)system->N * nthreads;
+      bond_candidates bc;
 
 #if defined(_OPENMP)
 #pragma omp for schedule(dynamic,50) reduction(+:num_bonds)
@@ -268,87 +280,59 @@ namespace ReaxFF {
         if (type_i < 0) continue;
         sbp_i = &(system->reax_param.sbp[type_i]);
 
-        start_i = Start_Index(i, far_nbrs);
-        end_i   = End_Index(i, far_nbrs);
+        // uncorrected bond orders of all bond candidates of atom i
+        Uncorrected_BO_OMP(system, control, far_nbrs, i, bc);
 
-        for (pj = start_i; pj < end_i; ++pj) {
-          nbr_pj = &(far_nbrs->select.far_nbr_list[pj]);
-          if (nbr_pj->d <= cutoff) {
-            int j = nbr_pj->nbr;
+        const double bo_cut = control->bo_cut;
+        for (int k = 0; k < bc.n; ++k) {
+          if (bc.BO[k] >= bo_cut) {
+            int btop_j, room;
+            nbr_pj = &(far_nbrs->select.far_nbr_list[bc.pj[k]]);
+            const int j = nbr_pj->nbr;
             atom_j = &(system->my_atoms[j]);
             type_j = atom_j->type;
-            if (type_j < 0) continue;
             sbp_j = &(system->reax_param.sbp[type_j]);
             twbp = &(system->reax_param.tbp[type_i][type_j]);
 
-            // Trying to minimize time spent in critical section by moving initial part of BOp()
-            // outside of critical section.
-
-            // Start top portion of BOp()
-            double C12, C34, C56;
-            double BO, BO_s, BO_pi, BO_pi2;
-            double bo_cut = control->bo_cut;
-
-            if (sbp_i->r_s > 0.0 && sbp_j->r_s > 0.0) {
-              C12 = twbp->p_bo1 * pow(nbr_pj->d / twbp->r_s, twbp->p_bo2);
-              BO_s = (1.0 + bo_cut) * exp(C12);
-            }
-            else BO_s = C12 = 0.0;
-
-            if (sbp_i->r_pi > 0.0 && sbp_j->r_pi > 0.0) {
-              C34 = twbp->p_bo3 * pow(nbr_pj->d / twbp->r_p, twbp->p_bo4);
-              BO_pi = exp(C34);
-            }
-            else BO_pi = C34 = 0.0;
-
-            if (sbp_i->r_pi_pi > 0.0 && sbp_j->r_pi_pi > 0.0) {
-              C56 = twbp->p_bo5 * pow(nbr_pj->d / twbp->r_pp, twbp->p_bo6);
-              BO_pi2= exp(C56);
-            }
-            else BO_pi2 = C56 = 0.0;
-
-            /* Initially BO values are the uncorrected ones, page 1 */
-            BO = BO_s + BO_pi + BO_pi2;
-            // End top portion of BOp()
-
-            if (BO >= bo_cut) {
-              int btop_j;
-
-              // Update indices in critical section
+            // Update indices in critical section
+            // the counts use the same bond order, so running out of slots is a bug
 #if defined(_OPENMP)
 #pragma omp critical
 #endif
-              {
-                btop_i = End_Index(i, bonds);
-                btop_j = End_Index(j, bonds);
+            {
+              btop_i = End_Index(i, bonds);
+              btop_j = End_Index(j, bonds);
+              room = (Num_Entries(i, bonds) < atom_i->num_bonds) &&
+                (Num_Entries(j, bonds) < atom_j->num_bonds);
+              if (room) {
                 Set_End_Index(j, btop_j+1, bonds);
                 Set_End_Index(i, btop_i+1, bonds);
-              } // omp critical
-
-              // Finish remaining BOp() work
-              BOp_OMP(workspace, bonds, bo_cut,
-                      i , btop_i, nbr_pj, sbp_i, sbp_j, twbp, btop_j,
-                      C12, C34, C56, BO, BO_s, BO_pi, BO_pi2);
-
-              bond_data * ibond = &(bonds->select.bond_list[btop_i]);
-              bond_order_data * bo_ij = &(ibond->bo_data);
+              } else overflow = 1;
+            } // omp critical
+            if (!room) continue;
 
-              bond_data * jbond = &(bonds->select.bond_list[btop_j]);
-              bond_order_data * bo_ji = &(jbond->bo_data);
+            // Finish remaining BOp() work
+            BOp_OMP(workspace, bonds, bo_cut,
+                    i , btop_i, nbr_pj, sbp_i, sbp_j, twbp, btop_j,
+                    bc.C12[k], bc.C34[k], bc.C56[k],
+                    bc.BO[k], bc.BO_s[k], bc.BO_pi[k], bc.BO_pi2[k]);
 
-              workspace->total_bond_order[i]      += bo_ij->BO;
-              tmp_bond_order[reductionOffset + j] += bo_ji->BO;
+            bond_data * ibond = &(bonds->select.bond_list[btop_i]);
+            bond_order_data * bo_ij = &(ibond->bo_data);
 
-              rvec_Add(workspace->dDeltap_self[i],      bo_ij->dBOp);
-              rvec_Add(tmp_ddelta[reductionOffset + j], bo_ji->dBOp);
+            bond_data * jbond = &(bonds->select.bond_list[btop_j]);
+            bond_order_data * bo_ji = &(jbond->bo_data);
 
-              btop_i++;
-              num_bonds++;
-            } // if (BO>=bo_cut)
+            workspace->total_bond_order[i]      += bo_ij->BO;
+            tmp_bond_order[reductionOffset + j] += bo_ji->BO;
 
-          } // if (cutoff)
+            rvec_Add(workspace->dDeltap_self[i],      bo_ij->dBOp);
+            rvec_Add(tmp_ddelta[reductionOffset + j], bo_ji->dBOp);
 
-        } // for (pj)
+            btop_i++;
+            num_bonds++;
+          } // if (BO>=bo_cut)
+        } // for (k)
       } // for (i)
 
       // Need to wait for all indices and tmp arrays accumulated.
@@ -454,10 +438,11 @@ namespace ReaxFF {
 
     } // omp
 
+    if (overflow)
+      system->error_ptr->one(FLERR, "ReaxFF bond list is inconsistent with the bond counts");
+
     workspace->realloc.num_bonds = num_bonds;
     workspace->realloc.num_hbonds = num_hbonds;
-
-    Validate_ListsOMP(system, lists, data->step, system->N, system->numH);
   }
 
 /* ---------------------------------------------------------------------- */
@@ -23,6 +23,10 @@
 
 #include "reaxff_types.h"
 
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
 #if defined(_OPENMP)
 #include <omp.h>
 #endif
@@ -32,6 +36,27 @@ namespace ReaxFF {
 
 // bond orders OpenMP
 
+// structure-of-arrays buffer for the bond candidates of one atom, i.e. its
+// far neighbors within the bond cutoff, with their pair parameters and
+// uncorrected bond orders, so that those can be computed in SIMD loops
+
+struct bond_candidates {
+  int n;
+  std::vector<int> pj;                         // index in the far neighbor list
+  std::vector<double> d;                       // distance
+  std::vector<double> r_s, r_p, r_pp;          // bond radii, 1.0 if the term is off
+  std::vector<double> p_bo1, p_bo2, p_bo3;     // bond order parameters
+  std::vector<double> p_bo4, p_bo5, p_bo6;
+  std::vector<double> f_s, f_pi, f_pi2;        // 1.0 if the sigma, pi or pi-pi term is on
+  std::vector<double> C12, C34, C56;           // exponents of the bond order terms
+  std::vector<double> BO, BO_s, BO_pi, BO_pi2;
+
+  bond_candidates() : n(0) {}
+  void resize(int);
+};
+
+extern void Uncorrected_BO_OMP(reax_system *, control_params *, reax_list *, int,
+                               bond_candidates &);
 extern void Add_dBond_to_ForcesOMP(reax_system *, int, int, storage *, reax_list **);
 extern void Add_dBond_to_Forces_NPTOMP(reax_system *, int, int, storage *, reax_list **);
 extern int BOp_OMP(storage *, reax_list *, double, int, int, far_neighbor_data *,
@@ -94,6 +119,80 @@ inline int get_tid()
   return 0;
 #endif
 }
+
+// exp() and log() approximations without branches or library calls, so that
+// loops over them can be vectorized. both are accurate to about one ulp.
+// exp_simd() needs |x| < 1400, it returns 0.0 below -745 and inf above 709.
+// log_simd() needs a positive, normal x.
+
+inline double exp_simd(double x)
+{
+  // exp(x) = 2^k exp(r) with integer k and |r| <= ln(2)/2
+  const double shift = 6755399441055744.0;    // 1.5 * 2^52
+  const double kd = x * 1.4426950408889634 + shift;
+  const double k = kd - shift;
+  const double r = (x - k * 6.93147180369123816490e-01) - k * 1.90821492927058770002e-10;
+
+  double p = 1.0 / 6227020800.0;
+  p = p * r + 1.0 / 479001600.0;
+  p = p * r + 1.0 / 39916800.0;
+  p = p * r + 1.0 / 3628800.0;
+  p = p * r + 1.0 / 362880.0;
+  p = p * r + 1.0 / 40320.0;
+  p = p * r + 1.0 / 5040.0;
+  p = p * r + 1.0 / 720.0;
+  p = p * r + 1.0 / 120.0;
+  p = p * r + 1.0 / 24.0;
+  p = p * r + 1.0 / 6.0;
+  p = p * r + 0.5;
+  p = p * r + 1.0;
+  p = p * r + 1.0;
+
+  // scale by 2^k in two steps, so results below DBL_MIN underflow gracefully
+
+  int64_t ik, is;
+  memcpy(&ik, &kd, sizeof(double));
+  memcpy(&is, &shift, sizeof(double));
+  ik -= is;
+  const int64_t i1 = ((ik >> 1) + 1023) << 52;
+  const int64_t i2 = ((ik - (ik >> 1)) + 1023) << 52;
+  double s1, s2;
+  memcpy(&s1, &i1, sizeof(double));
+  memcpy(&s2, &i2, sizeof(double));
+  return p * s1 * s2;
+}
+
+inline double log_simd(double x)
+{
+  // log(x) = e ln(2) + log(m) with sqrt(2)/2 <= m < sqrt(2)
+  const int64_t ilo = 0x3fe6a09e667f3bcdLL;
+  int64_t ix, ie, im;
+  memcpy(&ix, &x, sizeof(double));
+  ix += 0x3ff0000000000000LL - ilo;
+  ie = (ix >> 52) | 0x4330000000000000LL;
+  im = (ix & 0x000fffffffffffffLL) + ilo;
+  double e, m;
+  memcpy(&e, &ie, sizeof(double));
+  memcpy(&m, &im, sizeof(double));
+  e -= 4503599627371519.0;    // 2^52 + 1023
+
+  // log(m) = 2 atanh(s) with |s| < 0.172
+  const double s = (m - 1.0) / (m + 1.0);
+  const double s2 = s * s;
+  double p = 1.0 / 21.0;
+  p = p * s2 + 1.0 / 19.0;
+  p = p * s2 + 1.0 / 17.0;
+  p = p * s2 + 1.0 / 15.0;
+  p = p * s2 + 1.0 / 13.0;
+  p = p * s2 + 1.0 / 11.0;
+  p = p * s2 + 1.0 / 9.0;
+  p = p * s2 + 1.0 / 7.0;
+  p = p * s2 + 1.0 / 5.0;
+  p = p * s2 + 1.0 / 3.0;
+  p = p * s2;
+  return e * 6.93147180369123816490e-01 +
+      (e * 1.90821492927058770002e-10 + (2.0 * s + 2.0 * s * p));
+}
 }    // namespace ReaxFF
 
 #endif
@@ -56,6 +56,7 @@ class ThrData {
   double **get_torque() const { return _torque; };
   double *get_de() const { return _de; };
   double *get_drho() const { return _drho; };
+  double **get_cvatom_pair() const { return cvatom_pair; };
 
   // setup and erase per atom arrays
   void init_adp(int, double *, double **, double **);    // ADP (+ EAM)
@@ -24,6 +24,7 @@
 #include "error.h"
 #include "force.h"
 #include "group.h"
+#include "kspace.h"
 #include "memory.h"
 #include "modify.h"
 #include "neigh_list.h"
@@ -58,6 +59,7 @@ FixQEq::FixQEq(LAMMPS *lmp, int narg, char **arg) :
   gamma(nullptr), zeta(nullptr), zcore(nullptr), qmin(nullptr), qmax(nullptr), omega(nullptr), chizj(nullptr), shld(nullptr),
   s(nullptr), t(nullptr), s_hist(nullptr), t_hist(nullptr), Hdia_inv(nullptr), b_s(nullptr),
   b_t(nullptr), p(nullptr), q(nullptr), r(nullptr), d(nullptr),
+  pu(nullptr), pw(nullptr), pz(nullptr), pq(nullptr), ps(nullptr), kq(nullptr), kphi(nullptr),
   qf(nullptr), q1(nullptr), q2(nullptr), qv(nullptr)
 {
   if (narg < 8) utils::missing_cmd_args(FLERR, "fix " + std::string(style), error);
@@ -71,6 +73,8 @@ FixQEq::FixQEq(LAMMPS *lmp, int narg, char **arg) :
   maxiter = utils::inumeric(FLERR,arg[6],false,lmp);
   maxwarn = 1;
   matvecs = 0;
+  solver = SOLVER_STANDARD;
+  kspace_flag = 0;
 
   // check for sane arguments
   if ((nevery <= 0) || (cutoff <= 0.0) || (tolerance <= 0.0) || (maxiter <= 0))
@@ -199,6 +203,19 @@ void FixQEq::allocate_storage()
   memory->create(r,nmax,"qeq:r");
   memory->create(d,nmax,"qeq:d");
 
+  if (solver == SOLVER_PIPELINED) {
+    memory->create(pu,nmax,"qeq:pu");
+    memory->create(pw,nmax,"qeq:pw");
+    memory->create(pz,nmax,"qeq:pz");
+    memory->create(pq,nmax,"qeq:pq");
+    memory->create(ps,nmax,"qeq:ps");
+  }
+
+  if (kspace_flag) {
+    memory->create(kq,nmax,"qeq:kq");
+    memory->create(kphi,nmax,"qeq:kphi");
+  }
+
   memory->create(chizj,nmax,"qeq:chizj");
   memory->create(qf,nmax,"qeq:qf");
   memory->create(q1,nmax,"qeq:q1");
@@ -223,6 +240,15 @@ void FixQEq::deallocate_storage()
   memory->destroy(r);
   memory->destroy(d);
 
+  memory->destroy(pu);
+  memory->destroy(pw);
+  memory->destroy(pz);
+  memory->destroy(pq);
+  memory->destroy(ps);
+
+  memory->destroy(kq);
+  memory->destroy(kphi);
+
   memory->destroy(chizj);
   memory->destroy(qf);
   memory->destroy(q1);
@@ -358,6 +384,10 @@ void FixQEq::setup_pre_force(int vflag)
   deallocate_matrix();
   allocate_matrix();
 
+  // kspace style is set up for the current box only after setup_pre_force()
+
+  if (kspace_flag) force->kspace->setup();
+
   pre_force(vflag);
 }
 
@@ -409,6 +439,8 @@ void FixQEq::min_pre_force(int vflag)
 
 int FixQEq::CG(double *b, double *x)
 {
+  if (solver == SOLVER_PIPELINED) return pipelined_CG(b, x);
+
   int  loop, i, ii, inum, *ilist;
   double tmp, alfa, beta, b_norm;
   double sig_old, sig_new;
@@ -419,6 +451,7 @@ int FixQEq::CG(double *b, double *x)
   pack_flag = 1;
   sparse_matvec(&H, x, q);
   comm->reverse_comm(this);
+  if (kspace_flag) kspace_matvec(x, q);
 
   vector_sum(r , 1.,  b, -1., q, inum);
 
@@ -436,6 +469,7 @@ int FixQEq::CG(double *b, double *x)
     comm->forward_comm(this);
     sparse_matvec(&H, d, q);
     comm->reverse_comm(this);
+    if (kspace_flag) kspace_matvec(d, q);
 
     tmp = parallel_dot(d, q, inum);
     alfa = sig_new / tmp;
@@ -463,6 +497,116 @@ int FixQEq::CG(double *b, double *x)
   return loop;
 }
 
+/* ----------------------------------------------------------------------
+   pipelined preconditioned CG, P. Ghysels and W. Vanroose,
+   Parallel Computing, 40, 224 (2014).
+   the two dot products of an iteration and the norm of b are fused
+   into a single non-blocking reduction that is overlapped with the
+   preconditioner and the matrix-vector product including its communication
+------------------------------------------------------------------------- */
+
+int FixQEq::pipelined_CG(double *b, double *x)
+{
+  int loop, i, ii, inum, *ilist;
+  double alfa, beta, gamma, gamma_old, delta, b_norm;
+  double my_buf[3], buf[3];
+  MPI_Request request;
+
+  int *mask = atom->mask;
+  inum = list->inum;
+  ilist = list->ilist;
+
+  // r = b - A x, u = M^-1 r, w = A u
+
+  pack_flag = 1;
+  sparse_matvec(&H, x, q);
+  comm->reverse_comm(this);
+  if (kspace_flag) kspace_matvec(x, q);
+
+  vector_sum(r, 1., b, -1., q, inum);
+
+  my_buf[2] = 0.0;
+  for (ii = 0; ii < inum; ++ii) {
+    i = ilist[ii];
+    if (mask[i] & groupbit) {
+      d[i] = pu[i] = r[i] * Hdia_inv[i];
+      pz[i] = pq[i] = ps[i] = p[i] = 0.0;
+      my_buf[2] += b[i] * b[i];
+    } else d[i] = 0.0;
+  }
+
+  comm->forward_comm(this);
+  sparse_matvec(&H, d, q);
+  comm->reverse_comm(this);
+  if (kspace_flag) kspace_matvec(d, q);
+
+  for (ii = 0; ii < inum; ++ii) {
+    i = ilist[ii];
+    if (mask[i] & groupbit) pw[i] = q[i];
+  }
+
+  gamma = 0.0;
+  b_norm = 1.0;
+  alfa = gamma_old = 1.0;
+  for (loop = 1; loop < maxiter; ++loop) {
+    my_buf[0] = my_buf[1] = 0.0;
+    for (ii = 0; ii < inum; ++ii) {
+      i = ilist[ii];
+      if (mask[i] & groupbit) {
+        my_buf[0] += r[i] * pu[i];
+        my_buf[1] += pw[i] * pu[i];
+      }
+    }
+    MPI_Iallreduce(my_buf, buf, 3, MPI_DOUBLE, MPI_SUM, world, &request);
+
+    // m = M^-1 w in d and n = A m in q while the reduction is in flight
+
+    for (ii = 0; ii < inum; ++ii) {
+      i = ilist[ii];
+      if (mask[i] & groupbit) d[i] = pw[i] * Hdia_inv[i];
+    }
+    comm->forward_comm(this);
+    sparse_matvec(&H, d, q);
+    comm->reverse_comm(this);
+    if (kspace_flag) kspace_matvec(d, q);
+
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+    gamma = buf[0];
+    delta = buf[1];
+    b_norm = sqrt(buf[2]);
+    if (sqrt(fabs(gamma))/b_norm <= tolerance) break;
+
+    if (loop > 1) {
+      beta = gamma / gamma_old;
+      alfa = gamma / (delta - beta * gamma / alfa);
+    } else {
+      beta = 0.0;
+      alfa = gamma / delta;
+    }
+    gamma_old = gamma;
+
+    for (ii = 0; ii < inum; ++ii) {
+      i = ilist[ii];
+      if (mask[i] & groupbit) {
+        pz[i] = q[i] + beta * pz[i];
+        pq[i] = d[i] + beta * pq[i];
+        ps[i] = pw[i] + beta * ps[i];
+        p[i] = pu[i] + beta * p[i];
+        x[i] += alfa * p[i];
+        r[i] -= alfa * ps[i];
+        pu[i] -= alfa * pq[i];
+        pw[i] -= alfa * pz[i];
+      }
+    }
+  }
+
+  if ((comm->me == 0) && maxwarn && (loop >= maxiter))
+    error->warning(FLERR,"Fix qeq pipelined CG convergence failed ({}) after {} "
+                   "iterations at step {}",sqrt(fabs(gamma))/b_norm,loop,
+                   update->ntimestep);
+  return loop;
+}
+
 
 /* ---------------------------------------------------------------------- */
 
@@ -495,6 +639,29 @@ void FixQEq::sparse_matvec(sparse_matrix *A, double *x, double *b)
 
 }
 
+/* ----------------------------------------------------------------------
+   add long-range potential of kspace style due to charges x to b
+   only atoms in the fix group carry charges x, potential is
+     converted to the 1/r units of the real-space part of the operator
+------------------------------------------------------------------------- */
+
+void FixQEq::kspace_matvec(double *x, double *b)
+{
+  const int nlocal = atom->nlocal;
+  const int *mask = atom->mask;
+
+  for (int i = 0; i < nlocal; ++i) {
+    if (mask[i] & groupbit) kq[i] = x[i];
+    else kq[i] = 0.0;
+  }
+
+  force->kspace->compute_potential(kq, kphi);
+
+  const double qqrd2einv = 1.0 / force->qqrd2e;
+  for (int i = 0; i < nlocal; ++i)
+    if (mask[i] & groupbit) b[i] += qqrd2einv * kphi[i];
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixQEq::calculate_Q()
@@ -593,6 +760,10 @@ double FixQEq::memory_usage()
 
   bytes = (double)atom->nmax*nprev*2 * sizeof(double); // s_hist & t_hist
   bytes += (double)atom->nmax*11 * sizeof(double); // storage
+  if (solver == SOLVER_PIPELINED)
+    bytes += (double)atom->nmax*5 * sizeof(double); // pipelined CG
+  if (kspace_flag)
+    bytes += (double)atom->nmax*2 * sizeof(double); // kspace operator
   bytes += (double)n_cap*2 * sizeof(int); // matrix...
   bytes += (double)m_cap * sizeof(int);
   bytes += (double)m_cap * sizeof(double);
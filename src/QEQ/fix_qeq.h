@@ -70,6 +70,10 @@ class FixQEq : public Fix {
   int maxwarn;                 // print warning when max iterations was reached
   double cutoff, cutoff_sq;    // neighbor cutoff
 
+  enum { SOLVER_STANDARD, SOLVER_PIPELINED };
+  int solver;         // CG variant
+  int kspace_flag;    // 1 if long-range Coulomb of kspace style is part of the operator
+
   double *chi, *eta, *gamma, *zeta, *zcore, *qmin, *qmax, *omega;
   double *chizj;
   double **shld;
@@ -96,6 +100,14 @@ class FixQEq : public Fix {
   double *b_s, *b_t;
   double *p, *q, *r, *d;
 
+  // pipelined CG
+
+  double *pu, *pw, *pz, *pq, *ps;
+
+  // charges and potential for kspace operator
+
+  double *kq, *kphi;
+
   // damped dynamics
 
   double *qf, *q1, *q2, qdamp, qstep;
@@ -122,7 +134,9 @@ class FixQEq : public Fix {
   void reallocate_matrix();
 
   virtual int CG(double *, double *);
+  int pipelined_CG(double *, double *);
   virtual void sparse_matvec(sparse_matrix *, double *, double *);
+  void kspace_matvec(double *, double *);
 };
 
 }    // namespace LAMMPS_NS
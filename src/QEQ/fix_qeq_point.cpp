@@ -36,13 +36,28 @@ using namespace LAMMPS_NS;
 
 FixQEqPoint::FixQEqPoint(LAMMPS *lmp, int narg, char **arg) : FixQEq(lmp, narg, arg)
 {
-  if (narg == 10) {
-    if (strcmp(arg[8], "warn") == 0) {
-      maxwarn = utils::logical(FLERR, arg[9], false, lmp);
+  int iarg = 8;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg], "warn") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix qeq/point warn", error);
+      maxwarn = utils::logical(FLERR, arg[iarg + 1], false, lmp);
+      iarg += 2;
+    } else if (strcmp(arg[iarg], "kspace") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix qeq/point kspace", error);
+      kspace_flag = utils::logical(FLERR, arg[iarg + 1], false, lmp);
+      iarg += 2;
+    } else if (strcmp(arg[iarg], "solver") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix qeq/point solver", error);
+      if (strcmp(arg[iarg + 1], "standard") == 0)
+        solver = SOLVER_STANDARD;
+      else if (strcmp(arg[iarg + 1], "pipelined") == 0)
+        solver = SOLVER_PIPELINED;
+      else
+        error->all(FLERR, "Unknown fix qeq/point solver {}", arg[iarg + 1]);
+      iarg += 2;
     } else
-      error->all(FLERR, "Illegal fix qeq/point command");
-  } else if (narg > 8)
-    error->all(FLERR, "Illegal fix qeq/point command");
+      error->all(FLERR, "Unknown fix qeq/point keyword: {}", arg[iarg]);
+  }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -51,6 +66,14 @@ void FixQEqPoint::init()
 {
   FixQEq::init();
 
+  if (kspace_flag) {
+    if (!force->kspace || !force->kspace->potential_enable)
+      error->all(FLERR, "Fix qeq/point kspace yes requires a kspace style that provides "
+                 "the per-atom potential");
+    if (ngroup != atom->natoms)
+      error->all(FLERR, "Fix qeq/point kspace yes requires all atoms in the fix group");
+  }
+
   neighbor->add_request(this, NeighConst::REQ_FULL);
 
   int ntypes = atom->ntypes;
@@ -120,6 +143,10 @@ void FixQEqPoint::compute_H()
   double **x;
   double dx, dy, dz, r_sqr, r;
 
+  // with kspace the real-space part of the Ewald sum is screened
+
+  const double g_ewald = kspace_flag ? force->kspace->g_ewald : 0.0;
+
   x = atom->x;
   int *mask = atom->mask;
 
@@ -149,7 +176,8 @@ void FixQEqPoint::compute_H()
         if (r_sqr <= cutoff_sq) {
           H.jlist[m_fill] = j;
           r = sqrt(r_sqr);
-          H.val[m_fill] = 0.5/r;
+          if (kspace_flag) H.val[m_fill] = 0.5*erfc(g_ewald*r)/r;
+          else H.val[m_fill] = 0.5/r;
           m_fill++;
         }
       }
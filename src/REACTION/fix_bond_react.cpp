@@ -88,6 +88,7 @@ static const char cite_fix_bond_react[] =
 static constexpr double BIG = 1.0e20;
 static constexpr int DELTA = 16;
 static constexpr int MAXGUESS = 20;      // max # of guesses allowed by superimpose algorithm
+static constexpr int MATCHKEEP = 10;     // # of Nevery intervals a cached match is kept unused
 static constexpr int MAXCONARGS = 14;    // max # of arguments for any type of constraint + rxnID
 static constexpr int NUMVARVALS = 5;     // max # of keyword values that have variables as input
 
@@ -556,6 +557,21 @@ FixBondReact::FixBondReact(LAMMPS *lmp, int narg, char **arg) :
     }
   }
 
+  // precompile pre-reacted templates for the superimpose algorithm
+
+  memory->create(match_depth,nreacts,"bond/react:match_depth");
+  template_ntypes.resize(nreacts);
+  match_cache.resize(nreacts);
+  for (int myrxn = 0; myrxn < nreacts; myrxn++) {
+    onemol = atom->molecules[unreacted_mol[myrxn]];
+    get_molxspecials();
+    compile_template(myrxn);
+  }
+  match_mark = nullptr;
+  nmax_mark = 0;
+  match_nskip = match_found = match_nocache = 0;
+  limit_tags = nullptr;
+
   // initialize Marsaglia RNG with processor-unique seed ('prob' keyword)
 
   random = new RanMars*[nreacts];
@@ -664,6 +680,9 @@ FixBondReact::~FixBondReact()
   memory->destroy(modify_create_fragid);
   memory->destroy(overlapsq);
 
+  memory->destroy(match_depth);
+  memory->destroy(match_mark);
+
   memory->destroy(iatomtype);
   memory->destroy(jatomtype);
   memory->destroy(ibonding);
@@ -1295,6 +1314,21 @@ void FixBondReact::superimpose_algorithm()
 
   attempted_rxn = 1;
 
+  int flag,cols;
+  int index1 = atom->find_custom("limit_tags",flag,cols);
+  limit_tags = atom->ivector[index1];
+
+  // forget cached matches of reaction sites that have not been attempted recently
+
+  for (int myrxn = 0; myrxn < nreacts; myrxn++) {
+    auto &cache = match_cache[myrxn];
+    for (auto it = cache.begin(); it != cache.end();) {
+      if (update->ntimestep - it->second.lastuse > (bigint) MATCHKEEP*nevery[myrxn])
+        it = cache.erase(it);
+      else ++it;
+    }
+  }
+
   // let's finally begin the superimpose loop
   for (rxnID = 0; rxnID < nreacts; rxnID++) {
     for (lcl_inst = 0; lcl_inst < nattempt[rxnID]; lcl_inst++) {
@@ -1335,20 +1369,48 @@ void FixBondReact::superimpose_algorithm()
               nxspecial[local_atom2][0] == nxspecial[local_atom1][0]) &&
              (nxspecial[local_atom1][0] == 0 ||
               xspecial[local_atom1][0] == atom->tag[local_atom2]) &&
-             check_constraints()) {
-          if (fraction[rxnID] < 1.0 &&
-              random[rxnID]->uniform() >= fraction[rxnID]) {
-            status = REJECT;
-          } else {
-            status = ACCEPT;
-            my_mega_glove[0][my_num_mega] = (double) rxnID;
-            if (rescale_charges_flag[rxnID]) my_mega_glove[1][my_num_mega] = get_totalcharge();
+             check_constraints()) status = ACCEPT;
+        else status = REJECT;
+      }
+
+      // replay topological matches found on a previous step if the local
+      // topology around the initiators did not change since then.
+      // constraints are always re-evaluated, in the same order as the search would.
+      // if the last cached match fails, run the full search, skipping known failures
+
+      match_nskip = match_found = 0;
+      match_nocache = 1;
+      match_trace.clear();
+      std::pair<tagint,tagint> match_key(glove[myibonding-1][1],glove[myjbonding-1][1]);
+      if (status == PROCEED && match_depth[rxnID] >= 0 && match_signature()) {
+        match_nocache = 0;
+        auto it = match_cache[rxnID].find(match_key);
+        if (it != match_cache[rxnID].end() && it->second.signature == match_sig) {
+          MatchCache &cached = it->second;
+          cached.lastuse = update->ntimestep;
+          int nmatch = cached.matches.size() / onemol->natoms;
+          for (int m = 0; m < nmatch; m++) {
             for (int i = 0; i < onemol->natoms; i++) {
-              my_mega_glove[i+cuff][my_num_mega] = (double) glove[i][1];
+              glove[i][0] = i+1;
+              glove[i][1] = cached.matches[m*onemol->natoms+i];
+            }
+            if (check_constraints()) {
+              status = ACCEPT;
+              break;
             }
-            my_num_mega++;
           }
-        } else status = REJECT;
+          if (status != ACCEPT && cached.complete) status = REJECT;
+          if (status == ACCEPT || status == REJECT) match_nocache = 1;
+          else {
+            match_nskip = nmatch;
+            for (int i = 0; i < onemol->natoms; i++)
+              glove[i][0] = glove[i][1] = 0;
+            glove[myibonding-1][0] = myibonding;
+            glove[myibonding-1][1] = match_key.first;
+            glove[myjbonding-1][0] = myjbonding;
+            glove[myjbonding-1][1] = match_key.second;
+          }
+        }
       }
 
       avail_guesses = 0;
@@ -1385,19 +1447,6 @@ void FixBondReact::superimpose_algorithm()
           }
         }
 
-        // reaction site found successfully!
-        if (status == ACCEPT) {
-          if (fraction[rxnID] < 1.0 &&
-              random[rxnID]->uniform() >= fraction[rxnID]) status = REJECT;
-          else {
-            my_mega_glove[0][my_num_mega] = (double) rxnID;
-            if (rescale_charges_flag[rxnID]) my_mega_glove[1][my_num_mega] = get_totalcharge();
-            for (int i = 0; i < onemol->natoms; i++) {
-              my_mega_glove[i+cuff][my_num_mega] = (double) glove[i][1];
-            }
-            my_num_mega++;
-          }
-        }
         hang_catch++;
         // let's go ahead and catch the simplest of hangs
         //if (hang_catch > onemol->natoms*4)
@@ -1407,6 +1456,32 @@ void FixBondReact::superimpose_algorithm()
               "via at least one path that does not involve edge atoms.");
         }
       }
+
+      // store topological matches of this search for later time steps
+
+      if (!match_nocache) {
+        MatchCache &cached = match_cache[rxnID][match_key];
+        cached.signature = match_sig;
+        cached.matches = match_trace;
+        cached.complete = match_found ? 0 : 1;
+        cached.lastuse = update->ntimestep;
+      }
+      for (int i : match_queue) match_mark[i] = 0;
+      match_queue.clear();
+
+      // reaction site found successfully!
+      if (status == ACCEPT) {
+        if (fraction[rxnID] < 1.0 &&
+            random[rxnID]->uniform() >= fraction[rxnID]) status = REJECT;
+        else {
+          my_mega_glove[0][my_num_mega] = (double) rxnID;
+          if (rescale_charges_flag[rxnID]) my_mega_glove[1][my_num_mega] = get_totalcharge();
+          for (int i = 0; i < onemol->natoms; i++) {
+            my_mega_glove[i+cuff][my_num_mega] = (double) glove[i][1];
+          }
+          my_num_mega++;
+        }
+      }
     }
   }
 
@@ -1522,11 +1597,6 @@ void FixBondReact::make_a_guess()
   int *type = atom->type;
   int nfirst_neighs = onemol_nxspecial[pion][0];
 
-  // per-atom property indicating if in bond/react master group
-  int flag,cols;
-  int index1 = atom->find_custom("limit_tags",flag,cols);
-  int *i_limit_tags = atom->ivector[index1];
-
   if (status == GUESSFAIL && avail_guesses == 0) {
     status = REJECT;
     return;
@@ -1550,6 +1620,11 @@ void FixBondReact::make_a_guess()
   }
 
   nfirst_neighs = onemol_nxspecial[pion][0];
+  int ipion = atom->map(glove[pion][1]);
+
+  // the search may only look at neighbors of atoms within the cached topology
+  if (!match_nocache && (match_mark[ipion] == 0 || match_mark[ipion] > match_depth[rxnID]))
+    match_nocache = 1;
 
   //  check if any of first neighbors are in bond_react_MASTER_group
   //  if so, this constitutes a fail
@@ -1557,18 +1632,18 @@ void FixBondReact::make_a_guess()
   //  could technically fail unnecessarily during a wrong guess if near edge atoms
   //  we accept this temporary and infrequent decrease in reaction occurrences
 
-  for (int i = 0; i < nxspecial[atom->map(glove[pion][1])][0]; i++) {
-    if (atom->map(xspecial[atom->map(glove[pion][1])][i]) < 0) {
+  for (int i = 0; i < nxspecial[ipion][0]; i++) {
+    if (atom->map(xspecial[ipion][i]) < 0) {
       error->one(FLERR,"Fix bond/react: Fix bond/react needs ghost atoms from further away"); // parallel issues.
     }
-    if (i_limit_tags[(int)atom->map(xspecial[atom->map(glove[pion][1])][i])] != 0) {
+    if (limit_tags[(int)atom->map(xspecial[ipion][i])] != 0) {
       status = GUESSFAIL;
       return;
     }
   }
 
   // check for same number of neighbors between unreacted mol and simulation
-  if (nfirst_neighs != nxspecial[atom->map(glove[pion][1])][0]) {
+  if (nfirst_neighs != nxspecial[ipion][0]) {
     status = GUESSFAIL;
     return;
   }
@@ -1578,7 +1653,7 @@ void FixBondReact::make_a_guess()
   int assigned_count = 0;
   for (int i = 0; i < nfirst_neighs; i++)
     for (int j = 0; j < onemol->natoms; j++)
-      if (xspecial[atom->map(glove[pion][1])][i] == glove[j][1]) {
+      if (xspecial[ipion][i] == glove[j][1]) {
         assigned_count++;
         break;
       }
@@ -1586,31 +1661,17 @@ void FixBondReact::make_a_guess()
   if (assigned_count == nfirst_neighs) status = GUESSFAIL;
 
   // check if all neigh atom types are the same between simulation and unreacted mol
-  int *mol_ntypes = new int[atom->ntypes];
-  int *lcl_ntypes = new int[atom->ntypes];
-
-  for (int i = 0; i < atom->ntypes; i++) {
-    mol_ntypes[i] = 0;
-    lcl_ntypes[i] = 0;
-  }
-
-  for (int i = 0; i < nfirst_neighs; i++) {
-    mol_ntypes[(int)onemol->type[(int)onemol_xspecial[pion][i]-1]-1]++;
-    lcl_ntypes[(int)type[(int)atom->map(xspecial[atom->map(glove[pion][1])][i])]-1]++; //added -1
-  }
+  // by comparing to the precompiled, sorted neighbor types of the template atom
+  lcl_ntypes.resize(nfirst_neighs);
+  for (int i = 0; i < nfirst_neighs; i++)
+    lcl_ntypes[i] = type[(int)atom->map(xspecial[ipion][i])];
+  std::sort(lcl_ntypes.begin(),lcl_ntypes.end());
 
-  for (int i = 0; i < atom->ntypes; i++) {
-    if (mol_ntypes[i] != lcl_ntypes[i]) {
-      status = GUESSFAIL;
-      delete [] mol_ntypes;
-      delete [] lcl_ntypes;
-      return;
-    }
+  if (lcl_ntypes != template_ntypes[rxnID][pion]) {
+    status = GUESSFAIL;
+    return;
   }
 
-  delete [] mol_ntypes;
-  delete [] lcl_ntypes;
-
   // okay everything seems to be in order. let's assign some ID pairs!!!
   neighbor_loop();
 }
@@ -1679,7 +1740,7 @@ void FixBondReact::check_a_neighbor()
 
             glove_counter++;
             if (glove_counter == onemol->natoms) {
-              if (ring_check() && check_constraints()) status = ACCEPT;
+              if (check_match()) status = ACCEPT;
               else status = GUESSFAIL;
               return;
             }
@@ -1731,7 +1792,7 @@ void FixBondReact::check_a_neighbor()
 
         glove_counter++;
         if (glove_counter == onemol->natoms) {
-          if (ring_check() && check_constraints()) status = ACCEPT;
+          if (check_match()) status = ACCEPT;
           else status = GUESSFAIL;
           return;
           // will never complete here when there are edge atoms
@@ -1765,6 +1826,7 @@ void FixBondReact::crosscheck_the_neighbor()
 
       if (avail_guesses == MAXGUESS) {
         error->warning(FLERR,"Fix bond/react: Fix bond/react failed because MAXGUESS set too small. ask developer for info");
+        match_nocache = 1;
         status = GUESSFAIL;
         return;
       }
@@ -1859,7 +1921,7 @@ void FixBondReact::inner_crosscheck_loop()
   }
   glove_counter++;
   if (glove_counter == onemol->natoms) {
-    if (ring_check() && check_constraints()) status = ACCEPT;
+    if (check_match()) status = ACCEPT;
     else status = GUESSFAIL;
     return;
   }
@@ -1899,6 +1961,92 @@ int FixBondReact::ring_check()
   return 1;
 }
 
+/* ----------------------------------------------------------------------
+  Complete match found: check bonds, record it as a topological match,
+  then evaluate constraints unless already known to fail
+------------------------------------------------------------------------- */
+
+int FixBondReact::check_match()
+{
+  if (!ring_check()) return 0;
+
+  for (int i = 0; i < onemol->natoms; i++)
+    match_trace.push_back(glove[i][1]);
+
+  if (match_nskip > 0) {
+    match_nskip--;
+    return 0;
+  }
+
+  if (check_constraints()) {
+    match_found = 1;
+    return 1;
+  }
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+  Collect the local topology seen by the superimpose algorithm for the
+  current initiator atoms: atom IDs, types, master group flags and 1-2
+  neighbors of all atoms within match_depth bonds of the initiators.
+  return 0 if any of these atoms are not available on this proc
+------------------------------------------------------------------------- */
+
+int FixBondReact::match_signature()
+{
+  tagint *tag = atom->tag;
+  int *type = atom->type;
+  int depth = match_depth[rxnID];
+
+  if (atom->nmax > nmax_mark) {
+    memory->destroy(match_mark);
+    nmax_mark = atom->nmax;
+    memory->create(match_mark,nmax_mark,"bond/react:match_mark");
+    for (int i = 0; i < nmax_mark; i++) match_mark[i] = 0;
+  }
+
+  // match_mark = 1 + # of bonds from initiators, reset after the search
+
+  match_sig.clear();
+  int ok = 1;
+  for (int m = 0; m < 2; m++) {
+    int i = atom->map(glove[(m ? jbonding[rxnID] : ibonding[rxnID])-1][1]);
+    if (i < 0) return 0;
+    if (!match_mark[i]) {
+      match_mark[i] = 1;
+      match_queue.push_back(i);
+    }
+  }
+
+  std::size_t nfirst = 0;
+  for (int d = 0; d <= depth && ok; d++) {
+    std::size_t nlast = match_queue.size();
+    for (std::size_t n = nfirst; n < nlast && ok; n++) {
+      int i = match_queue[n];
+      match_sig.push_back(tag[i]);
+      match_sig.push_back(type[i]);
+      match_sig.push_back(limit_tags[i] != 0);
+      match_sig.push_back(nxspecial[i][0]);
+      for (int k = 0; k < nxspecial[i][0]; k++) {
+        match_sig.push_back(xspecial[i][k]);
+        if (d == depth) continue;
+        int j = atom->map(xspecial[i][k]);
+        if (j < 0) {
+          ok = 0;
+          break;
+        }
+        if (!match_mark[j]) {
+          match_mark[j] = d+2;
+          match_queue.push_back(j);
+        }
+      }
+    }
+    nfirst = nlast;
+  }
+
+  return ok;
+}
+
 /* ----------------------------------------------------------------------
 evaluate constraints: return 0 if any aren't satisfied
 ------------------------------------------------------------------------- */
@@ -2674,6 +2822,61 @@ void FixBondReact::find_landlocked_atoms(int myrxn)
   }
 }
 
+/* ----------------------------------------------------------------------
+  Precompile pre-reacted template for the superimpose algorithm:
+  sorted types of 1-2 neighbors of each template atom, and the largest
+  number of bonds between an initiator atom and any matched atom
+------------------------------------------------------------------------- */
+
+void FixBondReact::compile_template(int myrxn)
+{
+  template_ntypes[myrxn].resize(onemol->natoms);
+  for (int i = 0; i < onemol->natoms; i++) {
+    std::vector<int> &ntypes = template_ntypes[myrxn][i];
+    ntypes.resize(onemol_nxspecial[i][0]);
+    for (int j = 0; j < onemol_nxspecial[i][0]; j++)
+      ntypes[j] = onemol->type[onemol_xspecial[i][j]-1];
+    std::sort(ntypes.begin(),ntypes.end());
+  }
+
+  // the superimpose algorithm only grows the match from non-edge atoms,
+  // so the match cannot extend further than this breadth-first walk.
+  // if not all atoms are reached, the algorithm fails anyway, do not cache
+
+  std::vector<int> dist(onemol->natoms,-1);
+  std::vector<int> queue;
+  dist[ibonding[myrxn]-1] = 0;
+  queue.push_back(ibonding[myrxn]-1);
+  if (dist[jbonding[myrxn]-1] < 0) {
+    dist[jbonding[myrxn]-1] = 0;
+    queue.push_back(jbonding[myrxn]-1);
+  }
+  for (std::size_t n = 0; n < queue.size(); n++) {
+    int i = queue[n];
+    if (edge[i][myrxn]) continue;
+    for (int j = 0; j < onemol_nxspecial[i][0]; j++) {
+      int k = onemol_xspecial[i][j]-1;
+      if (dist[k] < 0) {
+        dist[k] = dist[i] + 1;
+        queue.push_back(k);
+      }
+    }
+  }
+
+  match_depth[myrxn] = 0;
+  for (int i = 0; i < onemol->natoms; i++) {
+    if (dist[i] < 0) {
+      match_depth[myrxn] = -1;
+      break;
+    }
+    match_depth[myrxn] = MAX(match_depth[myrxn],dist[i]);
+  }
+
+  // two-atom templates are matched directly, without the superimpose loop
+
+  if (onemol->natoms == 2) match_depth[myrxn] = -1;
+}
+
 /* ----------------------------------------------------------------------
 let's dedup global_mega_glove
 allows for same site undergoing different pathways, in parallel
@@ -4590,6 +4793,10 @@ double FixBondReact::memory_usage()
   double bytes = (double)nmax * sizeof(int);
   bytes = 2*nmax * sizeof(tagint);
   bytes += (double)nmax * sizeof(double);
+  for (const auto &cache : match_cache)
+    for (const auto &entry : cache)
+      bytes += (double) (entry.second.signature.size() + entry.second.matches.size()) *
+        sizeof(tagint);
   return bytes;
 }
 
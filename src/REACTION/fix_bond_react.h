@@ -143,6 +143,30 @@ class FixBondReact : public Fix {
   tagint **restore;      // contains info about restore points
   int *pioneer_count;    // counts pioneers
 
+  // precompiled pre-reacted templates, used by the superimpose algorithm
+  int *match_depth;    // max 1-2 distance of a matched atom from initiators, -1 = no caching
+  std::vector<std::vector<std::vector<int>>> template_ntypes;    // sorted types of 1-2 neighbors
+  std::vector<int> lcl_ntypes;                                  // scratch for same in simulation
+
+  // per-proc cache of topological matches, keyed by initiator atom IDs
+  // a cached entry is reused as long as the local topology around the initiators is unchanged
+  struct MatchCache {
+    std::vector<tagint> signature;    // topology seen by the superimpose algorithm
+    std::vector<tagint> matches;      // topological matches in search order, natoms IDs each
+    int complete;                     // 1 if no match satisfied the constraints
+    bigint lastuse;                   // last time step this entry was used
+  };
+  std::vector<std::map<std::pair<tagint, tagint>, MatchCache>> match_cache;
+  std::vector<tagint> match_sig;      // signature of current reaction site
+  std::vector<tagint> match_trace;    // topological matches found by current search
+  std::vector<int> match_queue;       // scratch for breadth-first walk
+  int *match_mark;                    // 1 + # of bonds from initiators of atoms visited by walk
+  int nmax_mark;
+  int match_nskip;                    // # of leading matches whose constraints are known to fail
+  int match_found;                    // 1 if current search found a match satisfying constraints
+  int match_nocache;                  // 1 if current search should not be cached
+  int *limit_tags;                    // per-atom property indicating if in bond/react master group
+
   int **edge;                // atoms in molecule templates with incorrect valences
   int ***equivalences;       // relation between pre- and post-reacted templates
   int ***reverse_equiv;      // re-ordered equivalences
@@ -193,6 +217,7 @@ class FixBondReact : public Fix {
   void crosscheck_the_neighbor();
   void inner_crosscheck_loop();
   int ring_check();
+  int check_match();
   int check_constraints();
   void get_IDcoords(int, int, double *);
   double get_temperature(tagint **, int, int);
@@ -213,6 +238,8 @@ class FixBondReact : public Fix {
   void close_partner();
   void get_molxspecials();
   void find_landlocked_atoms(int);
+  void compile_template(int);
+  int match_signature();
   void glove_ghostcheck();
   void ghost_glovecast();
   void update_everything();
@@ -66,6 +66,10 @@ FixACKS2ReaxFF::FixACKS2ReaxFF(LAMMPS *lmp, int narg, char **arg) :
   r_hat = nullptr;
   y = nullptr;
   z = nullptr;
+  pt = pv = nullptr;
+
+  if (precond != PRECOND_JACOBI)
+    error->all(FLERR,"Fix {} only supports the jacobi preconditioner", style);
 
   // X matrix
   X.firstnbr = nullptr;
@@ -232,6 +236,13 @@ void FixACKS2ReaxFF::allocate_storage()
   memory->create(r_hat,size,"acks2:r_hat");
   memory->create(y,size,"acks2:y");
   memory->create(z,size,"acks2:z");
+
+  if (solver == SOLVER_PIPELINED) {
+    memory->create(ps,size,"acks2:ps");
+    memory->create(pw,size,"acks2:pw");
+    memory->create(pt,size,"acks2:pt");
+    memory->create(pv,size,"acks2:pv");
+  }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -248,6 +259,9 @@ void FixACKS2ReaxFF::deallocate_storage()
   memory->destroy(r_hat);
   memory->destroy(y);
   memory->destroy(z);
+
+  memory->destroy(pt);
+  memory->destroy(pv);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -266,6 +280,18 @@ void FixACKS2ReaxFF::allocate_matrix()
 
 /* ---------------------------------------------------------------------- */
 
+void FixACKS2ReaxFF::grow_matrix(bigint m)
+{
+  if (m <= m_cap) return;
+  FixQEqReaxFF::grow_matrix(m);
+
+  X.m = m_cap;
+  memory->grow(X.jlist,m_cap,"acks2:X.jlist");
+  memory->grow(X.val,m_cap,"acks2:X.val");
+}
+
+/* ---------------------------------------------------------------------- */
+
 void FixACKS2ReaxFF::deallocate_matrix()
 {
   FixQEqReaxFF::deallocate_matrix();
@@ -349,14 +375,17 @@ void FixACKS2ReaxFF::pre_force(int /*vflag*/)
   // need to be atom->nmax in length
 
   if (atom->nmax > nmax) reallocate_storage();
-  if (atom->nlocal > n_cap*DANGER_ZONE || m_fill > m_cap*DANGER_ZONE)
+  if (atom->nlocal > n_cap*DANGER_ZONE)
     reallocate_matrix();
 
   if (efield) get_chi_field();
 
   init_matvec();
 
-  matvecs = BiCGStab(b_s, s); // BiCGStab on s - parallel
+  if (solver == SOLVER_PIPELINED)
+    matvecs = pipelined_BiCGStab(b_s, s); // pipelined BiCGStab on s - parallel
+  else
+    matvecs = BiCGStab(b_s, s); // BiCGStab on s - parallel
 
   calculate_Q();
 }
@@ -433,6 +462,7 @@ void FixACKS2ReaxFF::compute_X()
     if (mask[i] & groupbit) {
       jlist = firstneigh[i];
       jnum = numneigh[i];
+      grow_matrix((bigint)m_fill + jnum);
       X.firstnbr[i] = m_fill;
 
       for (jj = 0; jj < jnum; jj++) {
@@ -475,9 +505,6 @@ void FixACKS2ReaxFF::compute_X()
       X.numnbrs[i] = m_fill - X.firstnbr[i];
     }
   }
-
-  if (m_fill >= X.m)
-    error->all(FLERR,"Fix acks2/reaxff has insufficient ACKS2 X matrix size: m_fill={} X.m={}\n",m_fill,X.m);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -611,6 +638,172 @@ int FixACKS2ReaxFF::BiCGStab(double *b, double *x)
   return i;
 }
 
+/* ----------------------------------------------------------------------
+   pipelined BiCGStab, S. Cools and W. Vanroose, Parallel Computing, 65, 1 (2017)
+   with right preconditioning, so that the residual is the same as in BiCGStab.
+   the dot products of each half iteration are combined into one non-blocking
+   reduction that is overlapped with the next matrix-vector product.
+   the recurrences are restarted from the true residual every RESTART
+   iterations to limit the accumulation of rounding errors.
+------------------------------------------------------------------------- */
+
+int FixACKS2ReaxFF::pipelined_BiCGStab(double *b, double *x)
+{
+  constexpr int RESTART = 100;
+
+  int i;
+  double alpha, beta, omega, rho, rho_new, rnorm, bnorm;
+  double my_buf[5], buf[5];
+  MPI_Request request;
+
+  alpha = beta = rho = 0.0;
+  omega = rnorm = bnorm = 1.0;
+
+  for (i = 1; i < imax && rnorm / bnorm > tolerance; ++i) {
+    const int restart = ((i - 1) % RESTART == 0);
+
+    // r = b - A x, w = A M^-1 r, t = A M^-1 w
+
+    if (restart) {
+      vector_copy(d, x, nn);
+      pack_flag = 1;
+      comm->forward_comm(this); //Dist_vector(d);
+      more_forward_comm(d);
+      sparse_matvec_acks2(&H, &X, d, y);
+      pack_flag = 3;
+      comm->reverse_comm(this); //Coll_vector(y);
+      more_reverse_comm(y);
+
+      vector_sum(r, 1., b, -1., y, nn);
+      if (i == 1) vector_copy(r_hat, r, nn);
+
+      precond_matvec_acks2(r, pw, 5);
+      precond_matvec_acks2(pw, pt, 6);
+
+      my_buf[0] = local_dot(b, b, nn);
+      my_buf[1] = local_dot(r, r, nn);
+      my_buf[2] = local_dot(r_hat, r, nn);
+      my_buf[3] = local_dot(r_hat, pw, nn);
+      MPI_Allreduce(my_buf, buf, 4, MPI_DOUBLE, MPI_SUM, world);
+
+      bnorm = sqrt(buf[0]);
+      if (bnorm == 0.0) bnorm = 1.0;
+      rnorm = sqrt(buf[1]);
+      if (rnorm / bnorm <= tolerance) break;
+      rho = buf[2];
+      alpha = (buf[3] == 0.0) ? 0.0 : rho / buf[3];
+    }
+    if (rho == 0.0 || alpha == 0.0) break;
+
+    if (restart) {
+      vector_copy(p, r, nn);
+      vector_copy(ps, pw, nn);
+      vector_copy(z, pt, nn);
+    } else {
+      vector_sum(p, 1., r, beta, p, nn);
+      vector_add(p, -beta * omega, ps, nn);
+      vector_sum(ps, 1., pw, beta, ps, nn);
+      vector_add(ps, -beta * omega, z, nn);
+      vector_sum(z, 1., pt, beta, z, nn);
+      vector_add(z, -beta * omega, pv, nn);
+    }
+
+    vector_sum(q, 1., r, -alpha, ps, nn);
+    vector_sum(y, 1., pw, -alpha, z, nn);
+
+    // v = A M^-1 z while the reduction of (q,y) and (y,y) is in flight
+
+    my_buf[0] = local_dot(q, y, nn);
+    my_buf[1] = local_dot(y, y, nn);
+    MPI_Iallreduce(my_buf, buf, 2, MPI_DOUBLE, MPI_SUM, world, &request);
+    precond_matvec_acks2(z, pv, 7);
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+    omega = (buf[1] == 0.0) ? 0.0 : buf[0] / buf[1];
+    if (omega == 0.0) break;
+
+    // x += M^-1 (alpha p + omega q)
+
+    vector_sum(g, alpha, p, omega, q, nn);
+    precond_acks2(g, g);
+    vector_add(x, 1., g, nn);
+
+    vector_sum(r, 1., q, -omega, y, nn);
+    vector_sum(pw, 1., y, -omega, pt, nn);
+    vector_add(pw, alpha * omega, pv, nn);
+
+    // t = A M^-1 w while the reduction for the next iteration is in flight
+
+    my_buf[0] = local_dot(r_hat, r, nn);
+    my_buf[1] = local_dot(r_hat, pw, nn);
+    my_buf[2] = local_dot(r_hat, ps, nn);
+    my_buf[3] = local_dot(r_hat, z, nn);
+    my_buf[4] = local_dot(r, r, nn);
+    MPI_Iallreduce(my_buf, buf, 5, MPI_DOUBLE, MPI_SUM, world, &request);
+    precond_matvec_acks2(pw, pt, 6);
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+    rnorm = sqrt(buf[4]);
+    rho_new = buf[0];
+    beta = (alpha / omega) * (rho_new / rho);
+    const double denom = buf[1] + beta * buf[2] - beta * omega * buf[3];
+    alpha = (denom == 0.0) ? 0.0 : rho_new / denom;
+    rho = rho_new;
+  }
+
+  if (comm->me == 0) {
+    if ((rnorm / bnorm > tolerance) && (omega == 0 || rho == 0 || alpha == 0)) {
+      error->warning(FLERR,"Fix acks2/reaxff pipelined BiCGStab numerical breakdown, "
+                     "omega = {:.8}, rho = {:.8}", omega, rho);
+    } else if (i >= imax) {
+      error->warning(FLERR,"Fix acks2/reaxff pipelined BiCGStab convergence failed after {} "
+                     "iterations at step {}", i, update->ntimestep);
+    }
+  }
+
+  return i;
+}
+
+/* ----------------------------------------------------------------------
+   apply diagonal preconditioner out = M^-1 v, out may be the same as v
+------------------------------------------------------------------------- */
+
+void FixACKS2ReaxFF::precond_acks2(double *v, double *out)
+{
+  int j, jj;
+
+  for (jj = 0; jj < nn; ++jj) {
+    j = ilist[jj];
+    if (atom->mask[j] & groupbit) {
+      out[j] = v[j] * Hdia_inv[j];
+      out[NN+j] = v[NN+j] * Xdia_inv[j];
+    }
+  }
+  // last two rows
+  if (last_rows_flag) {
+    out[2*NN] = v[2*NN];
+    out[2*NN + 1] = v[2*NN + 1];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   out = A M^-1 v, with M^-1 v stored in d
+   flag selects the vector out for the reverse communication
+------------------------------------------------------------------------- */
+
+void FixACKS2ReaxFF::precond_matvec_acks2(double *v, double *out, int flag)
+{
+  precond_acks2(v, d);
+
+  pack_flag = 1;
+  comm->forward_comm(this); //Dist_vector(d);
+  more_forward_comm(d);
+  sparse_matvec_acks2(&H, &X, d, out);
+  pack_flag = flag;
+  comm->reverse_comm(this); //Coll_vector(out);
+  more_reverse_comm(out);
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixACKS2ReaxFF::sparse_matvec_acks2(sparse_matrix *H, sparse_matrix *X, double *x, double *b)
@@ -785,6 +978,12 @@ int FixACKS2ReaxFF::pack_reverse_comm(int n, int first, double *buf)
   } else if (pack_flag == 4) {
     for(i = first; i < last; i++)
       buf[m++] = X_diag[i];
+  } else if (pack_flag >= 5) {
+    double *vec = (pack_flag == 5) ? pw : ((pack_flag == 6) ? pt : pv);
+    for(i = first; i < last; i++) {
+      buf[m++] = vec[i];
+      buf[m++] = vec[NN+i];
+    }
   }
 
   return m;
@@ -819,6 +1018,13 @@ void FixACKS2ReaxFF::unpack_reverse_comm(int n, int *list, double *buf)
       j = list[i];
       X_diag[j] += buf[m++];
     }
+  } else if (pack_flag >= 5) {
+    double *vec = (pack_flag == 5) ? pw : ((pack_flag == 6) ? pt : pv);
+    for(int i = 0; i < n; i++) {
+      j = list[i];
+      vec[j] += buf[m++];
+      vec[NN+j] += buf[m++];
+    }
   }
 }
 
@@ -858,6 +1064,8 @@ double FixACKS2ReaxFF::memory_usage()
   bytes += n_cap*4.0 * sizeof(int); // matrix...
   bytes += m_cap*2.0 * sizeof(int);
   bytes += m_cap*2.0 * sizeof(double);
+  if (solver == SOLVER_PIPELINED)
+    bytes += size*4.0 * sizeof(double); // pipelined BiCGStab
 
   return bytes;
 }
@@ -940,13 +1148,28 @@ double FixACKS2ReaxFF::parallel_norm(double *v, int n)
 
 double FixACKS2ReaxFF::parallel_dot(double *v1, double *v2, int n)
 {
-  int  i;
   double my_dot, res;
 
+  my_dot = local_dot(v1, v2, n);
+  res = 0.0;
+
+  MPI_Allreduce(&my_dot, &res, 1, MPI_DOUBLE, MPI_SUM, world);
+
+  return res;
+}
+
+/* ----------------------------------------------------------------------
+   contribution of this proc to the dot product of two vectors
+------------------------------------------------------------------------- */
+
+double FixACKS2ReaxFF::local_dot(double *v1, double *v2, int n)
+{
+  int  i;
+  double my_dot;
+
   int ii;
 
   my_dot = 0.0;
-  res = 0.0;
   for (ii = 0; ii < n; ++ii) {
     i = ilist[ii];
     if (atom->mask[i] & groupbit) {
@@ -961,9 +1184,7 @@ double FixACKS2ReaxFF::parallel_dot(double *v1, double *v2, int n)
     my_dot += v1[2*NN + 1] * v2[2*NN + 1];
   }
 
-  MPI_Allreduce(&my_dot, &res, 1, MPI_DOUBLE, MPI_SUM, world);
-
-  return res;
+  return my_dot;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -49,12 +49,16 @@ class FixACKS2ReaxFF : public FixQEqReaxFF {
   //BiCGStab storage
   double *g, *q_hat, *r_hat, *y, *z;
 
+  // pipelined BiCGStab storage, in addition to ps and pw
+  double *pt, *pv;
+
   void pertype_parameters(char *) override;
   void init_bondcut();
   void allocate_storage() override;
   void deallocate_storage() override;
   void allocate_matrix() override;
   void deallocate_matrix() override;
+  void grow_matrix(bigint) override;
 
   void init_matvec() override;
   void compute_X();
@@ -62,6 +66,10 @@ class FixACKS2ReaxFF : public FixQEqReaxFF {
   void calculate_Q() override;
 
   int BiCGStab(double *, double *);
+  int pipelined_BiCGStab(double *, double *);
+  void precond_acks2(double *, double *);
+  void precond_matvec_acks2(double *, double *, int);
+  double local_dot(double *, double *, int);
   void sparse_matvec_acks2(sparse_matrix *, sparse_matrix *, double *, double *);
 
   int pack_forward_comm(int, int *, double *, int, int *) override;
@@ -45,6 +45,7 @@
 #include <cmath>
 #include <cstring>
 #include <exception>
+#include <vector>
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
@@ -74,7 +75,7 @@ FixQEqReaxFF::FixQEqReaxFF(LAMMPS *lmp, int narg, char **arg) :
   imax = 200;
   maxwarn = 1;
 
-  if ((narg < 8) || (narg > 12)) error->all(FLERR,"Illegal fix qeq/reaxff command");
+  if (narg < 8) error->all(FLERR,"Illegal fix qeq/reaxff command");
 
   nevery = utils::inumeric(FLERR,arg[3],false,lmp);
   if (nevery <= 0) error->all(FLERR,"Illegal fix qeq/reaxff command");
@@ -88,16 +89,42 @@ FixQEqReaxFF::FixQEqReaxFF(LAMMPS *lmp, int narg, char **arg) :
   // check for compatibility is in Fix::post_constructor()
 
   dual_enabled = 0;
+  solver = SOLVER_STANDARD;
+  precond = PRECOND_JACOBI;
+  reuse_flag = 0;
+  reuse_tol = 0.0;
 
   int iarg = 8;
   while (iarg < narg) {
     if (strcmp(arg[iarg],"dual") == 0) dual_enabled = 1;
     else if (strcmp(arg[iarg],"nowarn") == 0) maxwarn = 0;
-    else if (strcmp(arg[iarg],"maxiter") == 0) {
+    else if (strcmp(arg[iarg],"reuse") == 0) reuse_flag = 1;
+    else if (strcmp(arg[iarg],"reusetol") == 0) {
+      if (iarg+1 > narg-1)
+        error->all(FLERR,"Illegal fix {} command", style);
+      reuse_tol = utils::numeric(FLERR,arg[iarg+1],false,lmp);
+      if (reuse_tol < 0.0) error->all(FLERR,"Fix {} reusetol must be >= 0.0", style);
+      reuse_flag = 1;
+      iarg++;
+    } else if (strcmp(arg[iarg],"maxiter") == 0) {
       if (iarg+1 > narg-1)
         error->all(FLERR,"Illegal fix {} command", style);
       imax = utils::numeric(FLERR,arg[iarg+1],false,lmp);
       iarg++;
+    } else if (strcmp(arg[iarg],"solver") == 0) {
+      if (iarg+1 > narg-1)
+        error->all(FLERR,"Illegal fix {} command", style);
+      if (strcmp(arg[iarg+1],"standard") == 0) solver = SOLVER_STANDARD;
+      else if (strcmp(arg[iarg+1],"pipelined") == 0) solver = SOLVER_PIPELINED;
+      else error->all(FLERR,"Unknown fix {} solver {}", style, arg[iarg+1]);
+      iarg++;
+    } else if (strcmp(arg[iarg],"precond") == 0) {
+      if (iarg+1 > narg-1)
+        error->all(FLERR,"Illegal fix {} command", style);
+      if (strcmp(arg[iarg+1],"jacobi") == 0) precond = PRECOND_JACOBI;
+      else if (strcmp(arg[iarg+1],"ic") == 0) precond = PRECOND_IC;
+      else error->all(FLERR,"Unknown fix {} preconditioner {}", style, arg[iarg+1]);
+      iarg++;
     } else error->all(FLERR,"Illegal fix {} command", style);
     iarg++;
   }
@@ -125,6 +152,17 @@ FixQEqReaxFF::FixQEqReaxFF(LAMMPS *lmp, int narg, char **arg) :
   r = nullptr;
   d = nullptr;
 
+  // pipelined CG
+
+  pu = pw = pz = pq = ps = nullptr;
+
+  // incomplete Cholesky preconditioner
+
+  ic_n = ic_nmax = ic_mmax = 0;
+  ic_first = ic_col = ic_pos = nullptr;
+  ic_val = ic_diag = nullptr;
+  ic_lastcall = -1;
+
   // H matrix
 
   H.firstnbr = nullptr;
@@ -132,6 +170,13 @@ FixQEqReaxFF::FixQEqReaxFF(LAMMPS *lmp, int narg, char **arg) :
   H.jlist = nullptr;
   H.val = nullptr;
 
+  Hc.firstnbr = nullptr;
+  Hc.numnbrs = nullptr;
+  Hc.jlist = nullptr;
+  Hc.val = nullptr;
+  Hc_dist = nullptr;
+  Hc_lastcall = -1;
+
   // dual CG support
   // Update comm sizes for this fix
 
@@ -165,6 +210,12 @@ FixQEqReaxFF::~FixQEqReaxFF()
   FixQEqReaxFF::deallocate_storage();
   FixQEqReaxFF::deallocate_matrix();
 
+  memory->destroy(ic_first);
+  memory->destroy(ic_col);
+  memory->destroy(ic_pos);
+  memory->destroy(ic_val);
+  memory->destroy(ic_diag);
+
   memory->destroy(shld);
 
   if (!reaxflag) {
@@ -303,6 +354,14 @@ void FixQEqReaxFF::allocate_storage()
   memory->create(q,size,"qeq:q");
   memory->create(r,size,"qeq:r");
   memory->create(d,size,"qeq:d");
+
+  if (solver == SOLVER_PIPELINED) {
+    memory->create(pu,nmax,"qeq:pu");
+    memory->create(pw,nmax,"qeq:pw");
+    memory->create(pz,nmax,"qeq:pz");
+    memory->create(pq,nmax,"qeq:pq");
+    memory->create(ps,nmax,"qeq:ps");
+  }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -323,6 +382,12 @@ void FixQEqReaxFF::deallocate_storage()
   memory->destroy(q);
   memory->destroy(r);
   memory->destroy(d);
+
+  memory->destroy(pu);
+  memory->destroy(pw);
+  memory->destroy(pz);
+  memory->destroy(pq);
+  memory->destroy(ps);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -338,9 +403,6 @@ void FixQEqReaxFF::reallocate_storage()
 
 void FixQEqReaxFF::allocate_matrix()
 {
-  int i,ii;
-  bigint m;
-
   int mincap;
   double safezone;
 
@@ -354,17 +416,10 @@ void FixQEqReaxFF::allocate_matrix()
 
   n_cap = MAX((int)(atom->nlocal * safezone), mincap);
 
-  // determine the total space for the H matrix
+  // space for the H matrix is grown while it is filled in,
+  // so it follows the actual number of nonzeros
 
-  m = 0;
-  for (ii = 0; ii < nn; ii++) {
-    i = ilist[ii];
-    m += numneigh[i];
-  }
-  bigint m_cap_big = (bigint)MAX(m * safezone, mincap * REAX_MIN_NBRS);
-  if (m_cap_big > MAXSMALLINT)
-    error->one(FLERR,"Too many neighbors in fix {}",style);
-  m_cap = m_cap_big;
+  m_cap = MAX(m_cap, mincap * REAX_MIN_NBRS);
 
   H.n = n_cap;
   H.m = m_cap;
@@ -372,6 +427,17 @@ void FixQEqReaxFF::allocate_matrix()
   memory->create(H.numnbrs,n_cap,"qeq:H.numnbrs");
   memory->create(H.jlist,m_cap,"qeq:H.jlist");
   memory->create(H.val,m_cap,"qeq:H.val");
+
+  if (reuse_flag) {
+    Hc.n = n_cap;
+    Hc.m = m_cap;
+    memory->create(Hc.firstnbr,n_cap,"qeq:Hc.firstnbr");
+    memory->create(Hc.numnbrs,n_cap,"qeq:Hc.numnbrs");
+    memory->create(Hc.jlist,m_cap,"qeq:Hc.jlist");
+    memory->create(Hc.val,m_cap,"qeq:Hc.val");
+    memory->create(Hc_dist,m_cap,"qeq:Hc_dist");
+  }
+  Hc_lastcall = -1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -382,6 +448,12 @@ void FixQEqReaxFF::deallocate_matrix()
   memory->destroy(H.numnbrs);
   memory->destroy(H.jlist);
   memory->destroy(H.val);
+
+  memory->destroy(Hc.firstnbr);
+  memory->destroy(Hc.numnbrs);
+  memory->destroy(Hc.jlist);
+  memory->destroy(Hc.val);
+  memory->destroy(Hc_dist);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -392,6 +464,33 @@ void FixQEqReaxFF::reallocate_matrix()
   allocate_matrix();
 }
 
+/* ----------------------------------------------------------------------
+   grow space for nonzeros of the H matrix to hold at least m entries,
+   keeping the entries already filled in
+------------------------------------------------------------------------- */
+
+void FixQEqReaxFF::grow_matrix(bigint m)
+{
+  if (m <= m_cap) return;
+
+  double safezone = reaxflag ? reaxff->api->system->safezone : REAX_SAFE_ZONE;
+  m = MAX((bigint) (m * safezone), m);
+  if (m > MAXSMALLINT)
+    error->one(FLERR,"Too many neighbors in fix {}",style);
+  m_cap = m;
+
+  H.m = m_cap;
+  memory->grow(H.jlist,m_cap,"qeq:H.jlist");
+  memory->grow(H.val,m_cap,"qeq:H.val");
+
+  if (reuse_flag) {
+    Hc.m = m_cap;
+    memory->grow(Hc.jlist,m_cap,"qeq:Hc.jlist");
+    memory->grow(Hc.val,m_cap,"qeq:Hc.val");
+    memory->grow(Hc_dist,m_cap,"qeq:Hc_dist");
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixQEqReaxFF::init()
@@ -539,6 +638,7 @@ void FixQEqReaxFF::setup_pre_force(int vflag)
   deallocate_matrix();
   allocate_matrix();
 
+  ic_lastcall = -1;
   pre_force(vflag);
 }
 
@@ -601,12 +701,13 @@ void FixQEqReaxFF::pre_force(int /*vflag*/)
   // need to be atom->nmax in length
 
   if (atom->nmax > nmax) reallocate_storage();
-  if (n > n_cap*DANGER_ZONE || m_fill > m_cap*DANGER_ZONE)
+  if (n > n_cap*DANGER_ZONE)
     reallocate_matrix();
 
   if (efield) get_chi_field();
 
   init_matvec();
+  setup_precond();
 
   matvecs_s = CG(b_s, s);       // CG on s - parallel
   matvecs_t = CG(b_t, t);       // CG on t - parallel
@@ -666,6 +767,12 @@ void FixQEqReaxFF::init_matvec()
 
 void FixQEqReaxFF::compute_H()
 {
+  if (reuse_flag) {
+    if (Hc_lastcall != neighbor->lastcall) compute_H_pattern();
+    update_H();
+    return;
+  }
+
   int jnum;
   int i, j, ii, jj, flag;
   double dx, dy, dz, r_sqr;
@@ -684,6 +791,7 @@ void FixQEqReaxFF::compute_H()
     if (mask[i] & groupbit) {
       jlist = firstneigh[i];
       jnum = numneigh[i];
+      grow_matrix((bigint)m_fill + jnum);
       H.firstnbr[i] = m_fill;
 
       for (jj = 0; jj < jnum; jj++) {
@@ -718,10 +826,114 @@ void FixQEqReaxFF::compute_H()
       H.numnbrs[i] = m_fill - H.firstnbr[i];
     }
   }
+}
+
+/* ----------------------------------------------------------------------
+   set up the list of candidate pairs for H after a neighbor list build.
+   these are all pairs that may come within the Taper cutoff before the
+   next build, i.e. within swb plus the neighbor skin. rows of H use the
+   same offsets, so that update_H() can process rows independently.
+------------------------------------------------------------------------- */
+
+void FixQEqReaxFF::compute_H_pattern()
+{
+  int jnum;
+  int i, j, ii, jj, flag;
+  double dx, dy, dz, r_sqr;
+  constexpr double EPSILON = 0.0001;
+
+  tagint *tag = atom->tag;
+  double **x = atom->x;
+  int *mask = atom->mask;
+
+  const double cutsq = SQR(swb + neighbor->skin);
+  Hc_lastcall = neighbor->lastcall;
+
+  m_fill = 0;
+  for (ii = 0; ii < nn; ii++) {
+    i = ilist[ii];
+    if (mask[i] & groupbit) {
+      jlist = firstneigh[i];
+      jnum = numneigh[i];
+      grow_matrix((bigint)m_fill + jnum);
+      Hc.firstnbr[i] = H.firstnbr[i] = m_fill;
+
+      for (jj = 0; jj < jnum; jj++) {
+        j = jlist[jj];
+        j &= NEIGHMASK;
+
+        dx = x[j][0] - x[i][0];
+        dy = x[j][1] - x[i][1];
+        dz = x[j][2] - x[i][2];
+        r_sqr = SQR(dx) + SQR(dy) + SQR(dz);
+
+        flag = 0;
+        if (r_sqr <= cutsq) {
+          if (j < atom->nlocal) flag = 1;
+          else if (tag[i] < tag[j]) flag = 1;
+          else if (tag[i] == tag[j]) {
+            if (dz > EPSILON) flag = 1;
+            else if (fabs(dz) < EPSILON) {
+              if (dy > EPSILON) flag = 1;
+              else if (fabs(dy) < EPSILON && dx > EPSILON)
+                flag = 1;
+            }
+          }
+        }
+
+        if (flag) {
+          Hc.jlist[m_fill] = j;
+          Hc_dist[m_fill] = -1.0;
+          m_fill++;
+        }
+      }
+      Hc.numnbrs[i] = m_fill - Hc.firstnbr[i];
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   fill H from the candidate pairs for the current positions.
+   a value is only recomputed if the pair distance changed by more than
+   reuse_tol since its last evaluation, otherwise the cached value is used.
+------------------------------------------------------------------------- */
+
+void FixQEqReaxFF::update_H()
+{
+  int i, j, ii, itr_j, mfill;
+  double dx, dy, dz, r;
 
-  if (m_fill >= H.m)
-    error->all(FLERR,"Fix qeq/reaxff H matrix size has been exceeded: m_fill={} H.m={}\n",
-               m_fill, H.m);
+  const int *type = atom->type;
+  const int *mask = atom->mask;
+  double **x = atom->x;
+  const double swbsq = SQR(swb);
+
+  for (ii = 0; ii < nn; ii++) {
+    i = ilist[ii];
+    if (mask[i] & groupbit) {
+      const double *shldi = shld[type[i]];
+      mfill = H.firstnbr[i];
+
+      for (itr_j = Hc.firstnbr[i]; itr_j < Hc.firstnbr[i] + Hc.numnbrs[i]; itr_j++) {
+        j = Hc.jlist[itr_j];
+        dx = x[j][0] - x[i][0];
+        dy = x[j][1] - x[i][1];
+        dz = x[j][2] - x[i][2];
+        r = SQR(dx) + SQR(dy) + SQR(dz);
+        if (r > swbsq) continue;
+
+        r = sqrt(r);
+        if (fabs(r - Hc_dist[itr_j]) > reuse_tol) {
+          Hc_dist[itr_j] = r;
+          Hc.val[itr_j] = calculate_H(r, shldi[type[j]]);
+        }
+        H.jlist[mfill] = j;
+        H.val[mfill] = Hc.val[itr_j];
+        mfill++;
+      }
+      H.numnbrs[i] = mfill - H.firstnbr[i];
+    }
+  }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -748,23 +960,19 @@ double FixQEqReaxFF::calculate_H(double r, double gamma)
 
 int FixQEqReaxFF::CG(double *b, double *x)
 {
-  int  i, j;
+  if (solver == SOLVER_PIPELINED) return pipelined_CG(b, x);
+
+  int  i;
   double tmp, alpha, beta, b_norm;
   double sig_old, sig_new;
 
-  int jj;
-
   pack_flag = 1;
   sparse_matvec(&H, x, q);
   comm->reverse_comm(this); //Coll_Vector(q);
 
   vector_sum(r , 1.,  b, -1., q, nn);
 
-  for (jj = 0; jj < nn; ++jj) {
-    j = ilist[jj];
-    if (atom->mask[j] & groupbit)
-      d[j] = r[j] * Hdia_inv[j]; //pre-condition
-  }
+  apply_precond(r, d); //pre-condition
 
   b_norm = parallel_norm(b, nn);
   sig_new = parallel_dot(r, d, nn);
@@ -781,11 +989,7 @@ int FixQEqReaxFF::CG(double *b, double *x)
     vector_add(r, -alpha, q, nn);
 
     // pre-conditioning
-    for (jj = 0; jj < nn; ++jj) {
-      j = ilist[jj];
-      if (atom->mask[j] & groupbit)
-        p[j] = r[j] * Hdia_inv[j];
-    }
+    apply_precond(r, p);
 
     sig_old = sig_new;
     sig_new = parallel_dot(r, p, nn);
@@ -800,6 +1004,291 @@ int FixQEqReaxFF::CG(double *b, double *x)
   return i;
 }
 
+/* ----------------------------------------------------------------------
+   pipelined preconditioned CG, P. Ghysels and W. Vanroose,
+   Parallel Computing, 40, 224 (2014).
+   the two dot products of an iteration and the norm of b are combined
+   into a single non-blocking reduction that is overlapped with the
+   preconditioner and the matrix-vector product including its communication.
+   the recurrences are restarted from the true residual every RESTART
+   iterations to limit the accumulation of rounding errors.
+------------------------------------------------------------------------- */
+
+int FixQEqReaxFF::pipelined_CG(double *b, double *x)
+{
+  constexpr int RESTART = 100;
+
+  int i, ii, jj;
+  double alpha, beta, gamma, gamma_old, delta, b_norm;
+  double my_buf[3], buf[3];
+  MPI_Request request;
+
+  const int *mask = atom->mask;
+
+  my_buf[2] = 0.0;
+  for (jj = 0; jj < nn; ++jj) {
+    ii = ilist[jj];
+    if (mask[ii] & groupbit) my_buf[2] += b[ii] * b[ii];
+  }
+
+  alpha = gamma_old = 1.0;
+  for (i = 1; i < imax; ++i) {
+    const int restart = ((i - 1) % RESTART == 0);
+
+    // r = b - A x, u = M^-1 r, w = A u
+
+    if (restart) {
+      for (jj = 0; jj < nn; ++jj) {
+        ii = ilist[jj];
+        if (mask[ii] & groupbit) d[ii] = x[ii];
+      }
+
+      pack_flag = 1;
+      comm->forward_comm(this); //Dist_vector(d);
+      sparse_matvec(&H, d, q);
+      comm->reverse_comm(this); //Coll_Vector(q);
+
+      vector_sum(r, 1., b, -1., q, nn);
+      apply_precond(r, d);
+
+      for (jj = 0; jj < nn; ++jj) {
+        ii = ilist[jj];
+        if (mask[ii] & groupbit) pu[ii] = d[ii];
+      }
+
+      comm->forward_comm(this); //Dist_vector(d);
+      sparse_matvec(&H, d, q);
+      comm->reverse_comm(this); //Coll_vector(q);
+
+      for (jj = 0; jj < nn; ++jj) {
+        ii = ilist[jj];
+        if (mask[ii] & groupbit) {
+          pw[ii] = q[ii];
+          pz[ii] = pq[ii] = ps[ii] = p[ii] = 0.0;
+        }
+      }
+    }
+
+    my_buf[0] = my_buf[1] = 0.0;
+    for (jj = 0; jj < nn; ++jj) {
+      ii = ilist[jj];
+      if (mask[ii] & groupbit) {
+        my_buf[0] += r[ii] * pu[ii];
+        my_buf[1] += pw[ii] * pu[ii];
+      }
+    }
+    MPI_Iallreduce(my_buf, buf, 3, MPI_DOUBLE, MPI_SUM, world, &request);
+
+    // m = M^-1 w in d and n = A m in q while the reduction is in flight
+
+    apply_precond(pw, d);
+    comm->forward_comm(this); //Dist_vector(d);
+    sparse_matvec(&H, d, q);
+    comm->reverse_comm(this); //Coll_vector(q);
+
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+    gamma = buf[0];
+    delta = buf[1];
+    b_norm = sqrt(buf[2]);
+    if (sqrt(fabs(gamma)) / b_norm <= tolerance) break;
+
+    if (restart) {
+      beta = 0.0;
+      alpha = gamma / delta;
+    } else {
+      beta = gamma / gamma_old;
+      alpha = gamma / (delta - beta * gamma / alpha);
+    }
+    gamma_old = gamma;
+
+    for (jj = 0; jj < nn; ++jj) {
+      ii = ilist[jj];
+      if (mask[ii] & groupbit) {
+        pz[ii] = q[ii] + beta * pz[ii];
+        pq[ii] = d[ii] + beta * pq[ii];
+        ps[ii] = pw[ii] + beta * ps[ii];
+        p[ii] = pu[ii] + beta * p[ii];
+        x[ii] += alpha * p[ii];
+        r[ii] -= alpha * ps[ii];
+        pu[ii] -= alpha * pq[ii];
+        pw[ii] -= alpha * pz[ii];
+      }
+    }
+  }
+
+  if ((i >= imax) && maxwarn && (comm->me == 0))
+    error->warning(FLERR, "Fix qeq/reaxff pipelined CG convergence failed after {} iterations "
+                   "at step {}", i, update->ntimestep);
+  return i;
+}
+
+/* ----------------------------------------------------------------------
+   incomplete Cholesky factorization without fill-in, H ~ L L^T, of the
+   block of H between local atoms. couplings to ghost atoms are dropped,
+   which makes this a block Jacobi preconditioner across MPI ranks.
+   the factor is recomputed only after the neighbor lists were rebuilt,
+   since only then local atom indices and the sparsity pattern can change.
+------------------------------------------------------------------------- */
+
+void FixQEqReaxFF::setup_precond()
+{
+  if (precond != PRECOND_IC) return;
+  if (ic_lastcall == neighbor->lastcall) return;
+  ic_lastcall = neighbor->lastcall;
+
+  int i, j, k, kk, ii, jj, itr_j;
+  const int nlocal = atom->nlocal;
+  const int *mask = atom->mask;
+  const int *type = atom->type;
+
+  // count entries per row of L, i.e. couplings of atom i to atoms j < i
+
+  if (nlocal + 1 > ic_nmax) {
+    ic_nmax = nlocal + 1;
+    memory->destroy(ic_first);
+    memory->destroy(ic_pos);
+    memory->destroy(ic_diag);
+    memory->create(ic_first,ic_nmax,"qeq:ic_first");
+    memory->create(ic_pos,ic_nmax,"qeq:ic_pos");
+    memory->create(ic_diag,ic_nmax,"qeq:ic_diag");
+  }
+  ic_n = nlocal;
+
+  for (i = 0; i <= nlocal; ++i) ic_first[i] = 0;
+
+  for (ii = 0; ii < nn; ++ii) {
+    i = ilist[ii];
+    if (mask[i] & groupbit) {
+      for (itr_j = H.firstnbr[i]; itr_j < H.firstnbr[i] + H.numnbrs[i]; itr_j++) {
+        j = H.jlist[itr_j];
+        if ((j < nlocal) && (mask[j] & groupbit)) ic_first[MAX(i,j)+1]++;
+      }
+    }
+  }
+  for (i = 0; i < nlocal; ++i) ic_first[i+1] += ic_first[i];
+
+  const int nnz = ic_first[nlocal];
+  if (nnz > ic_mmax) {
+    ic_mmax = nnz;
+    memory->destroy(ic_col);
+    memory->destroy(ic_val);
+    memory->create(ic_col,ic_mmax,"qeq:ic_col");
+    memory->create(ic_val,ic_mmax,"qeq:ic_val");
+  }
+
+  // fill the lower triangle with ascending column index in each row.
+  // the transposed (upper) triangle is collected by row first, so that
+  // traversing it row by row visits the columns of L in ascending order.
+
+  std::vector<int> ufirst(nlocal+1, 0), ucol(nnz);
+  std::vector<double> uval(nnz);
+
+  for (ii = 0; ii < nn; ++ii) {
+    i = ilist[ii];
+    if (mask[i] & groupbit) {
+      for (itr_j = H.firstnbr[i]; itr_j < H.firstnbr[i] + H.numnbrs[i]; itr_j++) {
+        j = H.jlist[itr_j];
+        if ((j < nlocal) && (mask[j] & groupbit)) ufirst[MIN(i,j)+1]++;
+      }
+    }
+  }
+  for (i = 0; i < nlocal; ++i) ufirst[i+1] += ufirst[i];
+
+  for (ii = 0; ii < nn; ++ii) {
+    i = ilist[ii];
+    if (mask[i] & groupbit) {
+      for (itr_j = H.firstnbr[i]; itr_j < H.firstnbr[i] + H.numnbrs[i]; itr_j++) {
+        j = H.jlist[itr_j];
+        if ((j < nlocal) && (mask[j] & groupbit)) {
+          k = ufirst[MIN(i,j)]++;
+          ucol[k] = MAX(i,j);
+          uval[k] = H.val[itr_j];
+        }
+      }
+    }
+  }
+  for (i = nlocal; i > 0; --i) ufirst[i] = ufirst[i-1];
+  ufirst[0] = 0;
+
+  for (i = 0; i < nlocal; ++i) ic_pos[i] = ic_first[i];
+  for (j = 0; j < nlocal; ++j) {
+    for (k = ufirst[j]; k < ufirst[j+1]; ++k) {
+      i = ucol[k];
+      kk = ic_pos[i]++;
+      ic_col[kk] = j;
+      ic_val[kk] = uval[k];
+    }
+  }
+
+  // factorize row by row: L_ij = (H_ij - sum_k<j L_ik L_jk) / L_jj
+  // ic_pos marks the position of column k in the current row i.
+  // a too small pivot falls back to the diagonal of H for that row.
+
+  constexpr double MINPIVOT = 0.001;
+
+  for (i = 0; i < nlocal; ++i) ic_pos[i] = -1;
+
+  for (i = 0; i < nlocal; ++i) {
+    if (!(mask[i] & groupbit)) {
+      ic_diag[i] = 1.0;
+      continue;
+    }
+    for (k = ic_first[i]; k < ic_first[i+1]; ++k) ic_pos[ic_col[k]] = k;
+
+    double diag = eta[type[i]];
+    for (k = ic_first[i]; k < ic_first[i+1]; ++k) {
+      j = ic_col[k];
+      double sum = ic_val[k];
+      for (jj = ic_first[j]; jj < ic_first[j+1]; ++jj) {
+        kk = ic_pos[ic_col[jj]];
+        if (kk >= 0) sum -= ic_val[kk] * ic_val[jj];
+      }
+      ic_val[k] = sum / ic_diag[j];
+      diag -= ic_val[k] * ic_val[k];
+    }
+    if (diag > MINPIVOT * eta[type[i]]) ic_diag[i] = sqrt(diag);
+    else ic_diag[i] = sqrt(eta[type[i]]);
+
+    for (k = ic_first[i]; k < ic_first[i+1]; ++k) ic_pos[ic_col[k]] = -1;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   apply preconditioner z = M^-1 r to local atoms
+------------------------------------------------------------------------- */
+
+void FixQEqReaxFF::apply_precond(double *r, double *z)
+{
+  int i, ii, k;
+  const int *mask = atom->mask;
+
+  if (precond == PRECOND_JACOBI) {
+    for (ii = 0; ii < nn; ++ii) {
+      i = ilist[ii];
+      if (mask[i] & groupbit) z[i] = r[i] * Hdia_inv[i];
+    }
+    return;
+  }
+
+  // forward substitution L y = r, then backward substitution L^T z = y
+
+  for (i = 0; i < ic_n; ++i) {
+    if (mask[i] & groupbit) {
+      double sum = r[i];
+      for (k = ic_first[i]; k < ic_first[i+1]; ++k) sum -= ic_val[k] * z[ic_col[k]];
+      z[i] = sum / ic_diag[i];
+    }
+  }
+
+  for (i = ic_n-1; i >= 0; --i) {
+    if (mask[i] & groupbit) {
+      z[i] /= ic_diag[i];
+      const double zi = z[i];
+      for (k = ic_first[i]; k < ic_first[i+1]; ++k) z[ic_col[k]] -= ic_val[k] * zi;
+    }
+  }
+}
+
 
 /* ---------------------------------------------------------------------- */
 
@@ -965,10 +1454,20 @@ double FixQEqReaxFF::memory_usage()
   bytes += (double)n_cap*2 * sizeof(int); // matrix...
   bytes += (double)m_cap * sizeof(int);
   bytes += (double)m_cap * sizeof(double);
+  if (reuse_flag) {
+    bytes += (double)n_cap*2 * sizeof(int); // candidate pairs
+    bytes += (double)m_cap * sizeof(int);
+    bytes += (double)m_cap*2 * sizeof(double);
+  }
 
   if (dual_enabled)
     bytes += (double)atom->nmax*4 * sizeof(double); // double size for q, d, r, and p
 
+  if (solver == SOLVER_PIPELINED)
+    bytes += (double)atom->nmax*5 * sizeof(double); // pipelined CG
+  bytes += (double)ic_nmax*2 * sizeof(int) + (double)ic_nmax * sizeof(double);
+  bytes += (double)ic_mmax * (sizeof(int) + sizeof(double)); // incomplete Cholesky factor
+
   return bytes;
 }
 
@@ -56,6 +56,9 @@ class FixQEqReaxFF : public Fix {
 
   double compute_scalar() override;
 
+  enum { SOLVER_STANDARD, SOLVER_PIPELINED };
+  enum { PRECOND_JACOBI, PRECOND_IC };
+
  protected:
   int nevery, reaxflag;
   int matvecs;
@@ -91,6 +94,16 @@ class FixQEqReaxFF : public Fix {
 
   sparse_matrix H;
   double *Hdia_inv;
+
+  // reuse of the sparsity pattern of H between neighbor list builds
+  // Hc holds all candidate pairs within swb plus the neighbor skin,
+  // the cached values of H and the distances they were computed for
+
+  int reuse_flag;
+  double reuse_tol;
+  sparse_matrix Hc;
+  double *Hc_dist;
+  bigint Hc_lastcall;
   double *b_s, *b_t;
   double *b_prc, *b_prm;
   double *chi_field;
@@ -99,6 +112,19 @@ class FixQEqReaxFF : public Fix {
   double *p, *q, *r, *d;
   int imax, maxwarn;
 
+  // solver and preconditioner choice
+  int solver, precond;
+
+  // pipelined CG storage
+  double *pu, *pw, *pz, *pq, *ps;
+
+  // incomplete Cholesky factor L of the block of H coupling local atoms
+  // stored as strictly lower triangle in CSR format plus diagonal
+  int ic_n, ic_nmax, ic_mmax;
+  int *ic_first, *ic_col, *ic_pos;
+  double *ic_val, *ic_diag;
+  bigint ic_lastcall;
+
   char *pertype_option;    // argument to determine how per-type info is obtained
   virtual void pertype_parameters(char *);
   void init_shielding();
@@ -109,16 +135,23 @@ class FixQEqReaxFF : public Fix {
   virtual void allocate_matrix();
   virtual void deallocate_matrix();
   void reallocate_matrix();
+  virtual void grow_matrix(bigint);
 
   virtual void init_matvec();
   void init_H();
   virtual void compute_H();
+  void compute_H_pattern();
+  virtual void update_H();
   double calculate_H(double, double);
   virtual void calculate_Q();
 
   virtual int CG(double *, double *);
+  int pipelined_CG(double *, double *);
   virtual void sparse_matvec(sparse_matrix *, double *, double *);
 
+  void setup_precond();
+  void apply_precond(double *, double *);
+
   int pack_forward_comm(int, int *, double *, int, int *) override;
   void unpack_forward_comm(int, int, double *) override;
   int pack_reverse_comm(int, int, double *) override;
@@ -33,6 +33,7 @@
 #include "modify.h"
 #include "neigh_list.h"
 #include "neighbor.h"
+#include "union_find.h"
 #include "update.h"
 #include "variable.h"
 
@@ -65,7 +66,7 @@ FixReaxFFSpecies::FixReaxFFSpecies(LAMMPS *lmp, int narg, char **arg) :
     Fix(lmp, narg, arg), Name(nullptr), MolName(nullptr), NMol(nullptr), nd(nullptr),
     MolType(nullptr), molmap(nullptr), mark(nullptr), Mol2Spec(nullptr), clusterID(nullptr),
     x0(nullptr), BOCut(nullptr), fp(nullptr), pos(nullptr), fdel(nullptr), delete_Tcount(nullptr),
-    filepos(nullptr), filedel(nullptr)
+    filepos(nullptr), filedel(nullptr), uf(nullptr)
 {
   if (narg < 7) utils::missing_cmd_args(FLERR, "fix reaxff/species", error);
 
@@ -93,8 +94,6 @@ FixReaxFFSpecies::FixReaxFFSpecies(LAMMPS *lmp, int narg, char **arg) :
   global_freq = nfreq = utils::inumeric(FLERR, arg[5], false, lmp);
   if (nrepeat == 1) dynamic_group_allow = 1;
 
-  comm_forward = 4;
-
   if (nevery <= 0) error->all(FLERR, "Invalid fix reaxff/species nevery value {}", nevery);
   if (nrepeat <= 0) error->all(FLERR, "Invalid fix reaxff/species nrepeat value {}", nrepeat);
   if (nfreq <= 0) error->all(FLERR, "Invalid fix reaxff/species nfreq value {}", nfreq);
@@ -144,9 +143,10 @@ FixReaxFFSpecies::FixReaxFFSpecies(LAMMPS *lmp, int narg, char **arg) :
   clusterID = nullptr;
 
   int ntmp = 1;
-  memory->create(x0, ntmp, "reaxff/species:x0");
+  memory->create(x0, ntmp, 3, "reaxff/species:x0");
   memory->create(clusterID, ntmp, "reaxff/species:clusterID");
   vector_atom = clusterID;
+  uf = new UnionFind(lmp);
 
   nmax = 0;
   setupflag = 0;
@@ -304,6 +304,7 @@ FixReaxFFSpecies::~FixReaxFFSpecies()
   memory->destroy(BOCut);
   memory->destroy(clusterID);
   memory->destroy(x0);
+  delete uf;
 
   memory->destroy(nd);
   memory->destroy(Name);
@@ -439,12 +440,12 @@ void FixReaxFFSpecies::Output_ReaxFF_Bonds(bigint ntimestep, FILE * /*fp*/)
     nmax = atom->nmax;
     memory->destroy(x0);
     memory->destroy(clusterID);
-    memory->create(x0, nmax, "reaxff/species:x0");
+    memory->create(x0, nmax, 3, "reaxff/species:x0");
     memory->create(clusterID, nmax, "reaxff/species:clusterID");
     vector_atom = clusterID;
   }
 
-  for (int i = 0; i < nmax; i++) { x0[i].x = x0[i].y = x0[i].z = 0.0; }
+  for (int i = 0; i < nmax; i++) { x0[i][0] = x0[i][1] = x0[i][2] = 0.0; }
 
   Nmole = Nspec = 0;
 
@@ -467,92 +468,61 @@ void FixReaxFFSpecies::Output_ReaxFF_Bonds(bigint ntimestep, FILE * /*fp*/)
   nvalid += nfreq;
 }
 
-/* ---------------------------------------------------------------------- */
+/* ----------------------------------------------------------------------
+   assign lowest atom ID and anchor coordinates of each molecule to its atoms
+   atoms are in the same molecule if they are linked by bonds with
+   a bond order above the cutoff
+------------------------------------------------------------------------- */
 
-AtomCoord FixReaxFFSpecies::chAnchor(AtomCoord in1, AtomCoord in2)
+void FixReaxFFSpecies::FindMolecule()
 {
-  if (in1.x < in2.x)
-    return in1;
-  else if (in1.x == in2.x) {
-    if (in1.y < in2.y)
-      return in1;
-    else if (in1.y == in2.y) {
-      if (in1.z < in2.z) return in1;
-    }
-  }
-  return in2;
+  FindMolecule(reaxff->list->inum, reaxff->list->ilist);
 }
 
 /* ---------------------------------------------------------------------- */
 
-void FixReaxFFSpecies::FindMolecule()
+void FixReaxFFSpecies::FindMolecule(int inum, int *ilist)
 {
-  int i, j, ii, jj, inum, itype, jtype, loop, looptot;
-  int change, done, anychange;
+  int i, j, ii, jj, itype, jtype;
   int *mask = atom->mask;
-  int *ilist;
   double bo_tmp, bo_cut;
   double **spec_atom = f_SPECBOND->array_atom;
 
-  inum = reaxff->list->inum;
-  ilist = reaxff->list->ilist;
-
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
     if (mask[i] & groupbit) {
       clusterID[i] = atom->tag[i];
-      x0[i].x = spec_atom[i][1];
-      x0[i].y = spec_atom[i][2];
-      x0[i].z = spec_atom[i][3];
+      x0[i][0] = spec_atom[i][1];
+      x0[i][1] = spec_atom[i][2];
+      x0[i][2] = spec_atom[i][3];
     } else
       clusterID[i] = 0.0;
   }
 
-  loop = 0;
-  while (true) {
-    comm->forward_comm(this);
-    loop++;
+  // the anchor of a molecule is the lexicographically smallest atom position
 
-    change = 0;
-    while (true) {
-      done = 1;
+  uf->reset(clusterID, 3, x0);
 
-      for (ii = 0; ii < inum; ii++) {
-        i = ilist[ii];
-        if (!(mask[i] & groupbit)) continue;
-
-        itype = atom->type[i];
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    if (!(mask[i] & groupbit)) continue;
 
-        for (jj = 0; jj < MAXSPECBOND; jj++) {
-          j = reaxff->tmpid[i][jj];
+    itype = atom->type[i];
 
-          if ((j == 0) || (j < i)) continue;
-          if (!(mask[j] & groupbit)) continue;
+    for (jj = 0; jj < MAXSPECBOND; jj++) {
+      j = reaxff->tmpid[i][jj];
 
-          if (clusterID[i] == clusterID[j] && x0[i].x == x0[j].x && x0[i].y == x0[j].y &&
-              x0[i].z == x0[j].z)
-            continue;
+      if ((j == 0) || (j < i)) continue;
+      if (!(mask[j] & groupbit)) continue;
 
-          jtype = atom->type[j];
-          bo_cut = BOCut[itype][jtype];
-          bo_tmp = spec_atom[i][jj + 7];
+      jtype = atom->type[j];
+      bo_cut = BOCut[itype][jtype];
+      bo_tmp = spec_atom[i][jj + 7];
 
-          if (bo_tmp > bo_cut) {
-            clusterID[i] = clusterID[j] = MIN(clusterID[i], clusterID[j]);
-            x0[i] = x0[j] = chAnchor(x0[i], x0[j]);
-            done = 0;
-          }
-        }
-      }
-      if (!done) change = 1;
-      if (done) break;
+      if (bo_tmp > bo_cut) uf->join(i, j);
     }
-    MPI_Allreduce(&change, &anychange, 1, MPI_INT, MPI_MAX, world);
-    if (!anychange) break;
-
-    MPI_Allreduce(&loop, &looptot, 1, MPI_INT, MPI_SUM, world);
-    if (looptot >= 400 * comm->nprocs) break;
   }
+  uf->merge();
 }
 
 /* ---------------------------------------------------------------------- */
@@ -863,12 +833,12 @@ void FixReaxFFSpecies::WritePos(int Nmole, int Nspec)
         Name[itype]++;
         count++;
         avq += spec_atom[i][0];
-        if ((x0[i].x - spec_atom[i][1]) > halfbox[0]) spec_atom[i][1] += box[0];
-        if ((spec_atom[i][1] - x0[i].x) > halfbox[0]) spec_atom[i][1] -= box[0];
-        if ((x0[i].y - spec_atom[i][2]) > halfbox[1]) spec_atom[i][2] += box[1];
-        if ((spec_atom[i][2] - x0[i].y) > halfbox[1]) spec_atom[i][2] -= box[1];
-        if ((x0[i].z - spec_atom[i][3]) > halfbox[2]) spec_atom[i][3] += box[2];
-        if ((spec_atom[i][3] - x0[i].z) > halfbox[2]) spec_atom[i][3] -= box[2];
+        if ((x0[i][0] - spec_atom[i][1]) > halfbox[0]) spec_atom[i][1] += box[0];
+        if ((spec_atom[i][1] - x0[i][0]) > halfbox[0]) spec_atom[i][1] -= box[0];
+        if ((x0[i][1] - spec_atom[i][2]) > halfbox[1]) spec_atom[i][2] += box[1];
+        if ((spec_atom[i][2] - x0[i][1]) > halfbox[1]) spec_atom[i][2] -= box[1];
+        if ((x0[i][2] - spec_atom[i][3]) > halfbox[2]) spec_atom[i][3] += box[2];
+        if ((spec_atom[i][3] - x0[i][2]) > halfbox[2]) spec_atom[i][3] -= box[2];
         for (n = 0; n < 3; n++) avx[n] += spec_atom[i][n + 1];
       }
     }
@@ -1135,47 +1105,12 @@ int FixReaxFFSpecies::nint(const double &r)
 
 /* ---------------------------------------------------------------------- */
 
-int FixReaxFFSpecies::pack_forward_comm(int n, int *list, double *buf, int /*pbc_flag*/,
-                                        int * /*pbc*/)
-{
-  int i, j, m;
-
-  m = 0;
-  for (i = 0; i < n; i++) {
-    j = list[i];
-    buf[m] = clusterID[j];
-    buf[m + 1] = x0[j].x;
-    buf[m + 2] = x0[j].y;
-    buf[m + 3] = x0[j].z;
-    m += 4;
-  }
-  return m;
-}
-
-/* ---------------------------------------------------------------------- */
-
-void FixReaxFFSpecies::unpack_forward_comm(int n, int first, double *buf)
-{
-  int i, m, last;
-
-  m = 0;
-  last = first + n;
-  for (i = first; i < last; i++) {
-    clusterID[i] = buf[m];
-    x0[i].x = buf[m + 1];
-    x0[i].y = buf[m + 2];
-    x0[i].z = buf[m + 3];
-    m += 4;
-  }
-}
-
-/* ---------------------------------------------------------------------- */
-
 double FixReaxFFSpecies::memory_usage()
 {
   double bytes;
 
   bytes = 4 * nmax * sizeof(double);    // clusterID + x0
+  bytes += uf->memory_usage();
 
   return bytes;
 }
@@ -27,10 +27,6 @@ FixStyle(reaxff/species,FixReaxFFSpecies);
 
 namespace LAMMPS_NS {
 
-typedef struct {
-  double x, y, z;
-} AtomCoord;
-
 class FixReaxFFSpecies : public Fix {
  public:
   FixReaxFFSpecies(class LAMMPS *, int, char **);
@@ -49,7 +45,7 @@ class FixReaxFFSpecies : public Fix {
   int *Name, *MolName, *NMol, *nd, *MolType, *molmap, *mark;
   int *Mol2Spec;
   double *clusterID;
-  AtomCoord *x0;
+  double **x0;    // anchor coordinates of the molecule of each atom
   double **BOCut;
 
   std::vector<std::string> del_species;
@@ -68,8 +64,8 @@ class FixReaxFFSpecies : public Fix {
   std::vector<std::string> ueletype;    // list of unique elements, of quantity nutypes
 
   void Output_ReaxFF_Bonds(bigint, FILE *);
-  AtomCoord chAnchor(AtomCoord, AtomCoord);
   virtual void FindMolecule();
+  void FindMolecule(int, int *);
   void SortMolecule(int &);
   void FindSpecies(int, int &);
   void WriteFormulas(int, int);
@@ -78,8 +74,6 @@ class FixReaxFFSpecies : public Fix {
   void GetUniqueElements();
 
   int nint(const double &);
-  int pack_forward_comm(int, int *, double *, int, int *) override;
-  void unpack_forward_comm(int, int, double *) override;
   void OpenPos();
   void WritePos(int, int);
   double memory_usage() override;
@@ -89,6 +83,7 @@ class FixReaxFFSpecies : public Fix {
   class NeighList *list;
   class FixAveAtom *f_SPECBOND;
   class PairReaxFF *reaxff;
+  class UnionFind *uf;
 };
 }    // namespace LAMMPS_NS
 
@@ -589,7 +589,6 @@ int PairReaxFF::estimate_reax_lists()
   double **x;
 
   int mincap = api->system->mincap;
-  double safezone = api->system->safezone;
 
   x = atom->x;
   ilist = list->ilist;
@@ -614,7 +613,7 @@ int PairReaxFF::estimate_reax_lists()
     }
   }
 
-  return static_cast<int> (MAX(num_nbrs*safezone, mincap*REAX_MIN_NBRS));
+  return MAX(num_nbrs, mincap*REAX_MIN_NBRS);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -660,6 +659,10 @@ int PairReaxFF::write_reax_lists()
       get_distance(x[j], x[i], &d_sqr, &dvec);
 
       if (d_sqr <= (cutoff_sqr)) {
+        if (num_nbrs == far_nbrs->num_intrs) {
+          grow_far_nbrs();
+          far_list = far_nbrs->select.far_nbr_list;
+        }
         dist[j] = sqrt(d_sqr);
         set_far_nbr(&far_list[num_nbrs], j, dist[j], dvec);
         ++num_nbrs;
@@ -673,6 +676,20 @@ int PairReaxFF::write_reax_lists()
   return num_nbrs;
 }
 
+/* ----------------------------------------------------------------------
+   grow far neighbor list by the safezone factor, keeping its contents
+------------------------------------------------------------------------- */
+
+void PairReaxFF::grow_far_nbrs()
+{
+  reax_list *far_nbrs = api->lists + FAR_NBRS;
+  bigint newsize = MAX((bigint) (far_nbrs->num_intrs * api->system->safezone),
+                       (bigint) far_nbrs->num_intrs + api->system->mincap * REAX_MIN_NBRS);
+  if (newsize > MAXSMALLINT)
+    error->one(FLERR,"Too many neighbors for pair style reaxff");
+  Grow_List(newsize, far_nbrs);
+}
+
 /* ---------------------------------------------------------------------- */
 
 void PairReaxFF::read_reax_forces(int /*vflag*/)
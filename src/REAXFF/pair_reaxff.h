@@ -78,6 +78,7 @@ class PairReaxFF : public Pair {
   void set_far_nbr(ReaxFF::far_neighbor_data *, int, double, rvec);
   int estimate_reax_lists();
   int write_reax_lists();
+  void grow_far_nbrs();
   void read_reax_forces(int);
 
   int nmax;
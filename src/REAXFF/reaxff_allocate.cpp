@@ -166,7 +166,7 @@ namespace ReaxFF {
     Make_List(n, num_intrs, TYP_FAR_NEIGHBOR, far_nbrs);
   }
 
-  static int Reallocate_HBonds_List(reax_system *system, reax_list *hbonds)
+  int Reallocate_HBonds_List(reax_system *system, reax_list *hbonds)
   {
     int i, total_hbonds;
     LAMMPS_NS::bigint total_hbonds_big;
@@ -193,8 +193,8 @@ namespace ReaxFF {
     return total_hbonds;
   }
 
-  static void Reallocate_Bonds_List(control_params *control, reax_system *system,
-                                    reax_list *bonds, int *total_bonds, int *est_3body)
+  void Reallocate_Bonds_List(control_params *control, reax_system *system,
+                             reax_list *bonds, int *total_bonds, int *est_3body)
   {
     int i;
     LAMMPS_NS::bigint total_bonds_big;
@@ -230,7 +230,7 @@ namespace ReaxFF {
   }
 
   void ReAllocate(reax_system *system, control_params *control,
-                  simulation_data *data, storage *workspace, reax_list **lists)
+                  simulation_data * /*data*/, storage *workspace, reax_list **lists)
   {
     int num_bonds, est_3body, Hflag;
     int newsize;
@@ -265,11 +265,7 @@ namespace ReaxFF {
 
     far_nbrs = *lists + FAR_NBRS;
 
-    if (Nflag || wsr->num_far >= far_nbrs->num_intrs * DANGER_ZONE) {
-      if (wsr->num_far > far_nbrs->num_intrs)
-        error->one(FLERR, "step{}: ran out of space on far_nbrs: top={}, max={}",
-                   data->step, wsr->num_far, far_nbrs->num_intrs);
-
+    if (Nflag || wsr->num_far > far_nbrs->num_intrs) {
       newsize = static_cast<int>
         (MAX(wsr->num_far*safezone, mincap*REAX_MIN_NBRS));
 
@@ -285,17 +281,14 @@ namespace ReaxFF {
         system->Hcap = int(MAX(system->numH * saferzone, mincap));
       }
 
-      if (Hflag || wsr->hbonds) {
+      if (Hflag)
         Reallocate_HBonds_List(system, (*lists)+HBONDS);
-        wsr->hbonds = 0;
-      }
     }
 
     /* bonds list */
     num_bonds = est_3body = -1;
-    if (Nflag || wsr->bonds) {
+    if (Nflag) {
       Reallocate_Bonds_List(control, system, (*lists)+BONDS, &num_bonds, &est_3body);
-      wsr->bonds = 0;
       wsr->num_3body = MAX(wsr->num_3body, est_3body) * 2;
 
 
@@ -44,12 +44,19 @@ extern void DeAllocate_System(reax_system *);
 extern void DeAllocate_Workspace(storage *);
 extern void PreAllocate_Space(reax_system *, storage *);
 extern void ReAllocate(reax_system *, control_params *, simulation_data *, storage *, reax_list **);
+extern void Reallocate_Bonds_List(control_params *, reax_system *, reax_list *, int *, int *);
+extern int Reallocate_HBonds_List(reax_system *, reax_list *);
 
 // bond orders
 
 extern void BO(reax_system *, storage *, reax_list **);
 extern int BOp(storage *, reax_list *, double, int, int, far_neighbor_data *,
                single_body_parameters *, single_body_parameters *, two_body_parameters *);
+extern double Uncorrected_BO(double, double, single_body_parameters *, single_body_parameters *,
+                             two_body_parameters *);
+extern double Uncorrected_BO(double, double, single_body_parameters *, single_body_parameters *,
+                             two_body_parameters *, double &, double &, double &, double &,
+                             double &, double &);
 extern void Add_dBond_to_Forces(reax_system *, int, int, storage *, reax_list **);
 
 // bonds
@@ -86,6 +93,7 @@ extern void Initialize(reax_system *, control_params *, simulation_data *, stora
 // lists
 
 extern void Make_List(int, int, int, reax_list *);
+extern void Grow_List(int, reax_list *);
 extern void Delete_List(reax_list *);
 
 inline int Start_Index(int i, reax_list *l)
@@ -137,6 +145,7 @@ extern void LR_vdW_Coulomb(reax_system *, storage *, control_params *, int, int,
 extern void Reset(reax_system *, control_params *, simulation_data *, storage *, reax_list **);
 extern void Reset_Simulation_Data(simulation_data *);
 extern void Reset_Workspace(reax_system *, storage *);
+extern void Reset_Neighbor_Lists(reax_system *, control_params *, reax_list **);
 
 // toolbox
 
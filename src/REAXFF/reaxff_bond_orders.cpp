@@ -145,6 +145,40 @@ namespace ReaxFF {
     }
   }
 
+  /* uncorrected bond order of a pair at distance d and its sigma, pi and
+     double pi contributions with their exponents; BOp() and the bond
+     counting before the bond list is laid out must both use this, so that
+     they agree bit for bit on which pairs are bonded */
+  double Uncorrected_BO(double bo_cut, double d, single_body_parameters *sbp_i,
+                        single_body_parameters *sbp_j, two_body_parameters *twbp,
+                        double &C12, double &C34, double &C56,
+                        double &BO_s, double &BO_pi, double &BO_pi2)
+  {
+    if (sbp_i->r_s > 0.0 && sbp_j->r_s > 0.0) {
+      C12 = twbp->p_bo1 * pow(d / twbp->r_s, twbp->p_bo2);
+      BO_s = (1.0 + bo_cut) * exp(C12);
+    } else BO_s = C12 = 0.0;
+
+    if (sbp_i->r_pi > 0.0 && sbp_j->r_pi > 0.0) {
+      C34 = twbp->p_bo3 * pow(d / twbp->r_p, twbp->p_bo4);
+      BO_pi = exp(C34);
+    } else BO_pi = C34 = 0.0;
+
+    if (sbp_i->r_pi_pi > 0.0 && sbp_j->r_pi_pi > 0.0) {
+      C56 = twbp->p_bo5 * pow(d / twbp->r_pp, twbp->p_bo6);
+      BO_pi2 = exp(C56);
+    } else BO_pi2 = C56 = 0.0;
+
+    return BO_s + BO_pi + BO_pi2;
+  }
+
+  double Uncorrected_BO(double bo_cut, double d, single_body_parameters *sbp_i,
+                        single_body_parameters *sbp_j, two_body_parameters *twbp)
+  {
+    double C12, C34, C56, BO_s, BO_pi, BO_pi2;
+    return Uncorrected_BO(bo_cut, d, sbp_i, sbp_j, twbp, C12, C34, C56, BO_s, BO_pi, BO_pi2);
+  }
+
   int BOp(storage *workspace, reax_list *bonds, double bo_cut,
           int i, int btop_i, far_neighbor_data *nbr_pj,
           single_body_parameters *sbp_i, single_body_parameters *sbp_j,
@@ -159,23 +193,8 @@ namespace ReaxFF {
     j = nbr_pj->nbr;
     rr2 = 1.0 / SQR(nbr_pj->d);
 
-    if (sbp_i->r_s > 0.0 && sbp_j->r_s > 0.0) {
-      C12 = twbp->p_bo1 * pow(nbr_pj->d / twbp->r_s, twbp->p_bo2);
-      BO_s = (1.0 + bo_cut) * exp(C12);
-    } else BO_s = C12 = 0.0;
-
-    if (sbp_i->r_pi > 0.0 && sbp_j->r_pi > 0.0) {
-      C34 = twbp->p_bo3 * pow(nbr_pj->d / twbp->r_p, twbp->p_bo4);
-      BO_pi = exp(C34);
-    } else BO_pi = C34 = 0.0;
-
-    if (sbp_i->r_pi_pi > 0.0 && sbp_j->r_pi_pi > 0.0) {
-      C56 = twbp->p_bo5 * pow(nbr_pj->d / twbp->r_pp, twbp->p_bo6);
-      BO_pi2= exp(C56);
-    } else BO_pi2 = C56 = 0.0;
-
     /* Initially BO values are the uncorrected ones, page 1 */
-    BO = BO_s + BO_pi + BO_pi2;
+    BO = Uncorrected_BO(bo_cut, nbr_pj->d, sbp_i, sbp_j, twbp, C12, C34, C56, BO_s, BO_pi, BO_pi2);
 
     if (BO >= bo_cut) {
       /****** bonds i-j and j-i ******/
@@ -74,58 +74,63 @@ namespace ReaxFF {
             Add_dBond_to_Forces(system, i, pj, workspace, lists);
   }
 
-  static void Validate_Lists(reax_system *system, reax_list **lists,
-                             int step, int N, int numH)
-  {
-    int i, comp, Hindex;
-    reax_list *bonds, *hbonds;
-
-    double saferzone = system->saferzone;
-
-    /* bond list */
-    if (N > 0) {
-      bonds = *lists + BONDS;
-
-      for (i = 0; i < N; ++i) {
-        system->my_atoms[i].num_bonds = MAX(Num_Entries(i,bonds)*2, MIN_BONDS);
+  /* first pass: exact number of bonds of each atom and of hydrogen bonds
+     of each local H atom, so the lists can be laid out without any slack */
 
-        if (i < N-1)
-          comp = Start_Index(i+1, bonds);
-        else comp = bonds->num_intrs;
+  static void Count_Bonds(reax_system *system, control_params *control, reax_list **lists)
+  {
+    int i, j, pj;
+    int type_i, type_j, ihb, jhb;
+    double cutoff;
+    reax_list *far_nbrs = *lists + FAR_NBRS;
+    far_neighbor_data *nbr_pj;
+    reax_atom *atom_i, *atom_j;
 
-        if (End_Index(i, bonds) > comp)
-          system->error_ptr->one(FLERR, fmt::format("step {}: bondchk failed: "
-                                                    "i={} end(i)={} str(i+1)={}\n",
-                                                    step,i,End_Index(i,bonds),comp));
-      }
+    for (i = 0; i < system->N; ++i) {
+      system->my_atoms[i].num_bonds = 0;
+      system->my_atoms[i].num_hbonds = 0;
     }
 
+    for (i = 0; i < system->N; ++i) {
+      atom_i = &(system->my_atoms[i]);
+      type_i = atom_i->type;
+      if (type_i < 0) continue;
 
-    /* hbonds list */
-    if (numH > 0) {
-      hbonds = *lists + HBONDS;
-
-      for (i = 0; i < N; ++i) {
-        Hindex = system->my_atoms[i].Hindex;
-        if (Hindex > -1) {
-          system->my_atoms[i].num_hbonds =
-            (int)(MAX(Num_Entries(Hindex, hbonds)*saferzone, system->minhbonds));
+      ihb = -1;
+      if (i < system->n) {
+        cutoff = MAX(control->hbond_cut, control->bond_cut);
+        if (control->hbond_cut > 0) ihb = system->reax_param.sbp[type_i].p_hbond;
+      } else cutoff = control->bond_cut;
 
-          if (Hindex < numH-1)
-            comp = Start_Index(Hindex+1, hbonds);
-          else comp = hbonds->num_intrs;
+      for (pj = Start_Index(i, far_nbrs); pj < End_Index(i, far_nbrs); ++pj) {
+        nbr_pj = &(far_nbrs->select.far_nbr_list[pj]);
+        if (nbr_pj->d > cutoff) continue;
+        j = nbr_pj->nbr;
+        atom_j = &(system->my_atoms[j]);
+        type_j = atom_j->type;
+        if (type_j < 0) continue;
+
+        if ((ihb == 1 || ihb == 2) && nbr_pj->d <= control->hbond_cut) {
+          jhb = system->reax_param.sbp[type_j].p_hbond;
+          if (ihb == 1 && jhb == 2)
+            ++atom_i->num_hbonds;
+          else if (j < system->n && ihb == 2 && jhb == 1)
+            ++atom_j->num_hbonds;
+        }
 
-          if (End_Index(Hindex, hbonds) > comp)
-            system->error_ptr->one(FLERR, fmt::format("step {}: hbondchk failed: "
-                                                      "H={} end(H)={} str(H+1)={}\n",
-                                                      step, Hindex,End_Index(Hindex,hbonds),comp));
+        if (nbr_pj->d <= control->bond_cut &&
+            Uncorrected_BO(control->bo_cut, nbr_pj->d, &(system->reax_param.sbp[type_i]),
+                           &(system->reax_param.sbp[type_j]),
+                           &(system->reax_param.tbp[type_i][type_j])) >= control->bo_cut) {
+          ++atom_i->num_bonds;
+          ++atom_j->num_bonds;
         }
       }
     }
   }
 
   static void Init_Forces_noQEq(reax_system *system, control_params *control,
-                                simulation_data *data, storage *workspace,
+                                simulation_data * /*data*/, storage *workspace,
                                 reax_list **lists) {
     int i, j, pj;
     int start_i, end_i;
@@ -150,6 +155,9 @@ namespace ReaxFF {
       workspace->bond_mark[i] = 1000; // put ghost atoms to an infinite distance
     }
 
+    Count_Bonds(system, control, lists);
+    Reset_Neighbor_Lists(system, control, lists);
+
     num_bonds = 0;
     num_hbonds = 0;
     btop_i = 0;
@@ -220,6 +228,14 @@ namespace ReaxFF {
             }
           }
 
+          // the counts use the same bond order, so running out of slots is a bug
+
+          if (nbr_pj->d <= control->bond_cut &&
+              (btop_i >= Start_Index(i, bonds) + atom_i->num_bonds ||
+               Num_Entries(j, bonds) >= atom_j->num_bonds) &&
+              Uncorrected_BO(control->bo_cut, nbr_pj->d, sbp_i, sbp_j, twbp) >= control->bo_cut)
+            system->error_ptr->one(FLERR, "ReaxFF bond list is inconsistent with the bond counts");
+
           if (//(workspace->bond_mark[i] < 3 || workspace->bond_mark[j] < 3) &&
             nbr_pj->d <= control->bond_cut &&
             BOp(workspace, bonds, control->bo_cut,
@@ -244,8 +260,6 @@ namespace ReaxFF {
 
     workspace->realloc.num_bonds = num_bonds;
     workspace->realloc.num_hbonds = num_hbonds;
-
-    Validate_Lists(system, lists, data->step, system->N, system->numH);
   }
 
   void Estimate_Storages(reax_system *system, control_params *control,
@@ -269,7 +283,6 @@ namespace ReaxFF {
 
     int mincap = system->mincap;
     double safezone = system->safezone;
-    double saferzone = system->saferzone;
 
     far_nbrs = *lists + FAR_NBRS;
     *Htop = 0;
@@ -356,13 +369,9 @@ namespace ReaxFF {
     }
 
     *Htop = (int)(MAX(*Htop * safezone, mincap * MIN_HENTRIES));
-    for (i = 0; i < system->n; ++i)
-      hb_top[i] = (int)(MAX(hb_top[i] * saferzone, system->minhbonds));
 
-    for (i = 0; i < system->N; ++i) {
+    for (i = 0; i < system->N; ++i)
       *num_3body += SQR(bond_top[i]);
-      bond_top[i] = MAX(bond_top[i] * 2, MIN_BONDS);
-    }
 
   }
 
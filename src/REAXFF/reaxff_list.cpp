@@ -29,6 +29,8 @@
 
 #include "error.h"
 
+#include <cstring>
+
 namespace ReaxFF {
 
   /************* allocate list space ******************/
@@ -77,6 +79,37 @@ namespace ReaxFF {
     }
   }
 
+  /************* grow list space, keeping its contents ******************/
+  void Grow_List(int num_intrs, reax_list *l)
+  {
+    rc_bigint size;
+    void **ptr;
+
+    if (num_intrs <= l->num_intrs) return;
+
+    switch(l->type) {
+    case TYP_THREE_BODY:
+      size = sizeof(three_body_interaction_data);
+      ptr = (void **) &l->select.three_body_list;
+      break;
+    case TYP_FAR_NEIGHBOR:
+      size = sizeof(far_neighbor_data);
+      ptr = (void **) &l->select.far_nbr_list;
+      break;
+    default:
+      l->error_ptr->all(FLERR,fmt::format("Cannot grow list type {}", l->type));
+      return;
+    }
+
+    void *data = smalloc(l->error_ptr, (rc_bigint) num_intrs * size, "list:grow");
+    if (*ptr) {
+      memcpy(data, *ptr, (rc_bigint) l->num_intrs * size);
+      sfree(*ptr);
+    }
+    *ptr = data;
+    l->num_intrs = num_intrs;
+  }
+
   void Delete_List(reax_list *l)
   {
     if (l->allocated == 0)
@@ -63,39 +63,48 @@ namespace ReaxFF {
 
   }
 
-  static void Reset_Neighbor_Lists(reax_system *system, control_params *control,
-                             storage *workspace, reax_list **lists)
+  /* set up the bonds and hbonds lists from the exact number of bonds
+     and hydrogen bonds of each atom and grow them only when needed */
+
+  void Reset_Neighbor_Lists(reax_system *system, control_params *control, reax_list **lists)
   {
-    int i, total_bonds, Hindex, total_hbonds;
-    reax_list *bonds, *hbonds;
+    int i, total_bonds, Hindex, total_hbonds, est_3body;
+    reax_list *bonds, *hbonds, *thb_intrs;
 
     /* bonds list */
     if (system->N > 0) {
       bonds = (*lists) + BONDS;
       total_bonds = 0;
+      for (i = 0; i < system->N; ++i)
+        total_bonds += system->my_atoms[i].num_bonds;
 
-      /* reset start-end indexes */
+      if (total_bonds > bonds->num_intrs) {
+        Reallocate_Bonds_List(control, system, bonds, &total_bonds, &est_3body);
+
+        /* the 3-body list is indexed by bonds */
+        thb_intrs = (*lists) + THREE_BODIES;
+        Make_List(bonds->num_intrs, thb_intrs->num_intrs, TYP_THREE_BODY, thb_intrs);
+      }
+
+      total_bonds = 0;
       for (i = 0; i < system->N; ++i) {
         Set_Start_Index(i, total_bonds, bonds);
         Set_End_Index(i, total_bonds, bonds);
         total_bonds += system->my_atoms[i].num_bonds;
       }
-
-      /* is reallocation needed? */
-      if (total_bonds >= bonds->num_intrs * DANGER_ZONE) {
-        workspace->realloc.bonds = 1;
-        if (total_bonds >= bonds->num_intrs)
-          control->error_ptr->one(FLERR,fmt::format("Not enough space for bonds! "
-                                                    "total={} allocated={}\n",
-                                                    total_bonds, bonds->num_intrs));
-      }
     }
 
     if (control->hbond_cut > 0 && system->numH > 0) {
       hbonds = (*lists) + HBONDS;
       total_hbonds = 0;
+      for (i = 0; i < system->n; ++i)
+        if (system->my_atoms[i].Hindex > -1)
+          total_hbonds += system->my_atoms[i].num_hbonds;
 
-      /* reset start-end indexes */
+      if (total_hbonds > hbonds->num_intrs)
+        Reallocate_HBonds_List(system, hbonds);
+
+      total_hbonds = 0;
       for (i = 0; i < system->n; ++i) {
         Hindex = system->my_atoms[i].Hindex;
         if (Hindex > -1) {
@@ -104,25 +113,14 @@ namespace ReaxFF {
           total_hbonds += system->my_atoms[i].num_hbonds;
         }
       }
-
-      /* is reallocation needed? */
-      if (total_hbonds >= hbonds->num_intrs * 0.90/*DANGER_ZONE*/) {
-        workspace->realloc.hbonds = 1;
-        if (total_hbonds >= hbonds->num_intrs)
-          control->error_ptr->one(FLERR,fmt::format("Not enough space for hbonds! "
-                                                    "total={} allocated={}\n",
-                                                    total_hbonds, hbonds->num_intrs));
-      }
     }
   }
 
-
   void Reset(reax_system *system, control_params *control,
-             simulation_data *data, storage *workspace, reax_list **lists)
+             simulation_data *data, storage *workspace, reax_list ** /*lists*/)
   {
     Reset_Atoms(system, control);
     Reset_Simulation_Data(data);
     Reset_Workspace(system, workspace);
-    Reset_Neighbor_Lists(system, control, workspace, lists);
   }
 }
@@ -118,6 +118,15 @@ namespace ReaxFF {
       start_j = Start_Index(j, bonds);
       end_j = End_Index(j, bonds);
 
+      /* make room for all angles centered on j */
+      LAMMPS_NS::bigint needed = (LAMMPS_NS::bigint) num_thb_intrs + SQR(end_j - start_j);
+      if (needed > thb_intrs->num_intrs) {
+        needed = MAX((LAMMPS_NS::bigint) (needed * system->safezone), needed);
+        if (needed > MAXSMALLINT)
+          control->error_ptr->one(FLERR, "Too many angles in pair reaxff");
+        Grow_List((int) needed, thb_intrs);
+      }
+
       p_val3 = system->reax_param.sbp[type_j].p_val3;
       p_val5 = system->reax_param.sbp[type_j].p_val5;
 
@@ -374,14 +383,5 @@ namespace ReaxFF {
         Set_End_Index(pi, num_thb_intrs, thb_intrs);
       }
     }
-
-    if (num_thb_intrs >= thb_intrs->num_intrs * DANGER_ZONE) {
-      workspace->realloc.num_3body = num_thb_intrs;
-      if (num_thb_intrs > thb_intrs->num_intrs)
-        control->error_ptr->one(FLERR, fmt::format("step {}: ran out of space on "
-                                                   "angle_list: top={}, max={}",
-                                                   data->step, num_thb_intrs,
-                                                   thb_intrs->num_intrs));
-    }
   }
 }
@@ -17,25 +17,129 @@
 ------------------------------------------------------------------------- */
 
 #include "fix_event_prd.h"
+
+#include "atom.h"
 #include "comm.h"
+#include "domain.h"
 #include "error.h"
+#include "memory.h"
 #include "update.h"
 
+#include <cmath>
+
 using namespace LAMMPS_NS;
 using namespace FixConst;
 
 /* ---------------------------------------------------------------------- */
 
 FixEventPRD::FixEventPRD(LAMMPS *lmp, int narg, char **arg) :
-  FixEvent(lmp, narg, arg)
+  FixEvent(lmp, narg, arg), xscreen(nullptr)
 {
   if (narg != 3) error->all(FLERR,"Illegal fix event command");
 
   restart_global = 1;
 
+  // 17 values per atom from the base class plus xscreen
+
+  maxexchange = 20;
+
   event_number = 0;
   event_timestep = update->ntimestep;
   clock = 0;
+
+  // base class constructor only allocated its own arrays
+
+  screen_window = screen_count = 0;
+  memory->grow(xscreen,atom->nmax,3,"event/prd:xscreen");
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixEventPRD::~FixEventPRD()
+{
+  memory->destroy(xscreen);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixEventPRD::setmask()
+{
+  int mask = 0;
+  mask |= END_OF_STEP;
+  return mask;
+}
+
+/* ----------------------------------------------------------------------
+   update running average of unwrapped atom coords
+   plain average over the steps since reset until screen_window steps,
+     then exponential average with a time constant of screen_window steps
+------------------------------------------------------------------------- */
+
+void FixEventPRD::end_of_step()
+{
+  if (screen_window == 0) return;
+
+  screen_count++;
+  double screen_weight = 1.0/MIN(screen_count,screen_window);
+
+  double **x = atom->x;
+  imageint *image = atom->image;
+  int nlocal = atom->nlocal;
+  double unwrap[3];
+
+  for (int i = 0; i < nlocal; i++) {
+    domain->unmap(x[i],image[i],unwrap);
+    xscreen[i][0] += screen_weight * (unwrap[0] - xscreen[i][0]);
+    xscreen[i][1] += screen_weight * (unwrap[1] - xscreen[i][1]);
+    xscreen[i][2] += screen_weight * (unwrap[2] - xscreen[i][2]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   restart running average, called by PRD whenever atom coords were replaced
+   window = # of steps the average extends over, 0 = no averaging
+   start from atom coords at last event, replaced by first step of average
+------------------------------------------------------------------------- */
+
+void FixEventPRD::reset_screen(int window)
+{
+  screen_window = window;
+  screen_count = 0;
+
+  double **xevent = array_atom;
+  int nlocal = atom->nlocal;
+
+  for (int i = 0; i < nlocal; i++) {
+    xscreen[i][0] = xevent[i][0];
+    xscreen[i][1] = xevent[i][1];
+    xscreen[i][2] = xevent[i][2];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   return largest distance of any averaged atom from its coords at last event
+   thermal vibrations average out, so a value comparable to the
+     event displacement indicates the replica may have left its basin
+------------------------------------------------------------------------- */
+
+double FixEventPRD::screen_signature()
+{
+  double **xevent = array_atom;
+  int nlocal = atom->nlocal;
+  double dx,dy,dz,rsq;
+
+  double rsqmax = 0.0;
+  for (int i = 0; i < nlocal; i++) {
+    dx = xscreen[i][0] - xevent[i][0];
+    dy = xscreen[i][1] - xevent[i][1];
+    dz = xscreen[i][2] - xevent[i][2];
+    rsq = dx*dx + dy*dy + dz*dz;
+    if (rsq > rsqmax) rsqmax = rsq;
+  }
+
+  double rsqmaxall;
+  MPI_Allreduce(&rsqmax,&rsqmaxall,1,MPI_DOUBLE,MPI_MAX,world);
+  return sqrt(rsqmaxall);
 }
 
 /* ----------------------------------------------------------------------
@@ -91,3 +195,62 @@ void FixEventPRD::restart(char *buf)
   correlated_event = static_cast<int> (list[n++]);
   ncoincident = static_cast<int> (list[n++]);
 }
+
+/* ----------------------------------------------------------------------
+   memory usage of local atom-based arrays
+------------------------------------------------------------------------- */
+
+double FixEventPRD::memory_usage()
+{
+  double bytes = FixEvent::memory_usage();
+  bytes += 3*atom->nmax * sizeof(double);
+  return bytes;
+}
+
+/* ----------------------------------------------------------------------
+   allocate atom-based arrays
+------------------------------------------------------------------------- */
+
+void FixEventPRD::grow_arrays(int nmax)
+{
+  FixEvent::grow_arrays(nmax);
+  memory->grow(xscreen,nmax,3,"event/prd:xscreen");
+}
+
+/* ----------------------------------------------------------------------
+   copy values within local atom-based arrays
+------------------------------------------------------------------------- */
+
+void FixEventPRD::copy_arrays(int i, int j, int delflag)
+{
+  FixEvent::copy_arrays(i,j,delflag);
+  xscreen[j][0] = xscreen[i][0];
+  xscreen[j][1] = xscreen[i][1];
+  xscreen[j][2] = xscreen[i][2];
+}
+
+/* ----------------------------------------------------------------------
+   pack values in local atom-based arrays for exchange with another proc
+------------------------------------------------------------------------- */
+
+int FixEventPRD::pack_exchange(int i, double *buf)
+{
+  int m = FixEvent::pack_exchange(i,buf);
+  buf[m++] = xscreen[i][0];
+  buf[m++] = xscreen[i][1];
+  buf[m++] = xscreen[i][2];
+  return m;
+}
+
+/* ----------------------------------------------------------------------
+   unpack values in local atom-based arrays from exchange with another proc
+------------------------------------------------------------------------- */
+
+int FixEventPRD::unpack_exchange(int nlocal, double *buf)
+{
+  int m = FixEvent::unpack_exchange(nlocal,buf);
+  xscreen[nlocal][0] = buf[m++];
+  xscreen[nlocal][1] = buf[m++];
+  xscreen[nlocal][2] = buf[m++];
+  return m;
+}
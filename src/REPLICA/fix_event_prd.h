@@ -34,15 +34,28 @@ class FixEventPRD : public FixEvent {
   int ncoincident;          // # of simultaneous events on different replicas
 
   FixEventPRD(class LAMMPS *, int, char **);
+  ~FixEventPRD() override;
+  int setmask() override;
+  void end_of_step() override;
 
+  double memory_usage() override;
+  void grow_arrays(int) override;
+  void copy_arrays(int, int, int) override;
+  int pack_exchange(int, double *) override;
+  int unpack_exchange(int, double *) override;
   void write_restart(FILE *) override;
   void restart(char *) override;
 
   // methods specific to FixEventPRD, invoked by PRD
 
   void store_event_prd(bigint, int);
+  void reset_screen(int);       // restart running average of atom coords
+  double screen_signature();    // max distance of averaged atom from event
 
  private:
+  double **xscreen;     // running average of unwrapped atom coords
+  int screen_window;    // # of steps in running average, 0 = off
+  int screen_count;     // # of steps since average was reset
 };
 
 }    // namespace LAMMPS_NS
@@ -40,6 +40,7 @@ static constexpr int DELTABIAS = 16;
 static constexpr double COEFFINIT = 1.0;
 static constexpr int FCCBONDS = 12;
 static constexpr double BIG = 1.0e20;
+static constexpr double SMALL = 1.0e-8;
 
 enum{STRAIN,STRAINDOMAIN,BIASFLAG,BIASCOEFF};
 enum{IGNORE,WARN,ERROR};
@@ -50,7 +51,8 @@ FixHyperLocal::FixHyperLocal(LAMMPS *lmp, int narg, char **arg) :
   FixHyper(lmp, narg, arg), blist(nullptr), biascoeff(nullptr), numbond(nullptr),
   maxhalf(nullptr), eligible(nullptr), maxhalfstrain(nullptr), old2now(nullptr),
   tagold(nullptr), xold(nullptr), maxstrain(nullptr), maxstrain_domain(nullptr),
-  biasflag(nullptr), bias(nullptr), cpage(nullptr), clist(nullptr), numcoeff(nullptr)
+  biasflag(nullptr), bias(nullptr), cpage(nullptr), clist(nullptr), numcoeff(nullptr),
+  now2old(nullptr)
 {
   // error checks
 
@@ -164,6 +166,7 @@ FixHyperLocal::FixHyperLocal(LAMMPS *lmp, int narg, char **arg) :
   maxcoeff = 0;
   maxbondperatom = FCCBONDS;
   numcoeff = nullptr;
+  now2old = nullptr;
   clist = nullptr;
   cpage = new MyPage<HyperOneCoeff>;
   cpage->init(maxbondperatom,1024*maxbondperatom,1);
@@ -226,6 +229,7 @@ FixHyperLocal::~FixHyperLocal()
   memory->destroy(bias);
 
   memory->destroy(numcoeff);
+  memory->destroy(now2old);
   memory->sfree(clist);
   delete cpage;
 }
@@ -431,10 +435,9 @@ void FixHyperLocal::pre_neighbor()
 
 void FixHyperLocal::pre_reverse(int /* eflag */, int /* vflag */)
 {
-  int i,j,m,ii,jj,inum,jnum,iold,jold,ibond,nbond,ijhalf,ncount;
+  int i,j,m,ii,jj,inum,jnum,iold,jold;
   double delx,dely,delz;
-  double r,r0,estrain,emax,ebias,vbias,fbias,fbiasr;
-  double halfstrain,selfstrain;
+  double r,r0,ebias,vbias,fbias,fbiasr;
   int *ilist,*jlist,*numneigh,**firstneigh;
 
   //double time1,time2,time3,time4,time5,time6,time7,time8;
@@ -467,49 +470,9 @@ void FixHyperLocal::pre_reverse(int /* eflag */, int /* vflag */)
   // reverse/forward comm so know it for all current owned and ghost atoms
   // -------------------------------------------------------------
 
-  // compute estrain = current abs value strain of each owned bond
-  // blist = bondlist from last event
-  // also store:
-  //   maxhalf = which owned bond is maxstrain for each old atom I
-  //   maxhalfstrain = abs value strain of that bond for each old atom I
-
   for (i = 0; i < nall; i++) maxstrain[i] = 0.0;
 
-  double **x = atom->x;
-
-  // DEBUG quantity
-  // overcount = 0;
-
-  m = 0;
-  for (iold = 0; iold < nlocal_old; iold++) {
-    halfstrain = 0.0;
-    ijhalf = -1;
-    nbond = numbond[iold];
-
-    for (ibond = 0; ibond < nbond; ibond++) {
-      i = blist[m].i;
-      j = blist[m].j;
-      delx = x[i][0] - x[j][0];
-      dely = x[i][1] - x[j][1];
-      delz = x[i][2] - x[j][2];
-      r = sqrt(delx*delx + dely*dely + delz*delz);
-      maxbondlen = MAX(r,maxbondlen);
-      r0 = blist[m].r0;
-      estrain = fabs(r-r0) / r0;
-      // DEBUG quantity
-      // if (estrain >= qfactor) overcount++;
-      maxstrain[i] = MAX(maxstrain[i],estrain);
-      maxstrain[j] = MAX(maxstrain[j],estrain);
-      if (estrain > halfstrain) {
-        halfstrain = estrain;
-        ijhalf = m;
-      }
-      m++;
-    }
-
-    maxhalf[iold] = ijhalf;
-    maxhalfstrain[iold] = halfstrain;
-  }
+  bond_strain();
 
   //time2 = platform::walltime();
 
@@ -530,102 +493,12 @@ void FixHyperLocal::pre_reverse(int /* eflag */, int /* vflag */)
   // reverse/forward comm so know it for all current owned and ghost atoms
   // -------------------------------------------------------------
 
-  // use full Dcut neighbor list to check maxstrain of all neighbor atoms
-  // neighlist is from last event
-  //   has old indices for I,J (reneighboring may have occurred)
-  //   use old2now[] to convert to current indices
-  //   if J is unknown (drifted ghost),
-  //     assume it was part of an event and its strain = qfactor
-  // mark atom I ineligible for biasing if:
-  //   its maxstrain = 0.0, b/c it is in no bonds (typically not in LHD group)
-  //   its maxhalfstrain < maxstrain (J atom owns the IJ bond)
-  //   its maxstrain < maxstrain_domain
-  //   ncount > 1 (break tie by making all atoms with tie value ineligible)
-  // if ncount > 1, also flip sign of maxstrain_domain for atom I
-
   for (i = 0; i < nall; i++) maxstrain_domain[i] = 0.0;
 
-  inum = listfull->inum;
-  ilist = listfull->ilist;
-  numneigh = listfull->numneigh;
-  firstneigh = listfull->firstneigh;
-
   double rmax = rmaxever;
   double rmaxbig = rmaxeverbig;
-  double *sublo = domain->sublo;
-  double *subhi = domain->subhi;
-
-  // first two lines of outer loop should be identical to this:
-  // for (iold = 0; iold < nlocal_old; iold++)
 
-  for (ii = 0; ii < inum; ii++) {
-    iold = ilist[ii];
-    i = old2now[iold];
-
-    if (maxstrain[i] == 0.0) {
-      eligible[iold] = 0;
-      continue;
-    }
-
-    jlist = firstneigh[iold];
-    jnum = numneigh[iold];
-
-    // I or J may be ghost atoms
-    // will always know I b/c atoms do not drift that far
-    // but may no longer know J if hops outside cutghost
-    // in that case, assume it performed an event, its strain = qfactor
-    // this assumes cutghost is sufficiently longer than Dcut
-
-    emax = selfstrain = maxstrain[i];
-    ncount = 0;
-
-    for (jj = 0; jj < jnum; jj++) {
-      jold = jlist[jj];
-      j = old2now[jold];
-
-      // special case for missing (drifted) J atom
-
-      if (j < 0) {
-        emax = MAX(emax,qfactor);
-        if (selfstrain == qfactor) ncount++;
-        continue;
-      }
-
-      emax = MAX(emax,maxstrain[j]);
-      if (selfstrain == maxstrain[j]) ncount++;
-
-      // optional diagnostic
-      // tally largest distance from subbox that a ghost atom is (rmaxbig)
-      // and the largest distance if strain < qfactor (rmax)
-
-      if (checkghost) {
-        if (j >= nlocal) {
-          if (x[j][0] < sublo[0]) rmaxbig = MAX(rmaxbig,sublo[0]-x[j][0]);
-          if (x[j][1] < sublo[1]) rmaxbig = MAX(rmaxbig,sublo[1]-x[j][1]);
-          if (x[j][2] < sublo[2]) rmaxbig = MAX(rmaxbig,sublo[2]-x[j][2]);
-          if (x[j][0] > subhi[0]) rmaxbig = MAX(rmaxbig,x[j][0]-subhi[0]);
-          if (x[j][1] > subhi[1]) rmaxbig = MAX(rmaxbig,x[j][1]-subhi[1]);
-          if (x[j][2] > subhi[2]) rmaxbig = MAX(rmaxbig,x[j][2]-subhi[2]);
-          if (maxstrain[j] < qfactor) {
-            if (x[j][0] < sublo[0]) rmax = MAX(rmax,sublo[0]-x[j][0]);
-            if (x[j][1] < sublo[1]) rmax = MAX(rmax,sublo[1]-x[j][1]);
-            if (x[j][2] < sublo[2]) rmax = MAX(rmax,sublo[2]-x[j][2]);
-            if (x[j][0] > subhi[0]) rmax = MAX(rmax,x[j][0]-subhi[0]);
-            if (x[j][1] > subhi[1]) rmax = MAX(rmax,x[j][1]-subhi[1]);
-            if (x[j][2] > subhi[2]) rmax = MAX(rmax,x[j][2]-subhi[2]);
-          }
-        }
-      }
-    }
-
-    if (maxhalfstrain[iold] < selfstrain) eligible[iold] = 0;
-    if (selfstrain < emax) eligible[iold] = 0;
-    else if (ncount > 1) {
-      eligible[iold] = 0;
-      emax = -emax;
-    }
-    maxstrain_domain[i] = emax;
-  }
+  domain_strain(rmax,rmaxbig);
 
   //time4 = platform::walltime();
 
@@ -670,6 +543,7 @@ void FixHyperLocal::pre_reverse(int /* eflag */, int /* vflag */)
   // apply bias force to bonds with locally max strain
   // -------------------------------------------------------------
 
+  double **x = atom->x;
   double **f = atom->f;
 
   int nobias = 0;
@@ -732,48 +606,10 @@ void FixHyperLocal::pre_reverse(int /* eflag */, int /* vflag */)
   nobias_running += nobias;
   negstrain_running += negstrain;
 
-  // loop over bonds I own to adjust bias coeff
-  // delta in boost coeff is function of boost_domain vs target boost
-  // boost_domain is function of two maxstrain_domains for I,J
-  // NOTE: biascoeff update is now scaled by 1/Vmax
-  //       still need to think about what this means for units
-
-  minbiascoeff = BIG;
-  maxbiascoeff = 0.0;
-
-  double emaxi,emaxj,boost_domain,bc;
   double sumcoeff_me = 0.0;
   double sumboost_me = 0.0;
 
-  for (m = 0; m < nblocal; m++) {
-    i = blist[m].i;
-    j = blist[m].j;
-    emaxi = maxstrain_domain[i];
-    emaxj = maxstrain_domain[j];
-    emax = MAX(emaxi,emaxj);
-    if (emax < qfactor) vbias = vmax * (1.0 - emax*emax*invqfactorsq);
-    else vbias = 0.0;
-
-    boost_domain = exp(beta * biascoeff[m]*vbias);
-    biascoeff[m] -= alpha*invvmax * (boost_domain-boost_target) / boost_target;
-
-    // enforce biascoeff bounds
-    // min value must always be >= 0.0
-
-    biascoeff[m] = MAX(biascoeff[m],0.0);
-    if (boundflag) {
-      biascoeff[m] = MAX(biascoeff[m],bound_lower);
-      biascoeff[m] = MIN(biascoeff[m],bound_upper);
-    }
-
-    // stats
-
-    bc = biascoeff[m];
-    sumcoeff_me += bc;
-    minbiascoeff = MIN(minbiascoeff,bc);
-    maxbiascoeff = MAX(maxbiascoeff,bc);
-    sumboost_me += boost_domain;
-  }
+  boostostat(sumcoeff_me,sumboost_me);
 
   // -------------------------------------------------------------
   // diagnostics, some optional
@@ -831,6 +667,11 @@ void FixHyperLocal::pre_reverse(int /* eflag */, int /* vflag */)
     // if J is unknown (drifted ghost) just ignore
     // if J is biased and is not bonded to I, then flag as too close
 
+    inum = listfull->inum;
+    ilist = listfull->ilist;
+    numneigh = listfull->numneigh;
+    firstneigh = listfull->firstneigh;
+
     for (ii = 0; ii < inum; ii++) {
       iold = ilist[ii];
       i = old2now[iold];
@@ -861,6 +702,215 @@ void FixHyperLocal::pre_reverse(int /* eflag */, int /* vflag */)
   }
 }
 
+/* ----------------------------------------------------------------------
+   stage 1 of pre_reverse()
+   compute estrain = current abs value strain of each owned bond
+   blist = bondlist from last event
+   also store:
+     maxhalf = which owned bond is maxstrain for each old atom I
+     maxhalfstrain = abs value strain of that bond for each old atom I
+   maxstrain is only accumulated for the bond atoms this proc sees,
+     caller completes it via reverse/forward comm
+------------------------------------------------------------------------- */
+
+void FixHyperLocal::bond_strain()
+{
+  int i,j,m,iold,ibond,nbond,ijhalf;
+  double delx,dely,delz,r,r0,estrain,halfstrain;
+
+  double **x = atom->x;
+
+  // DEBUG quantity
+  // overcount = 0;
+
+  m = 0;
+  for (iold = 0; iold < nlocal_old; iold++) {
+    halfstrain = 0.0;
+    ijhalf = -1;
+    nbond = numbond[iold];
+
+    for (ibond = 0; ibond < nbond; ibond++) {
+      i = blist[m].i;
+      j = blist[m].j;
+      delx = x[i][0] - x[j][0];
+      dely = x[i][1] - x[j][1];
+      delz = x[i][2] - x[j][2];
+      r = sqrt(delx*delx + dely*dely + delz*delz);
+      maxbondlen = MAX(r,maxbondlen);
+      r0 = blist[m].r0;
+      estrain = fabs(r-r0) / r0;
+      // DEBUG quantity
+      // if (estrain >= qfactor) overcount++;
+      maxstrain[i] = MAX(maxstrain[i],estrain);
+      maxstrain[j] = MAX(maxstrain[j],estrain);
+      if (estrain > halfstrain) {
+        halfstrain = estrain;
+        ijhalf = m;
+      }
+      m++;
+    }
+
+    maxhalf[iold] = ijhalf;
+    maxhalfstrain[iold] = halfstrain;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   stage 2 of pre_reverse()
+   use full Dcut neighbor list to check maxstrain of all neighbor atoms
+   neighlist is from last event
+     has old indices for I,J (reneighboring may have occurred)
+     use old2now[] to convert to current indices
+     if J is unknown (drifted ghost),
+       assume it was part of an event and its strain = qfactor
+   mark atom I ineligible for biasing if:
+     its maxstrain = 0.0, b/c it is in no bonds (typically not in LHD group)
+     its maxhalfstrain < maxstrain (J atom owns the IJ bond)
+     its maxstrain < maxstrain_domain
+     ncount > 1 (break tie by making all atoms with tie value ineligible)
+   if ncount > 1, also flip sign of maxstrain_domain for atom I
+   rmax,rmaxbig = running ghost distances tallied if checkghost is set
+------------------------------------------------------------------------- */
+
+void FixHyperLocal::domain_strain(double &rmax, double &rmaxbig)
+{
+  int i,j,ii,jj,inum,jnum,iold,jold,ncount;
+  double emax,selfstrain;
+  int *ilist,*jlist,*numneigh,**firstneigh;
+
+  double **x = atom->x;
+  int nlocal = atom->nlocal;
+
+  inum = listfull->inum;
+  ilist = listfull->ilist;
+  numneigh = listfull->numneigh;
+  firstneigh = listfull->firstneigh;
+
+  double *sublo = domain->sublo;
+  double *subhi = domain->subhi;
+
+  // first two lines of outer loop should be identical to this:
+  // for (iold = 0; iold < nlocal_old; iold++)
+
+  for (ii = 0; ii < inum; ii++) {
+    iold = ilist[ii];
+    i = old2now[iold];
+
+    if (maxstrain[i] == 0.0) {
+      eligible[iold] = 0;
+      continue;
+    }
+
+    jlist = firstneigh[iold];
+    jnum = numneigh[iold];
+
+    // I or J may be ghost atoms
+    // will always know I b/c atoms do not drift that far
+    // but may no longer know J if hops outside cutghost
+    // in that case, assume it performed an event, its strain = qfactor
+    // this assumes cutghost is sufficiently longer than Dcut
+
+    emax = selfstrain = maxstrain[i];
+    ncount = 0;
+
+    for (jj = 0; jj < jnum; jj++) {
+      jold = jlist[jj];
+      j = old2now[jold];
+
+      // special case for missing (drifted) J atom
+
+      if (j < 0) {
+        emax = MAX(emax,qfactor);
+        if (selfstrain == qfactor) ncount++;
+        continue;
+      }
+
+      emax = MAX(emax,maxstrain[j]);
+      if (selfstrain == maxstrain[j]) ncount++;
+
+      // optional diagnostic
+      // tally largest distance from subbox that a ghost atom is (rmaxbig)
+      // and the largest distance if strain < qfactor (rmax)
+
+      if (checkghost) {
+        if (j >= nlocal) {
+          if (x[j][0] < sublo[0]) rmaxbig = MAX(rmaxbig,sublo[0]-x[j][0]);
+          if (x[j][1] < sublo[1]) rmaxbig = MAX(rmaxbig,sublo[1]-x[j][1]);
+          if (x[j][2] < sublo[2]) rmaxbig = MAX(rmaxbig,sublo[2]-x[j][2]);
+          if (x[j][0] > subhi[0]) rmaxbig = MAX(rmaxbig,x[j][0]-subhi[0]);
+          if (x[j][1] > subhi[1]) rmaxbig = MAX(rmaxbig,x[j][1]-subhi[1]);
+          if (x[j][2] > subhi[2]) rmaxbig = MAX(rmaxbig,x[j][2]-subhi[2]);
+          if (maxstrain[j] < qfactor) {
+            if (x[j][0] < sublo[0]) rmax = MAX(rmax,sublo[0]-x[j][0]);
+            if (x[j][1] < sublo[1]) rmax = MAX(rmax,sublo[1]-x[j][1]);
+            if (x[j][2] < sublo[2]) rmax = MAX(rmax,sublo[2]-x[j][2]);
+            if (x[j][0] > subhi[0]) rmax = MAX(rmax,x[j][0]-subhi[0]);
+            if (x[j][1] > subhi[1]) rmax = MAX(rmax,x[j][1]-subhi[1]);
+            if (x[j][2] > subhi[2]) rmax = MAX(rmax,x[j][2]-subhi[2]);
+          }
+        }
+      }
+    }
+
+    if (maxhalfstrain[iold] < selfstrain) eligible[iold] = 0;
+    if (selfstrain < emax) eligible[iold] = 0;
+    else if (ncount > 1) {
+      eligible[iold] = 0;
+      emax = -emax;
+    }
+    maxstrain_domain[i] = emax;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   stage 5 of pre_reverse()
+   loop over bonds I own to adjust bias coeff
+   delta in boost coeff is function of boost_domain vs target boost
+   boost_domain is function of two maxstrain_domains for I,J
+   NOTE: biascoeff update is now scaled by 1/Vmax
+         still need to think about what this means for units
+   return sum of bias coeffs and boosts of my bonds
+------------------------------------------------------------------------- */
+
+void FixHyperLocal::boostostat(double &sumcoeff_me, double &sumboost_me)
+{
+  int i,j,m;
+  double emaxi,emaxj,emax,vbias,boost_domain,bc;
+
+  minbiascoeff = BIG;
+  maxbiascoeff = 0.0;
+
+  for (m = 0; m < nblocal; m++) {
+    i = blist[m].i;
+    j = blist[m].j;
+    emaxi = maxstrain_domain[i];
+    emaxj = maxstrain_domain[j];
+    emax = MAX(emaxi,emaxj);
+    if (emax < qfactor) vbias = vmax * (1.0 - emax*emax*invqfactorsq);
+    else vbias = 0.0;
+
+    boost_domain = exp(beta * biascoeff[m]*vbias);
+    biascoeff[m] -= alpha*invvmax * (boost_domain-boost_target) / boost_target;
+
+    // enforce biascoeff bounds
+    // min value must always be >= 0.0
+
+    biascoeff[m] = MAX(biascoeff[m],0.0);
+    if (boundflag) {
+      biascoeff[m] = MAX(biascoeff[m],bound_lower);
+      biascoeff[m] = MIN(biascoeff[m],bound_upper);
+    }
+
+    // stats
+
+    bc = biascoeff[m];
+    sumcoeff_me += bc;
+    minbiascoeff = MIN(minbiascoeff,bc);
+    maxbiascoeff = MAX(maxbiascoeff,bc);
+    sumboost_me += boost_domain;
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixHyperLocal::min_pre_neighbor()
@@ -952,25 +1002,44 @@ void FixHyperLocal::build_bond_list(int natom)
     }
   }
 
-  // store old bond coeffs so can persist them in new blist
-  // while loop allows growing value of maxbondperatom
-  // will loop at most 2 times, stops when maxbondperatom is large enough
-  // requires reverse comm, no forward comm:
-  //    b/c new coeff list is stored only by current owned atoms
+  // trigger neighbor list builds for both lists
+  // ensure the I loops in both are from 1 to nlocal
+  // done before old bond coeffs are stored,
+  //   so new bonds can be checked against them
 
   tagint *tag = atom->tag;
   int nlocal = atom->nlocal;
   int nall = nlocal + atom->nghost;
 
+  neighbor->build_one(listfull);
+  neighbor->build_one(listhalf);
+
+  if (listfull->inum != nlocal || listhalf->inum != nlocal)
+    error->one(FLERR,"Invalid neighbor list in fix hyper/local bond build");
+
+  // store old bond coeffs so can persist them in new blist
+  // while loop allows growing value of maxbondperatom
+  // will loop at most 2 times, stops when maxbondperatom is large enough
+  // reverse comm, no forward comm, is only needed if some new bond
+  //   may have been owned by another proc when old bonds were formed:
+  //    b/c new coeff list is stored only by current owned atoms
+  // if every new bond is either found in my old bonds or is provably new,
+  //   coeffs persist without any ghost comm, which is the common case
+  //   since an event only changes bonds near the atoms that moved
+
   if (maxcoeff < nall) {
     memory->destroy(numcoeff);
+    memory->destroy(now2old);
     memory->sfree(clist);
     maxcoeff = atom->nmax;
     memory->create(numcoeff,maxcoeff,"hyper/local:numcoeff");
+    memory->create(now2old,maxcoeff,"hyper/local:now2old");
     clist = (HyperOneCoeff **) memory->smalloc(maxcoeff*sizeof(HyperOneCoeff *),
                                          "hyper/local:clist");
   }
 
+  int needcomm = -1;
+
   while (true) {
     if (firstflag) break;
     for (i = 0; i < nall; i++) numcoeff[i] = 0;
@@ -1008,6 +1077,12 @@ void FixHyperLocal::build_bond_list(int natom)
       continue;
     }
 
+    if (needcomm < 0) {
+      int unresolved = unresolved_coeffs();
+      MPI_Allreduce(&unresolved,&needcomm,1,MPI_INT,MPI_MAX,world);
+    }
+    if (needcomm == 0) break;
+
     commflag = BIASCOEFF;
     comm->reverse_comm_variable(this);
 
@@ -1057,15 +1132,6 @@ void FixHyperLocal::build_bond_list(int natom)
   for (i = 0; i < nall; i++) tagold[i] = 0;
   for (i = 0; i < nlocal; i++) numbond[i] = 0;
 
-  // trigger neighbor list builds for both lists
-  // ensure the I loops in both are from 1 to nlocal
-
-  neighbor->build_one(listfull);
-  neighbor->build_one(listhalf);
-
-  if (listfull->inum != nlocal || listhalf->inum != nlocal)
-    error->one(FLERR,"Invalid neighbor list in fix hyper/local bond build");
-
   // set tagold = 1 for all J atoms used in full neighbor list
   // tagold remains 0 for unused atoms, skipped in pre_neighbor
 
@@ -1186,6 +1252,93 @@ void FixHyperLocal::build_bond_list(int natom)
   firstflag = 0;
 }
 
+/* ----------------------------------------------------------------------
+   count bonds in new half neighbor list whose old bias coeff is unknown
+   same bond criteria as in build_bond_list()
+   a new bond needs no comm if its coeff is in clist of owned atom I,
+     or if it is provably new, i.e. its 2 atoms were further apart than
+     cutbond in the old quenched state, so no proc can have owned it
+   all other bonds need reverse comm of old coeffs stored by ghost atoms
+------------------------------------------------------------------------- */
+
+int FixHyperLocal::unresolved_coeffs()
+{
+  int i,j,m,n,ii,jj,inum,jnum,iold,jold,found;
+  tagint jtag;
+  double delx,dely,delz,rsq;
+  int *ilist,*jlist,*numneigh,**firstneigh;
+
+  double **x = atom->x;
+  tagint *tag = atom->tag;
+  int *mask = atom->mask;
+  int nall = atom->nlocal + atom->nghost;
+
+  // now2old = old index of one old copy of each current atom ID
+  // only set for the copy of each ID that atom->map() returns
+
+  for (i = 0; i < nall; i++) now2old[i] = -1;
+  for (iold = 0; iold < nall_old; iold++) {
+    if (tagold[iold] == 0) continue;
+    i = atom->map(tagold[iold]);
+    if (i >= 0 && now2old[i] < 0) now2old[i] = iold;
+  }
+
+  inum = listhalf->inum;
+  ilist = listhalf->ilist;
+  numneigh = listhalf->numneigh;
+  firstneigh = listhalf->firstneigh;
+
+  int unresolved = 0;
+
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      j &= NEIGHMASK;
+
+      if (!(mask[i] & groupbit) && !(mask[j] & groupbit)) continue;
+
+      delx = x[i][0] - x[j][0];
+      dely = x[i][1] - x[j][1];
+      delz = x[i][2] - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq >= cutbondsq) continue;
+
+      jtag = tag[j];
+      found = 0;
+      n = MIN(numcoeff[i],maxbondperatom);
+      for (m = 0; m < n; m++) {
+        if (clist[i][m].tag == jtag) {
+          found = 1;
+          break;
+        }
+      }
+      if (found) continue;
+
+      // old separation of I,J via closest periodic images
+      // SMALL margin guards against round-off, so may only overcount
+
+      iold = now2old[atom->map(tag[i])];
+      jold = now2old[atom->map(jtag)];
+      if (iold < 0 || jold < 0) {
+        unresolved++;
+        continue;
+      }
+      delx = xold[iold][0] - xold[jold][0];
+      dely = xold[iold][1] - xold[jold][1];
+      delz = xold[iold][2] - xold[jold][2];
+      domain->minimum_image(delx,dely,delz);
+      rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq < cutbondsq*(1.0+SMALL)) unresolved++;
+    }
+  }
+
+  return unresolved;
+}
+
 /* ---------------------------------------------------------------------- */
 
 int FixHyperLocal::pack_forward_comm(int n, int *list, double *buf,
@@ -1731,7 +1884,7 @@ double FixHyperLocal::memory_usage()
   bytes += (double)3*maxall * sizeof(double);             // xold
   bytes += (double)2*maxall * sizeof(double);             // maxstrain,maxstrain_domain
   if (checkbias) bytes += (double)maxall * sizeof(tagint);  // biasflag
-  bytes += (double)maxcoeff * sizeof(int);                // numcoeff
+  bytes += (double)2*maxcoeff * sizeof(int);              // numcoeff,now2old
   bytes += (double)maxcoeff * sizeof(HyperOneCoeff *);         // clist
   bytes += (double)maxlocal*maxbondperatom * sizeof(HyperOneCoeff);  // cpage estimate
   return bytes;
@@ -55,7 +55,7 @@ class FixHyperLocal : public FixHyper {
   void init_hyper() override;
   void build_bond_list(int) override;
 
- private:
+ protected:
   int me;
 
   // inputs and derived quantities
@@ -188,16 +188,24 @@ class FixHyperLocal : public FixHyper {
   MyPage<HyperOneCoeff> *cpage;    // pages of OneCoeff datums for clist
   HyperOneCoeff **clist;           // ptrs to vectors of bias coeffs for each atom
   int *numcoeff;                   // # of bias coeffs per atom (one per bond)
-  int maxcoeff;                    // allocate sized of clist and numcoeff
+  int *now2old;                    // n2o[i] = old index of current atom I, -1 if none
+  int maxcoeff;                    // allocate sized of clist, numcoeff, now2old
 
   // extra timers
 
   //double timefirst,timesecond,timethird,timefourth;
   //double timefifth,timesixth,timeseventh,timetotal;
 
+  // per-timestep kernels of pre_reverse(), overridden by OPENMP version
+
+  virtual void bond_strain();
+  virtual void domain_strain(double &, double &);
+  virtual void boostostat(double &, double &);
+
   // private methods
 
   void grow_bond();
+  int unresolved_coeffs();
 };
 
 }    // namespace LAMMPS_NS
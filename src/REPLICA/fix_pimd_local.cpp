@@ -0,0 +1,826 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+   Path-integral MD with all beads of an atom stored on its owning proc
+   The ring polymer is propagated in normal-mode coordinates with a
+   BAOAB splitting and a PILE_L thermostat. Bead forces are computed
+   one bead after the other with the neighbor lists built for the
+   centroids, which remain valid as long as the bead displacements
+   stay within the neighbor skin.
+------------------------------------------------------------------------- */
+
+#include "fix_pimd_local.h"
+
+#include "angle.h"
+#include "atom.h"
+#include "bond.h"
+#include "comm.h"
+#include "dihedral.h"
+#include "domain.h"
+#include "error.h"
+#include "force.h"
+#include "group.h"
+#include "improper.h"
+#include "kspace.h"
+#include "math_const.h"
+#include "math_special.h"
+#include "memory.h"
+#include "modify.h"
+#include "neighbor.h"
+#include "pair.h"
+#include "random_mars.h"
+#include "update.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+using MathConst::MY_2PI;
+using MathConst::MY_PI;
+using MathConst::MY_SQRT2;
+using MathSpecial::powint;
+
+/* ---------------------------------------------------------------------- */
+
+FixPIMDLocal::FixPIMDLocal(LAMMPS *lmp, int narg, char **arg) :
+    Fix(lmp, narg, arg), M_x2xp(nullptr), omega_k(nullptr), lan_c(nullptr), lan_s(nullptr),
+    c1_k(nullptr), c2_k(nullptr), qnm(nullptr), vnm(nullptr), xdisp(nullptr), fnm(nullptr),
+    xhold(nullptr), xcentroid(nullptr), random(nullptr)
+{
+  if (narg < 6) utils::missing_cmd_args(FLERR, "fix pimd/local", error);
+
+  np = utils::inumeric(FLERR, arg[3], false, lmp);
+  if (np < 2) error->all(FLERR, "Fix pimd/local requires at least 2 beads");
+  temp = utils::numeric(FLERR, arg[4], false, lmp);
+  if (temp <= 0.0) error->all(FLERR, "Fix pimd/local temperature must be > 0.0");
+  seed = utils::inumeric(FLERR, arg[5], false, lmp);
+  if (seed <= 0) error->all(FLERR, "Fix pimd/local seed must be > 0");
+
+  tau = 1.0;
+  pilescale = 1.0;
+  sp = 1.0;
+
+  int iarg = 6;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg], "tau") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix pimd/local tau", error);
+      tau = utils::numeric(FLERR, arg[iarg + 1], false, lmp);
+      if (tau <= 0.0) error->all(FLERR, "Fix pimd/local tau must be > 0.0");
+      iarg += 2;
+    } else if (strcmp(arg[iarg], "scale") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix pimd/local scale", error);
+      pilescale = utils::numeric(FLERR, arg[iarg + 1], false, lmp);
+      if (pilescale <= 0.0) error->all(FLERR, "Fix pimd/local scale must be > 0.0");
+      iarg += 2;
+    } else if (strcmp(arg[iarg], "sp") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix pimd/local sp", error);
+      sp = utils::numeric(FLERR, arg[iarg + 1], false, lmp);
+      if (sp <= 0.0) error->all(FLERR, "Fix pimd/local sp must be > 0.0");
+      iarg += 2;
+    } else
+      error->all(FLERR, "Unknown fix pimd/local keyword: {}", arg[iarg]);
+  }
+
+  if (domain->dimension != 3) error->all(FLERR, "Fix pimd/local requires a 3d simulation");
+  if (strcmp(update->unit_style, "lj") == 0)
+    error->all(FLERR, "Fix pimd/local does not support lj units");
+
+  time_integrate = 1;
+  restart_peratom = 1;
+  vector_flag = 1;
+  size_vector = 6;
+  global_freq = 1;
+  extvector = 1;
+
+  // reneighbor explicitly when beads may leave the neighbor skin
+
+  force_reneighbor = 1;
+  next_reneighbor = -1;
+
+  nmode = np - 1;
+  maxexchange = 6 * nmode + 3 * np;
+
+  memory->create(M_x2xp, np, np, "pimd/local:M_x2xp");
+  memory->create(omega_k, np, "pimd/local:omega_k");
+  memory->create(lan_c, np, "pimd/local:lan_c");
+  memory->create(lan_s, np, "pimd/local:lan_s");
+  memory->create(c1_k, np, "pimd/local:c1_k");
+  memory->create(c2_k, np, "pimd/local:c2_k");
+
+  random = new RanMars(lmp, seed + comm->me);
+
+  // perform initial allocation of atom-based arrays
+  // register with Atom class
+
+  FixPIMDLocal::grow_arrays(atom->nmax);
+  atom->add_callback(Atom::GROW);
+  atom->add_callback(Atom::RESTART);
+
+  // normal modes are initialized in setup unless read from a restart file
+
+  int nlocal = atom->nlocal;
+  for (int i = 0; i < nlocal; i++) {
+    for (int m = 0; m < 3 * nmode; m++) qnm[i][m] = vnm[i][m] = 0.0;
+    for (int m = 0; m < 3 * np; m++) xdisp[i][m] = 0.0;
+  }
+
+  beads_ready = 0;
+  maxspread = 0.0;
+  pe_beads = pe_kspace = vir_beads = 0.0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixPIMDLocal::~FixPIMDLocal()
+{
+  // unregister callbacks to this fix from Atom class
+
+  if (modify->get_fix_by_id(id)) {
+    atom->delete_callback(id, Atom::GROW);
+    atom->delete_callback(id, Atom::RESTART);
+  }
+
+  delete random;
+
+  memory->destroy(M_x2xp);
+  memory->destroy(omega_k);
+  memory->destroy(lan_c);
+  memory->destroy(lan_s);
+  memory->destroy(c1_k);
+  memory->destroy(c2_k);
+
+  memory->destroy(qnm);
+  memory->destroy(vnm);
+  memory->destroy(xdisp);
+  memory->destroy(fnm);
+  memory->destroy(xhold);
+  memory->destroy(xcentroid);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixPIMDLocal::setmask()
+{
+  int mask = 0;
+  mask |= INITIAL_INTEGRATE;
+  mask |= POST_NEIGHBOR;
+  mask |= PRE_FORCE;
+  mask |= FINAL_INTEGRATE;
+  return mask;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixPIMDLocal::init()
+{
+  // threaded styles clear and reduce their per-thread forces
+  // only in the stages of the regular force computation
+
+  if (modify->get_fix_by_id("package_omp"))
+    error->all(FLERR, "Fix pimd/local cannot be used with the OPENMP package");
+
+  // fixes which modify forces are applied to every bead
+  // they must precede this fix so their setup() acts on the last bead
+  //   before setup() of this fix collects its forces
+
+  bool after = false;
+  for (const auto &ifix : modify->get_fix_list()) {
+    if (ifix == this) after = true;
+    else if (after && (ifix->setmask() & POST_FORCE))
+      error->all(FLERR, "Fix {} which modifies forces must be defined before fix pimd/local",
+                 ifix->style);
+  }
+
+  if (utils::strmatch(update->integrate_style, "^respa"))
+    error->all(FLERR, "Fix pimd/local cannot be used with run style respa");
+
+  hbar = force->hplanck * sp / MY_2PI;
+  kt = force->boltz * temp;
+  omega_np = np * kt / hbar;
+  skinhalf = 0.5 * neighbor->skin;
+
+  nm_init();
+}
+
+/* ----------------------------------------------------------------------
+   normal-mode transformation and per-mode propagator coefficients
+   row K of M_x2xp holds the orthonormal eigenvector of mode K
+------------------------------------------------------------------------- */
+
+void FixPIMDLocal::nm_init()
+{
+  const double sqrtnp = sqrt((double) np);
+
+  for (int j = 0; j < np; j++) {
+    for (int k = 1; k < np / 2 + 1; k++)
+      M_x2xp[k][j] = MY_SQRT2 * cos(MY_2PI * double(k) * double(j) / double(np)) / sqrtnp;
+    for (int k = np / 2 + 1; k < np; k++)
+      M_x2xp[k][j] = MY_SQRT2 * sin(MY_2PI * double(k) * double(j) / double(np)) / sqrtnp;
+    M_x2xp[0][j] = 1.0 / sqrtnp;
+    if (np % 2 == 0) M_x2xp[np / 2][j] = powint(-1.0, j) / sqrtnp;
+  }
+
+  dtv = update->dt;
+  dtf = 0.5 * update->dt * force->ftm2v;
+
+  // centroid is thermostatted with time constant tau
+  // other modes with PILE_L time constant 1/(2 scale omega_k)
+
+  omega_k[0] = 0.0;
+  lan_c[0] = 1.0;
+  lan_s[0] = 0.0;
+  c1_k[0] = exp(-dtv / tau);
+  c2_k[0] = sqrt(1.0 - c1_k[0] * c1_k[0]);
+
+  for (int k = 1; k < np; k++) {
+    double sink = sin(k * MY_PI / np);
+    omega_k[k] = omega_np * 2.0 * fabs(sink);
+    lan_c[k] = cos(0.5 * dtv * omega_k[k]);
+    lan_s[k] = sin(0.5 * dtv * omega_k[k]);
+    c1_k[k] = exp(-2.0 * pilescale * omega_k[k] * dtv);
+    c2_k[k] = sqrt(1.0 - c1_k[k] * c1_k[k]);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixPIMDLocal::setup_post_neighbor()
+{
+  post_neighbor();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixPIMDLocal::setup(int /*vflag*/)
+{
+  last_bead();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixPIMDLocal::setup_pre_force(int vflag)
+{
+  // beads restored from a restart file on any proc are kept on all procs
+
+  int flag = beads_ready, flagall;
+  MPI_Allreduce(&flag, &flagall, 1, MPI_INT, MPI_MAX, world);
+  if (!flagall) beads_init();
+  beads_ready = 1;
+
+  bead_positions();
+  if (maxspread > skinhalf)
+    error->all(FLERR, "Fix pimd/local bead spread {:.8} exceeds half the neighbor skin {:.8}",
+               maxspread, skinhalf);
+
+  // the integrator sets up kspace only after this call
+
+  if (force->kspace) force->kspace->setup();
+
+  pre_force(vflag);
+}
+
+/* ----------------------------------------------------------------------
+   start all ring polymers collapsed onto their centroids
+   with velocities of the non-centroid modes from the bead temperature
+------------------------------------------------------------------------- */
+
+void FixPIMDLocal::beads_init()
+{
+  double *rmass = atom->rmass;
+  double *mass = atom->mass;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  for (int i = 0; i < nlocal; i++) {
+    for (int m = 0; m < 3 * nmode; m++) qnm[i][m] = vnm[i][m] = 0.0;
+    if (!(mask[i] & groupbit)) continue;
+    double massone = rmass ? rmass[i] : mass[type[i]];
+    double vscale = sqrt(np * kt / (massone * force->mvv2e));
+    for (int m = 0; m < 3 * nmode; m++) vnm[i][m] = vscale * random->gaussian();
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixPIMDLocal::initial_integrate(int /*vflag*/)
+{
+  b_step();
+  a_step();
+  o_step();
+  a_step();
+
+  bead_positions();
+
+  // the centroid neighbor lists remain valid for all beads as long as
+  // centroid drift plus bead spread stays within half the skin
+
+  if (maxspread > skinhalf)
+    error->all(FLERR, "Fix pimd/local bead spread {:.8} exceeds half the neighbor skin {:.8}",
+               maxspread, skinhalf);
+
+  double **x = atom->x;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  int flag = 0;
+  for (int i = 0; i < nlocal && !flag; i++) {
+    if (!(mask[i] & groupbit)) continue;
+    double delx = x[i][0] - xhold[i][0];
+    double dely = x[i][1] - xhold[i][1];
+    double delz = x[i][2] - xhold[i][2];
+    double spread = 0.0;
+    for (int j = 0; j < np; j++) {
+      double *dx = &xdisp[i][3 * j];
+      spread = MAX(spread, dx[0] * dx[0] + dx[1] * dx[1] + dx[2] * dx[2]);
+    }
+    if (sqrt(delx * delx + dely * dely + delz * delz) + sqrt(spread) > skinhalf) flag = 1;
+  }
+
+  int flagall;
+  MPI_Allreduce(&flag, &flagall, 1, MPI_INT, MPI_MAX, world);
+  if (flagall) next_reneighbor = update->ntimestep;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixPIMDLocal::post_neighbor()
+{
+  double **x = atom->x;
+  int nlocal = atom->nlocal;
+
+  for (int i = 0; i < nlocal; i++) {
+    xhold[i][0] = x[i][0];
+    xhold[i][1] = x[i][1];
+    xhold[i][2] = x[i][2];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   compute forces on all but the last bead with the centroid neighbor lists,
+     including forces added by fixes in post_force()
+   store their normal-mode projections in fnm
+   bead energies are only tallied on steps when energy is computed
+   on exit x holds the positions of the last bead and forces are cleared,
+     so the regular force computation yields the forces of the last bead
+------------------------------------------------------------------------- */
+
+void FixPIMDLocal::pre_force(int /*vflag*/)
+{
+  double **x = atom->x;
+  int nlocal = atom->nlocal;
+  int nall = nlocal + atom->nghost;
+  int eflag = (update->eflag_global == update->ntimestep) ? ENERGY_GLOBAL : 0;
+
+  for (int i = 0; i < nall; i++) {
+    xcentroid[i][0] = x[i][0];
+    xcentroid[i][1] = x[i][1];
+    xcentroid[i][2] = x[i][2];
+  }
+
+  for (int i = 0; i < nlocal; i++)
+    for (int m = 0; m < 3 * np; m++) fnm[i][m] = 0.0;
+
+  if (eflag) pe_beads = pe_kspace = 0.0;
+  vir_beads = 0.0;
+
+  for (int j = 0; j < np; j++) {
+    for (int i = 0; i < nlocal; i++) {
+      double *dx = &xdisp[i][3 * j];
+      x[i][0] = xcentroid[i][0] + dx[0];
+      x[i][1] = xcentroid[i][1] + dx[1];
+      x[i][2] = xcentroid[i][2] + dx[2];
+    }
+    comm->forward_comm();
+
+    force_clear();
+    if (j == np - 1) break;
+
+    if (force->pair && force->pair->compute_flag) {
+      force->pair->compute(eflag, 0);
+      if (eflag) pe_beads += force->pair->eng_vdwl + force->pair->eng_coul;
+    }
+    if (atom->molecular != Atom::ATOMIC) {
+      if (force->bond) {
+        force->bond->compute(eflag, 0);
+        if (eflag) pe_beads += force->bond->energy;
+      }
+      if (force->angle) {
+        force->angle->compute(eflag, 0);
+        if (eflag) pe_beads += force->angle->energy;
+      }
+      if (force->dihedral) {
+        force->dihedral->compute(eflag, 0);
+        if (eflag) pe_beads += force->dihedral->energy;
+      }
+      if (force->improper) {
+        force->improper->compute(eflag, 0);
+        if (eflag) pe_beads += force->improper->energy;
+      }
+    }
+    if (force->kspace && force->kspace->compute_flag) {
+      force->kspace->compute(eflag, 0);
+      if (eflag) pe_kspace += force->kspace->energy;
+    }
+
+    if (force->newton) comm->reverse_comm();
+    if (modify->n_post_force_any) modify->post_force(0);
+
+    bead_forces(j);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   add the forces of the last bead from the regular force computation
+   and restore x of owned and ghost atoms to the centroids
+   kspace energy is already summed over procs and is kept separately
+------------------------------------------------------------------------- */
+
+void FixPIMDLocal::last_bead()
+{
+  double **x = atom->x;
+  int nall = atom->nlocal + atom->nghost;
+
+  if (update->eflag_global == update->ntimestep) {
+    if (force->pair && force->pair->compute_flag)
+      pe_beads += force->pair->eng_vdwl + force->pair->eng_coul;
+    if (atom->molecular != Atom::ATOMIC) {
+      if (force->bond) pe_beads += force->bond->energy;
+      if (force->angle) pe_beads += force->angle->energy;
+      if (force->dihedral) pe_beads += force->dihedral->energy;
+      if (force->improper) pe_beads += force->improper->energy;
+    }
+    if (force->kspace && force->kspace->compute_flag) pe_kspace += force->kspace->energy;
+  }
+
+  bead_forces(np - 1);
+
+  for (int i = 0; i < nall; i++) {
+    x[i][0] = xcentroid[i][0];
+    x[i][1] = xcentroid[i][1];
+    x[i][2] = xcentroid[i][2];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   project the forces on bead J onto the normal modes
+   and tally the bead contribution to the centroid-virial estimator
+------------------------------------------------------------------------- */
+
+void FixPIMDLocal::bead_forces(int j)
+{
+  double **f = atom->f;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  for (int i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit)) continue;
+    double *dx = &xdisp[i][3 * j];
+    vir_beads += dx[0] * f[i][0] + dx[1] * f[i][1] + dx[2] * f[i][2];
+    for (int k = 0; k < np; k++) {
+      double *fk = &fnm[i][3 * k];
+      double coeff = (k == 0) ? 1.0 / np : M_x2xp[k][j];
+      fk[0] += coeff * f[i][0];
+      fk[1] += coeff * f[i][1];
+      fk[2] += coeff * f[i][2];
+    }
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixPIMDLocal::final_integrate()
+{
+  last_bead();
+  b_step();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixPIMDLocal::reset_dt()
+{
+  nm_init();
+}
+
+/* ----------------------------------------------------------------------
+   update bead displacements from the non-centroid modes
+   set maxspread = largest bead distance from its centroid on any proc
+------------------------------------------------------------------------- */
+
+void FixPIMDLocal::bead_positions()
+{
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  double spreadmax = 0.0;
+
+  for (int i = 0; i < nlocal; i++) {
+    double *dx = xdisp[i];
+    for (int m = 0; m < 3 * np; m++) dx[m] = 0.0;
+    if (!(mask[i] & groupbit)) continue;
+
+    double *q = qnm[i];
+    for (int j = 0; j < np; j++) {
+      for (int k = 1; k < np; k++) {
+        double coeff = M_x2xp[k][j];
+        double *qk = &q[3 * (k - 1)];
+        dx[3 * j] += coeff * qk[0];
+        dx[3 * j + 1] += coeff * qk[1];
+        dx[3 * j + 2] += coeff * qk[2];
+      }
+      double rsq = dx[3 * j] * dx[3 * j] + dx[3 * j + 1] * dx[3 * j + 1] +
+          dx[3 * j + 2] * dx[3 * j + 2];
+      spreadmax = MAX(spreadmax, rsq);
+    }
+  }
+
+  spreadmax = sqrt(spreadmax);
+  MPI_Allreduce(&spreadmax, &maxspread, 1, MPI_DOUBLE, MPI_MAX, world);
+}
+
+/* ----------------------------------------------------------------------
+   free ring-polymer propagation for dt/2
+   centroid drifts, other modes rotate in their harmonic potential
+------------------------------------------------------------------------- */
+
+void FixPIMDLocal::a_step()
+{
+  double **x = atom->x;
+  double **v = atom->v;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  for (int i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit)) continue;
+
+    x[i][0] += 0.5 * dtv * v[i][0];
+    x[i][1] += 0.5 * dtv * v[i][1];
+    x[i][2] += 0.5 * dtv * v[i][2];
+
+    for (int k = 1; k < np; k++) {
+      double *q = &qnm[i][3 * (k - 1)];
+      double *vq = &vnm[i][3 * (k - 1)];
+      for (int d = 0; d < 3; d++) {
+        double q0 = q[d];
+        double v0 = vq[d];
+        q[d] = lan_c[k] * q0 + lan_s[k] / omega_k[k] * v0;
+        vq[d] = -omega_k[k] * lan_s[k] * q0 + lan_c[k] * v0;
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   PILE_L thermostat for a full timestep
+   the centroid velocity in atom->v is 1/sqrt(np) of its mode velocity
+------------------------------------------------------------------------- */
+
+void FixPIMDLocal::o_step()
+{
+  double **v = atom->v;
+  double *rmass = atom->rmass;
+  double *mass = atom->mass;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  for (int i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit)) continue;
+
+    double massone = rmass ? rmass[i] : mass[type[i]];
+    double vscale = sqrt(kt / (massone * force->mvv2e));
+
+    v[i][0] = c1_k[0] * v[i][0] + c2_k[0] * vscale * random->gaussian();
+    v[i][1] = c1_k[0] * v[i][1] + c2_k[0] * vscale * random->gaussian();
+    v[i][2] = c1_k[0] * v[i][2] + c2_k[0] * vscale * random->gaussian();
+
+    vscale *= sqrt((double) np);
+    for (int k = 1; k < np; k++) {
+      double *vq = &vnm[i][3 * (k - 1)];
+      for (int d = 0; d < 3; d++)
+        vq[d] = c1_k[k] * vq[d] + c2_k[k] * vscale * random->gaussian();
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   half-step velocity update from bead forces in normal-mode space
+   centroid feels the bead-averaged force
+------------------------------------------------------------------------- */
+
+void FixPIMDLocal::b_step()
+{
+  double **v = atom->v;
+  double *rmass = atom->rmass;
+  double *mass = atom->mass;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  for (int i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit)) continue;
+
+    double dtfm = dtf / (rmass ? rmass[i] : mass[type[i]]);
+    double *fk = fnm[i];
+
+    v[i][0] += dtfm * fk[0];
+    v[i][1] += dtfm * fk[1];
+    v[i][2] += dtfm * fk[2];
+
+    double *vq = vnm[i];
+    for (int m = 0; m < 3 * nmode; m++) vq[m] += dtfm * fk[m + 3];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   clear forces on owned and ghost atoms before each bead
+------------------------------------------------------------------------- */
+
+void FixPIMDLocal::force_clear()
+{
+  size_t nbytes = sizeof(double) * (atom->nlocal + atom->nghost);
+  if (nbytes == 0) return;
+
+  memset(&atom->f[0][0], 0, 3 * nbytes);
+  if (atom->torque_flag) memset(&atom->torque[0][0], 0, 3 * nbytes);
+}
+
+/* ----------------------------------------------------------------------
+   ring-polymer energies and kinetic energy estimators
+   1 = kinetic energy of all modes, 2 = spring energy,
+   3 = bead-averaged potential energy, 4 = conserved ring-polymer energy
+     without thermostat, 5 = primitive and 6 = centroid-virial estimator
+------------------------------------------------------------------------- */
+
+double FixPIMDLocal::compute_vector(int n)
+{
+  double **v = atom->v;
+  double *rmass = atom->rmass;
+  double *mass = atom->mass;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  double one[4] = {0.0, 0.0, pe_beads, vir_beads};
+  double all[4];
+
+  for (int i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit)) continue;
+    double massone = rmass ? rmass[i] : mass[type[i]];
+    one[0] += 0.5 * massone * np * (v[i][0] * v[i][0] + v[i][1] * v[i][1] + v[i][2] * v[i][2]);
+    for (int k = 1; k < np; k++) {
+      double *q = &qnm[i][3 * (k - 1)];
+      double *vq = &vnm[i][3 * (k - 1)];
+      one[0] += 0.5 * massone * (vq[0] * vq[0] + vq[1] * vq[1] + vq[2] * vq[2]);
+      one[1] += 0.5 * massone * omega_k[k] * omega_k[k] * (q[0] * q[0] + q[1] * q[1] + q[2] * q[2]);
+    }
+  }
+  one[0] *= force->mvv2e;
+  one[1] *= force->mvv2e;
+
+  MPI_Allreduce(one, all, 4, MPI_DOUBLE, MPI_SUM, world);
+
+  double ncount = group->count(igroup);
+
+  if (n == 0) return all[0];
+  if (n == 1) return all[1];
+  all[2] += pe_kspace;
+
+  if (n == 2) return all[2] / np;
+  if (n == 3) return all[0] + all[1] + all[2];
+  if (n == 4) return 1.5 * ncount * np * kt - all[1] / np;
+  return 1.5 * ncount * kt - 0.5 * all[3] / np;
+}
+
+/* ----------------------------------------------------------------------
+   memory usage of local atom-based arrays
+------------------------------------------------------------------------- */
+
+double FixPIMDLocal::memory_usage()
+{
+  double bytes = (double) atom->nmax * (6 * nmode + 6 * np + 6) * sizeof(double);
+  bytes += (double) 6 * np * sizeof(double);
+  bytes += (double) np * np * sizeof(double);
+  return bytes;
+}
+
+/* ----------------------------------------------------------------------
+   allocate atom-based arrays
+------------------------------------------------------------------------- */
+
+void FixPIMDLocal::grow_arrays(int nmax)
+{
+  memory->grow(qnm, nmax, 3 * nmode, "pimd/local:qnm");
+  memory->grow(vnm, nmax, 3 * nmode, "pimd/local:vnm");
+  memory->grow(xdisp, nmax, 3 * np, "pimd/local:xdisp");
+  memory->grow(fnm, nmax, 3 * np, "pimd/local:fnm");
+  memory->grow(xhold, nmax, 3, "pimd/local:xhold");
+  memory->grow(xcentroid, nmax, 3, "pimd/local:xcentroid");
+}
+
+/* ----------------------------------------------------------------------
+   copy values within local atom-based arrays
+------------------------------------------------------------------------- */
+
+void FixPIMDLocal::copy_arrays(int i, int j, int /*delflag*/)
+{
+  memcpy(qnm[j], qnm[i], 3 * nmode * sizeof(double));
+  memcpy(vnm[j], vnm[i], 3 * nmode * sizeof(double));
+  memcpy(xdisp[j], xdisp[i], 3 * np * sizeof(double));
+  memcpy(fnm[j], fnm[i], 3 * np * sizeof(double));
+  xhold[j][0] = xhold[i][0];
+  xhold[j][1] = xhold[i][1];
+  xhold[j][2] = xhold[i][2];
+}
+
+/* ----------------------------------------------------------------------
+   pack values in local atom-based arrays for exchange with another proc
+   bead forces are recomputed after exchange and not sent
+------------------------------------------------------------------------- */
+
+int FixPIMDLocal::pack_exchange(int i, double *buf)
+{
+  int m = 0;
+  for (int k = 0; k < 3 * nmode; k++) buf[m++] = qnm[i][k];
+  for (int k = 0; k < 3 * nmode; k++) buf[m++] = vnm[i][k];
+  for (int k = 0; k < 3 * np; k++) buf[m++] = xdisp[i][k];
+  return m;
+}
+
+/* ----------------------------------------------------------------------
+   unpack values in local atom-based arrays from exchange with another proc
+------------------------------------------------------------------------- */
+
+int FixPIMDLocal::unpack_exchange(int nlocal, double *buf)
+{
+  int m = 0;
+  for (int k = 0; k < 3 * nmode; k++) qnm[nlocal][k] = buf[m++];
+  for (int k = 0; k < 3 * nmode; k++) vnm[nlocal][k] = buf[m++];
+  for (int k = 0; k < 3 * np; k++) xdisp[nlocal][k] = buf[m++];
+  return m;
+}
+
+/* ----------------------------------------------------------------------
+   pack values in local atom-based arrays for restart file
+------------------------------------------------------------------------- */
+
+int FixPIMDLocal::pack_restart(int i, double *buf)
+{
+  // pack buf[0] this way because other fixes unpack it
+  int m = 1;
+  for (int k = 0; k < 3 * nmode; k++) buf[m++] = qnm[i][k];
+  for (int k = 0; k < 3 * nmode; k++) buf[m++] = vnm[i][k];
+  buf[0] = m;
+  return m;
+}
+
+/* ----------------------------------------------------------------------
+   unpack values from atom->extra array to restart the fix
+------------------------------------------------------------------------- */
+
+void FixPIMDLocal::unpack_restart(int nlocal, int nth)
+{
+  double **extra = atom->extra;
+
+  // skip to Nth set of extra values
+  // unpack the Nth first values this way because other fixes pack them
+
+  int m = 0;
+  for (int i = 0; i < nth; i++) m += static_cast<int>(extra[nlocal][m]);
+  m++;
+
+  for (int k = 0; k < 3 * nmode; k++) qnm[nlocal][k] = extra[nlocal][m++];
+  for (int k = 0; k < 3 * nmode; k++) vnm[nlocal][k] = extra[nlocal][m++];
+
+  beads_ready = 1;
+}
+
+/* ----------------------------------------------------------------------
+   maxsize of any atom's restart data
+------------------------------------------------------------------------- */
+
+int FixPIMDLocal::maxsize_restart()
+{
+  return 6 * nmode + 1;
+}
+
+/* ----------------------------------------------------------------------
+   size of atom nlocal's restart data
+------------------------------------------------------------------------- */
+
+int FixPIMDLocal::size_restart(int /*nlocal*/)
+{
+  return 6 * nmode + 1;
+}
@@ -0,0 +1,109 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+// clang-format off
+FixStyle(pimd/local,FixPIMDLocal);
+// clang-format on
+#else
+
+#ifndef LMP_FIX_PIMD_LOCAL_H
+#define LMP_FIX_PIMD_LOCAL_H
+
+#include "fix.h"
+
+namespace LAMMPS_NS {
+
+class FixPIMDLocal : public Fix {
+ public:
+  FixPIMDLocal(class LAMMPS *, int, char **);
+  ~FixPIMDLocal() override;
+
+  int setmask() override;
+  void init() override;
+  void setup(int) override;
+  void setup_post_neighbor() override;
+  void setup_pre_force(int) override;
+  void initial_integrate(int) override;
+  void post_neighbor() override;
+  void pre_force(int) override;
+  void final_integrate() override;
+  void reset_dt() override;
+  double compute_vector(int) override;
+
+  double memory_usage() override;
+  void grow_arrays(int) override;
+  void copy_arrays(int, int, int) override;
+  int pack_exchange(int, double *) override;
+  int unpack_exchange(int, double *) override;
+  int pack_restart(int, double *) override;
+  void unpack_restart(int, int) override;
+  int size_restart(int) override;
+  int maxsize_restart() override;
+
+ protected:
+  int np;              // number of beads
+  double temp;         // temperature
+  double tau;          // damping time of centroid mode
+  double pilescale;    // damping scale of non-centroid modes
+  int seed;
+  double sp;           // scaling factor of Planck's constant
+
+  double hbar, kt, omega_np;
+  double dtv, dtf;
+  int nmode;    // # of non-centroid modes = np-1
+
+  // normal modes, row K of M_x2xp is eigenvector of mode K
+  // mode 0 is the centroid, stored in atom->x and atom->v
+
+  double **M_x2xp;
+  double *omega_k;        // frequency of each mode
+  double *lan_c, *lan_s;  // cos() and sin() of omega_k*dt/2
+  double *c1_k, *c2_k;    // PILE_L coefficients for each mode
+
+  // per-atom arrays
+  // qnm,vnm are the non-centroid normal modes, 3*nmode values per atom
+  // xdisp = displacement of each bead from the centroid, 3*np values
+  // fnm = average bead force, then non-centroid mode forces, 3*np values
+
+  double **qnm, **vnm, **xdisp, **fnm;
+  double **xhold;        // centroid coords at last reneighboring
+  double **xcentroid;    // centroid coords while beads are evaluated
+
+  int beads_ready;    // 1 if qnm,vnm are initialized or read from restart
+  double skinhalf;    // 1/2 of neighbor skin
+  double maxspread;   // max bead distance from centroid on this step
+
+  // per-proc tallies of bead quantities, summed in compute_vector()
+
+  double pe_beads;     // sum of potential energy of all beads
+  double pe_kspace;    // sum of kspace energy of all beads, same on all procs
+  double vir_beads;    // sum of (bead - centroid) dot bead force
+
+  class RanMars *random;
+
+  void nm_init();
+  void beads_init();
+  void bead_positions();
+  void a_step();
+  void o_step();
+  void b_step();
+  void bead_forces(int);
+  void last_bead();
+  void force_clear();
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
@@ -0,0 +1,325 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "min_lbfgs_neb.h"
+
+#include "atom.h"
+#include "error.h"
+#include "fix_minimize.h"
+#include "output.h"
+#include "timer.h"
+#include "universe.h"
+#include "update.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace LAMMPS_NS;
+
+// EPS_ENERGY = minimum normalization for energy tolerance
+
+static constexpr double EPS_ENERGY = 1.0e-8;
+
+/* ---------------------------------------------------------------------- */
+
+MinLBFGSNEB::MinLBFGSNEB(LAMMPS *lmp) :
+    Min(lmp), rho(nullptr), alpha(nullptr), s(nullptr), y(nullptr)
+{
+  nmemory = 10;
+  npair = ipair = havestep = 0;
+  gamma = 0.0;
+  chainworld = world;
+}
+
+/* ---------------------------------------------------------------------- */
+
+MinLBFGSNEB::~MinLBFGSNEB()
+{
+  delete[] rho;
+  delete[] alpha;
+  delete[] s;
+  delete[] y;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void MinLBFGSNEB::init()
+{
+  Min::init();
+
+  // when minimizing across replicas, e.g. for NEB, all dot products
+  //   and step limits are computed for the stacked coordinates of the chain
+  // each proc contributes its own atoms only once,
+  //   so the replicas may run on partitions of different size
+
+  if (update->multireplica == 1) chainworld = universe->uworld;
+  else chainworld = world;
+
+  npair = ipair = havestep = 0;
+  gamma = 0.0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void MinLBFGSNEB::setup_style()
+{
+  // memory for x0,f0,d and the s,y correction pairs for atomic dof
+  // x0 must be the 1st vector, so fix minimize can reset it across PBC
+
+  fix_minimize->add_vector(3);
+  fix_minimize->add_vector(3);
+  fix_minimize->add_vector(3);
+  for (int m = 0; m < 2 * nmemory; m++) fix_minimize->add_vector(3);
+
+  delete[] rho;
+  delete[] alpha;
+  delete[] s;
+  delete[] y;
+  rho = new double[nmemory];
+  alpha = new double[nmemory];
+  s = new double *[nmemory];
+  y = new double *[nmemory];
+
+  npair = ipair = havestep = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int MinLBFGSNEB::modify_param(int narg, char **arg)
+{
+  if (strcmp(arg[0], "memory") == 0) {
+    if (narg < 2) error->all(FLERR, "Illegal min_modify command");
+    nmemory = utils::inumeric(FLERR, arg[1], false, lmp);
+    if (nmemory <= 0) error->all(FLERR, "Illegal min_modify memory value: {}", nmemory);
+    return 2;
+  }
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+   set current vector lengths and pointers
+   called after atoms have migrated
+------------------------------------------------------------------------- */
+
+void MinLBFGSNEB::reset_vectors()
+{
+  // atomic dof
+
+  nvec = 3 * atom->nlocal;
+  if (nvec) xvec = atom->x[0];
+  if (nvec) fvec = atom->f[0];
+  x0 = fix_minimize->request_vector(0);
+  f0 = fix_minimize->request_vector(1);
+  d = fix_minimize->request_vector(2);
+  for (int m = 0; m < nmemory; m++) {
+    s[m] = fix_minimize->request_vector(3 + 2 * m);
+    y[m] = fix_minimize->request_vector(4 + 2 * m);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   minimization via limited memory BFGS without line search
+   forces are used as negative gradient, which also works for
+     non-conservative forces such as the nudged forces of fix neb
+------------------------------------------------------------------------- */
+
+int MinLBFGSNEB::iterate(int maxiter)
+{
+  int i, m, k, flag, flagall;
+  bigint ntimestep;
+  double h0, beta, dmaxall, fdotd;
+
+  alpha_final = 0.0;
+
+  for (int iter = 0; iter < maxiter; iter++) {
+
+    if (timer->check_timeout(niter)) return TIMEOUT;
+
+    ntimestep = ++update->ntimestep;
+    niter++;
+
+    // store correction pair of previous step
+    // NEB forces are not the gradient of an energy, so if the pair
+    //   violates the curvature condition, discard all stored pairs
+
+    if (havestep) {
+      k = (ipair + 1) % nmemory;
+      double *sk = s[k];
+      double *yk = y[k];
+      double one[2] = {0.0, 0.0};
+      double all[2];
+      for (i = 0; i < nvec; i++) {
+        sk[i] = xvec[i] - x0[i];
+        yk[i] = f0[i] - fvec[i];
+        one[0] += sk[i] * yk[i];
+        one[1] += yk[i] * yk[i];
+      }
+      MPI_Allreduce(one, all, 2, MPI_DOUBLE, MPI_SUM, chainworld);
+
+      if (all[0] > 0.0 && all[1] > 0.0) {
+        ipair = k;
+        if (npair < nmemory) npair++;
+        rho[k] = 1.0 / all[0];
+        gamma = all[0] / all[1];
+      } else
+        npair = 0;
+    }
+
+    // initial inverse Hessian scaling
+    // before any curvature information is available,
+    //   take a steepest descent step that moves the fastest atom by dmax
+
+    if (gamma > 0.0)
+      h0 = gamma;
+    else {
+      for (i = 0; i < nvec; i++) d[i] = fvec[i];
+      dmaxall = maxstep();
+      h0 = (dmaxall > 0.0) ? dmax / dmaxall : 0.0;
+    }
+
+    // two-loop recursion for step d = H f
+
+    for (i = 0; i < nvec; i++) d[i] = fvec[i];
+
+    k = ipair;
+    for (m = 0; m < npair; m++) {
+      alpha[k] = rho[k] * dot(s[k], d);
+      for (i = 0; i < nvec; i++) d[i] -= alpha[k] * y[k][i];
+      k = (k + nmemory - 1) % nmemory;
+    }
+
+    for (i = 0; i < nvec; i++) d[i] *= h0;
+
+    for (m = 0; m < npair; m++) {
+      k = (k + 1) % nmemory;
+      beta = rho[k] * dot(y[k], d);
+      for (i = 0; i < nvec; i++) d[i] += (alpha[k] - beta) * s[k][i];
+    }
+
+    // if step is not downhill w.r.t. the forces, restart from steepest descent
+
+    if (npair) {
+      fdotd = dot(fvec, d);
+      if (fdotd <= 0.0) {
+        npair = 0;
+        for (i = 0; i < nvec; i++) d[i] = h0 * fvec[i];
+      }
+    }
+
+    // limit step so no atom moves further than dmax
+    // a single scale factor keeps the step direction of the whole chain
+
+    dmaxall = maxstep();
+    if (dmaxall > dmax) {
+      double scale = dmax / dmaxall;
+      for (i = 0; i < nvec; i++) d[i] *= scale;
+    }
+
+    // save current state and take step
+
+    for (i = 0; i < nvec; i++) {
+      x0[i] = xvec[i];
+      f0[i] = fvec[i];
+      xvec[i] += d[i];
+    }
+    fix_minimize->store_box();
+    havestep = 1;
+
+    eprevious = ecurrent;
+    ecurrent = energy_force(1);
+    neval++;
+
+    // energy tolerance criterion
+    // sync across replicas if running multi-replica minimization
+
+    if (update->etol > 0.0) {
+      if (update->multireplica == 0) {
+        if (fabs(ecurrent - eprevious) <
+            update->etol * 0.5 * (fabs(ecurrent) + fabs(eprevious) + EPS_ENERGY))
+          return ETOL;
+      } else {
+        if (fabs(ecurrent - eprevious) <
+            update->etol * 0.5 * (fabs(ecurrent) + fabs(eprevious) + EPS_ENERGY))
+          flag = 0;
+        else
+          flag = 1;
+        MPI_Allreduce(&flag, &flagall, 1, MPI_INT, MPI_SUM, universe->uworld);
+        if (flagall == 0) return ETOL;
+      }
+    }
+
+    // force tolerance criterion
+    // sync across replicas if running multi-replica minimization
+
+    double fdotf = 0.0;
+    if (update->ftol > 0.0) {
+      if (normstyle == MAX)
+        fdotf = fnorm_max();    // max force norm
+      else if (normstyle == INF)
+        fdotf = fnorm_inf();    // inf force norm
+      else if (normstyle == TWO)
+        fdotf = fnorm_sqr();    // Euclidean force 2-norm
+      else
+        error->all(FLERR, "Illegal min_modify command");
+      if (update->multireplica == 0) {
+        if (fdotf < update->ftol * update->ftol) return FTOL;
+      } else {
+        if (fdotf < update->ftol * update->ftol)
+          flag = 0;
+        else
+          flag = 1;
+        MPI_Allreduce(&flag, &flagall, 1, MPI_INT, MPI_SUM, universe->uworld);
+        if (flagall == 0) return FTOL;
+      }
+    }
+
+    // output for thermo, dump, restart files
+
+    if (output->next == ntimestep) {
+      timer->stamp();
+      output->write(ntimestep);
+      timer->stamp(Timer::OUTPUT);
+    }
+  }
+
+  return MAXITER;
+}
+
+/* ----------------------------------------------------------------------
+   dot product of two atomic dof vectors across all procs of the chain
+------------------------------------------------------------------------- */
+
+double MinLBFGSNEB::dot(double *a, double *b)
+{
+  double one = 0.0;
+  double all;
+  for (int i = 0; i < nvec; i++) one += a[i] * b[i];
+  MPI_Allreduce(&one, &all, 1, MPI_DOUBLE, MPI_SUM, chainworld);
+  return all;
+}
+
+/* ----------------------------------------------------------------------
+   largest displacement of any atom in step vector d across the chain
+------------------------------------------------------------------------- */
+
+double MinLBFGSNEB::maxstep()
+{
+  double one = 0.0;
+  double all;
+  for (int i = 0; i < nvec; i += 3) {
+    double dsq = d[i] * d[i] + d[i + 1] * d[i + 1] + d[i + 2] * d[i + 2];
+    if (dsq > one) one = dsq;
+  }
+  MPI_Allreduce(&one, &all, 1, MPI_DOUBLE, MPI_MAX, chainworld);
+  return sqrt(all);
+}
@@ -0,0 +1,60 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef MINIMIZE_CLASS
+// clang-format off
+MinimizeStyle(lbfgs/neb,MinLBFGSNEB);
+// clang-format on
+#else
+
+#ifndef LMP_MIN_LBFGS_NEB_H
+#define LMP_MIN_LBFGS_NEB_H
+
+#include "min.h"
+
+namespace LAMMPS_NS {
+
+class MinLBFGSNEB : public Min {
+ public:
+  MinLBFGSNEB(class LAMMPS *);
+  ~MinLBFGSNEB() override;
+
+  void init() override;
+  void setup_style() override;
+  int modify_param(int, char **) override;
+  void reset_vectors() override;
+  int iterate(int) override;
+
+ protected:
+  MPI_Comm chainworld;    // world or universe if minimizing across replicas
+
+  int nmemory;         // max # of stored correction pairs
+  int npair;           // # of currently stored correction pairs
+  int ipair;           // index of most recent correction pair
+  int havestep;        // 1 if x0,f0 hold the previous step
+  double gamma;        // scaling of initial inverse Hessian
+  double *rho, *alpha;
+
+  double *x0;          // coords at start of previous step
+  double *f0;          // forces at start of previous step
+  double *d;           // step vector
+  double **s, **y;     // correction pairs, position and force differences
+
+  double dot(double *, double *);
+  double maxstep();
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
@@ -44,7 +44,8 @@ enum { DEFAULT, TERSE, VERBOSE };
 
 /* ---------------------------------------------------------------------- */
 
-NEB::NEB(LAMMPS *lmp) : Command(lmp), fp(nullptr), all(nullptr), rdist(nullptr)
+NEB::NEB(LAMMPS *lmp) :
+    Command(lmp), roots(MPI_COMM_NULL), fp(nullptr), all(nullptr), rdist(nullptr)
 {
   print_mode = DEFAULT;
 
@@ -95,7 +96,7 @@ NEB::NEB(LAMMPS *lmp, double etol_in, double ftol_in, int n1steps_in, int n2step
 
 NEB::~NEB()
 {
-  MPI_Comm_free(&roots);
+  if (roots != MPI_COMM_NULL) MPI_Comm_free(&roots);
   memory->destroy(all);
   delete[] rdist;
   if (fp) {
@@ -285,8 +285,11 @@ void PRD::command(int narg, char **arg)
   // (1) dephase independently on each proc after event
   // (2) loop: dynamics, store state, quench, check event, restore state
   // (3) share and record event
+  // with screening, quench only if averaged coords moved away from basin,
+  //   an event late in an interval is then detected at the next check
 
   nbuild = ndanger = 0;
+  nquench = nscreen = 0;
   time_dephase = time_dynamics = time_quench = time_comm = time_output = 0.0;
   bigint clock = 0;
 
@@ -295,6 +298,8 @@ void PRD::command(int narg, char **arg)
   time_start = timer->get_wall(Timer::TOTAL);
 
   int istep = 0;
+  ndephase_left = n_dephase;
+  dephase_stored = 0;
 
   while (istep < nsteps) {
     dephase();
@@ -302,13 +307,16 @@ void PRD::command(int narg, char **arg)
     if (stepmode == 0) istep = update->ntimestep - update->beginstep;
     else istep = clock;
 
+    if (screen_flag) fix_event->reset_screen(screen_window);
+
     ireplica = -1;
     while (istep < nsteps) {
       dynamics(t_event,time_dynamics);
       fix_event->store_state_quench();
-      quench();
+      int quenched = screen_quench();
+      if (quenched) quench();
       clock += (bigint)t_event*universe->nworlds;
-      ireplica = check_event();
+      ireplica = check_event(-1,quenched);
       if (ireplica >= 0) break;
       fix_event->restore_state_quench();
       if (stepmode == 0) istep = update->ntimestep - update->beginstep;
@@ -345,7 +353,27 @@ void PRD::command(int narg, char **arg)
     }
 
     // correlated event loop
-    // other procs could be dephasing during this time
+    // only the event replica needs to quench, since the final states of
+    //   all other replicas are overwritten by the event replica
+    // its last check is never screened, so no event is carried over
+    // if async_flag is set, the other replicas instead dephase from the
+    //   event state, one dephasing attempt per event check, and keep
+    //   their dephased state if no correlated event occurs
+
+    int async_corr = async_flag && t_corr > 0;
+    int event_world = (universe->iworld == ireplica);
+
+    if (async_corr) {
+      if (temp_flag == 0) {
+        if (event_world) temp_dephase = temperature->compute_scalar();
+        MPI_Bcast(&temp_dephase,1,MPI_DOUBLE,universe->root_proc[ireplica],
+                  universe->uworld);
+      }
+      ndephase_left = event_world ? 0 : n_dephase;
+      dephase_stored = 0;
+    }
+
+    if (screen_flag) fix_event->reset_screen(screen_window);
 
     int corr_endstep = update->ntimestep + t_corr;
     while (update->ntimestep < corr_endstep) {
@@ -353,20 +381,38 @@ void PRD::command(int narg, char **arg)
         restart_flag = 0;
         break;
       }
-      dynamics(t_event,time_dynamics);
-      fix_event->store_state_quench();
-      quench();
+      int quenched = 0;
+      if (async_corr && !event_world) {
+        bigint ntimestep_hold = update->ntimestep;
+        if (ndephase_left) dephase_attempt();
+        update->ntimestep = ntimestep_hold + t_event;
+      } else {
+        dynamics(t_event,time_dynamics);
+        fix_event->store_state_quench();
+        if (event_world) {
+          if (update->ntimestep >= corr_endstep) quenched = 1;
+          else quenched = screen_quench();
+        }
+        if (quenched) quench();
+      }
       clock += t_event;
-      int corr_event_check = check_event(ireplica);
+      int corr_event_check = check_event(ireplica,quenched);
       if (corr_event_check >= 0) {
         share_event(ireplica,2,0);
         log_event();
         corr_endstep = update->ntimestep + t_corr;
-      } else fix_event->restore_state_quench();
+        if (async_corr && !event_world) {
+          ndephase_left = n_dephase;
+          dephase_stored = 0;
+        }
+        if (screen_flag) fix_event->reset_screen(screen_window);
+      } else if (!async_corr || event_world) fix_event->restore_state_quench();
     }
 
     // full init/setup since are starting all replicas after event
     // event replica bcasts temp to all replicas if temp_dephase is not set
+    // after an asynchronous correlated event search the event replica
+    //   needs no dephasing and the other replicas finish their dephasing
 
     update->whichflag = 1;
     lmp->init();
@@ -374,12 +420,16 @@ void PRD::command(int narg, char **arg)
 
     timer->barrier_start();
 
-    if (t_corr > 0) replicate(ireplica);
-    if (temp_flag == 0) {
-      if (ireplica == universe->iworld)
-        temp_dephase = temperature->compute_scalar();
-      MPI_Bcast(&temp_dephase,1,MPI_DOUBLE,universe->root_proc[ireplica],
-                      universe->uworld);
+    if (!async_corr) {
+      if (t_corr > 0) replicate(ireplica);
+      if (temp_flag == 0) {
+        if (ireplica == universe->iworld)
+          temp_dephase = temperature->compute_scalar();
+        MPI_Bcast(&temp_dephase,1,MPI_DOUBLE,universe->root_proc[ireplica],
+                  universe->uworld);
+      }
+      ndephase_left = n_dephase;
+      dephase_stored = 0;
     }
 
     timer->barrier_stop();
@@ -421,6 +471,21 @@ void PRD::command(int narg, char **arg)
     if (universe->ulogfile) fmt::print(universe->ulogfile, mesg);
   }
 
+  // quench counts summed over replicas, only proc 0 of each replica contributes
+
+  if (screen_flag) {
+    bigint counts_me[2],counts_all[2];
+    counts_me[0] = (me == 0) ? nquench : 0;
+    counts_me[1] = (me == 0) ? nscreen : 0;
+    MPI_Allreduce(counts_me,counts_all,2,MPI_LMP_BIGINT,MPI_SUM,universe->uworld);
+    if (me_universe == 0) {
+      auto mesg = fmt::format("Quenches performed {} skipped by screening {}\n",
+                              counts_all[0],counts_all[1]);
+      if (universe->uscreen) fmt::print(universe->uscreen, mesg);
+      if (universe->ulogfile) fmt::print(universe->ulogfile, mesg);
+    }
+  }
+
   if (me == 0) utils::logmesg(lmp,"\nPRD done\n");
 
   finish->end(2);
@@ -459,43 +524,54 @@ void PRD::command(int narg, char **arg)
 
 /* ----------------------------------------------------------------------
    dephasing = one or more short runs with new random velocities
+   ndephase_left iterations are still to do, each of t_dephase steps
+   fewer than n_dephase if dephasing started during correlated event search
 ------------------------------------------------------------------------- */
 
 void PRD::dephase()
 {
-  bigint ntimestep_hold = update->ntimestep;
+  // do not proceed to next iteration until an event-free run occurs
 
-  // n_dephase iterations of dephasing, each of t_dephase steps
+  while (ndephase_left > 0) dephase_attempt();
+}
+
+/* ----------------------------------------------------------------------
+   one attempt of a dephasing iteration
+   if an event occurs, the state at start of the iteration is restored
+   involves no communication between replicas
+------------------------------------------------------------------------- */
 
-  for (int i = 0; i < n_dephase; i++) {
+void PRD::dephase_attempt()
+{
+  bigint ntimestep_hold = update->ntimestep;
 
+  if (!dephase_stored) {
     fix_event->store_state_dephase();
+    dephase_stored = 1;
+  }
 
-    // do not proceed to next iteration until an event-free run occurs
-
-    int done = 0;
-    while (!done) {
-      int seed = static_cast<int> (random_dephase->uniform() * MAXSMALLINT);
-      if (seed == 0) seed = 1;
-      velocity->create(temp_dephase,seed);
+  int seed = static_cast<int> (random_dephase->uniform() * MAXSMALLINT);
+  if (seed == 0) seed = 1;
+  velocity->create(temp_dephase,seed);
 
-      dynamics(t_dephase,time_dephase);
-      fix_event->store_state_quench();
-      quench();
+  // always quench, since a missed event would leave the replica
+  //   in a different basin at the end of dephasing
 
-      if (compute_event->compute_scalar() > 0.0) {
-        fix_event->restore_state_dephase();
-        update->ntimestep -= t_dephase;
-        log_event();
-      } else {
-        fix_event->restore_state_quench();
-        done = 1;
-      }
+  dynamics(t_dephase,time_dephase);
+  fix_event->store_state_quench();
+  quench();
 
-      if (temp_flag == 0) temp_dephase = temperature->compute_scalar();
-    }
+  if (compute_event->compute_scalar() > 0.0) {
+    fix_event->restore_state_dephase();
+    log_event();
+  } else {
+    fix_event->restore_state_quench();
+    dephase_stored = 0;
+    ndephase_left--;
   }
 
+  if (temp_flag == 0) temp_dephase = temperature->compute_scalar();
+
   // reset timestep as if dephase did not occur
   // clear timestep storage from computes, since now invalid
 
@@ -560,6 +636,7 @@ void PRD::quench()
   //update->minimize->setup_minimal(1);
 
   int ncalls = neighbor->ncalls;
+  nquench++;
 
   timer->barrier_start();
   update->minimize->run(maxiter);
@@ -581,20 +658,37 @@ void PRD::quench()
     if (modify->compute[i]->timeflag) modify->compute[i]->clearstep();
 }
 
+/* ----------------------------------------------------------------------
+   decide if the hot state of this replica needs to be quenched
+   without screening always quench
+   else quench only if the running average of the atom coords moved
+     further than screen_dist from the basin of the last event
+   return 1 if quench is needed, 0 if no event can have occurred
+------------------------------------------------------------------------- */
+
+int PRD::screen_quench()
+{
+  if (!screen_flag) return 1;
+  if (fix_event->screen_signature() >= screen_dist) return 1;
+  nscreen++;
+  return 0;
+}
+
 /* ----------------------------------------------------------------------
    check for an event in any replica
    if replica_num is non-negative only check for event on replica_num
+   quenched = 0 if this replica skipped the quench, so it has no event
    if multiple events, choose one at random
    return -1 if no event
    else return ireplica = world in which event occurred
 ------------------------------------------------------------------------- */
 
-int PRD::check_event(int replica_num)
+int PRD::check_event(int replica_num, int quenched)
 {
   int worldflag,universeflag,scanflag,replicaflag,ireplica;
 
   worldflag = 0;
-  if (compute_event->compute_scalar() > 0.0) worldflag = 1;
+  if (quenched && compute_event->compute_scalar() > 0.0) worldflag = 1;
   if (replica_num >= 0 && replica_num != universe->iworld) worldflag = 0;
 
   timer->barrier_start();
@@ -852,6 +946,10 @@ void PRD::options(int narg, char **arg)
   maxeval = 50;
   temp_flag = 0;
   stepmode = 0;
+  screen_flag = 0;
+  screen_dist = 0.0;
+  screen_window = 0;
+  async_flag = 0;
 
   loop_setting = utils::strdup("geom");
   dist_setting = utils::strdup("gaussian");
@@ -899,6 +997,20 @@ void PRD::options(int narg, char **arg)
       else error->all(FLERR,"Illegal prd command");
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"screen") == 0) {
+      if (iarg+3 > narg) error->all(FLERR,"Illegal prd command");
+      screen_dist = utils::numeric(FLERR,arg[iarg+1],false,lmp);
+      screen_window = utils::inumeric(FLERR,arg[iarg+2],false,lmp);
+      if (screen_dist <= 0.0 || screen_window <= 0)
+        error->all(FLERR,"Illegal prd command");
+      screen_flag = 1;
+      iarg += 3;
+
+    } else if (strcmp(arg[iarg],"async") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal prd command");
+      async_flag = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      iarg += 2;
+
     } else error->all(FLERR,"Illegal prd command");
   }
 }
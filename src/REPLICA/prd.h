@@ -37,6 +37,13 @@ class PRD : public Command {
   int maxiter, maxeval, temp_flag, stepmode, cmode;
   char *loop_setting, *dist_setting;
 
+  int screen_flag, screen_window;    // screen quenches by averaged displacement
+  double screen_dist;
+  int async_flag;                    // dephase during correlated event search
+  int ndephase_left;                 // dephase iterations left on this replica
+  int dephase_stored;                // 1 if state of current iteration is stored
+  bigint nquench, nscreen;           // # of quenches done and skipped
+
   int equal_size_replicas, natoms;
   int neigh_every, neigh_delay, neigh_dist_check;
   int quench_reneighbor;
@@ -62,9 +69,11 @@ class PRD : public Command {
   class Finish *finish;
 
   void dephase();
+  void dephase_attempt();
   void dynamics(int, double &);
   void quench();
-  int check_event(int replica = -1);
+  int screen_quench();
+  int check_event(int replica = -1, int quenched = 1);
   void share_event(int, int, int);
   void log_event();
   void replicate(int);
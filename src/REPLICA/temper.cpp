@@ -33,26 +33,38 @@
 #include "update.h"
 
 #include <cmath>
+#include <cstring>
 
 using namespace LAMMPS_NS;
 
 #define TEMPER_DEBUG 0
 
+// message tags: pair exchange, outer neighbor notification, relay to partner
+
+enum { PAIRTAG, OUTERTAG, RELAYTAG };
+
 /* ---------------------------------------------------------------------- */
 
-Temper::Temper(LAMMPS *lmp) : Command(lmp) {}
+Temper::Temper(LAMMPS *lmp) :
+    Command(lmp), mycmd("temper"), roots(MPI_COMM_NULL), ranswap(nullptr), ranboltz(nullptr),
+    swaplog(nullptr), set_temp(nullptr), temp2world(nullptr), world2temp(nullptr),
+    world2root(nullptr), world_energy(nullptr)
+{
+}
 
 /* ---------------------------------------------------------------------- */
 
 Temper::~Temper()
 {
-  MPI_Comm_free(&roots);
-  if (ranswap) delete ranswap;
+  if (roots != MPI_COMM_NULL) MPI_Comm_free(&roots);
+  if (swaplog) fclose(swaplog);
+  delete ranswap;
   delete ranboltz;
   delete[] set_temp;
   delete[] temp2world;
   delete[] world2temp;
   delete[] world2root;
+  delete[] world_energy;
 }
 
 /* ----------------------------------------------------------------------
@@ -62,10 +74,11 @@ Temper::~Temper()
 void Temper::command(int narg, char **arg)
 {
   if (universe->nworlds == 1)
-    error->universe_all(FLERR,"More than one processor partition required for temper command");
+    error->universe_all(FLERR,fmt::format("More than one processor partition required for {} command",
+                                          mycmd));
   if (domain->box_exist == 0)
-    error->universe_all(FLERR,"Temper command before simulation box is defined");
-  if (narg != 6 && narg != 7) error->universe_all(FLERR,"Illegal temper command");
+    error->universe_all(FLERR,fmt::format("{} command before simulation box is defined", mycmd));
+  if (narg < 6) error->universe_all(FLERR,fmt::format("Illegal {} command", mycmd));
 
   int nsteps = utils::inumeric(FLERR,arg[0],false,lmp);
   nevery = utils::inumeric(FLERR,arg[1],false,lmp);
@@ -82,28 +95,57 @@ void Temper::command(int narg, char **arg)
   seed_swap = utils::inumeric(FLERR,arg[4],false,lmp);
   seed_boltz = utils::inumeric(FLERR,arg[5],false,lmp);
 
+  // optional temperature index, then optional keywords
+
+  int iarg = 6;
+  int restartflag = 0;
   my_set_temp = universe->iworld;
-  if (narg == 7) my_set_temp = utils::inumeric(FLERR,arg[6],false,lmp);
+  if ((narg > 6) && utils::is_integer(arg[6])) {
+    my_set_temp = utils::inumeric(FLERR,arg[6],false,lmp);
+    restartflag = 1;
+    iarg = 7;
+  }
   if ((my_set_temp < 0) || (my_set_temp >= universe->nworlds))
     error->universe_one(FLERR,"Invalid temperature index value");
 
+  asyncflag = 0;
+  nattempt = 0;
+  std::string swapfile;
+
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"exchange") == 0) {
+      if (iarg+2 > narg) error->universe_all(FLERR,fmt::format("Illegal {} command", mycmd));
+      if (strcmp(arg[iarg+1],"sync") == 0) asyncflag = 0;
+      else if (strcmp(arg[iarg+1],"async") == 0) asyncflag = 1;
+      else error->universe_all(FLERR,fmt::format("Unknown {} exchange mode {}", mycmd, arg[iarg+1]));
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"gibbs") == 0) {
+      if (iarg+2 > narg) error->universe_all(FLERR,fmt::format("Illegal {} command", mycmd));
+      nattempt = utils::inumeric(FLERR,arg[iarg+1],false,lmp);
+      if (nattempt <= 0)
+        error->universe_all(FLERR,fmt::format("Invalid {} gibbs attempt count", mycmd));
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"swaplog") == 0) {
+      if (iarg+2 > narg) error->universe_all(FLERR,fmt::format("Illegal {} command", mycmd));
+      swapfile = arg[iarg+1];
+      iarg += 2;
+    } else error->universe_all(FLERR,fmt::format("Unknown {} keyword: {}", mycmd, arg[iarg]));
+  }
+
+  if (asyncflag && nattempt)
+    error->universe_all(FLERR,fmt::format("{} gibbs swaps require synchronous exchange", mycmd));
+
   // swap frequency must evenly divide total # of timesteps
 
   if (nevery <= 0)
-    error->universe_all(FLERR,"Invalid frequency in temper command");
+    error->universe_all(FLERR,fmt::format("Invalid frequency in {} command", mycmd));
   nswaps = nsteps/nevery;
   if (nswaps*nevery != nsteps)
-    error->universe_all(FLERR,"Non integer # of swaps in temper command");
+    error->universe_all(FLERR,fmt::format("Non integer # of swaps in {} command", mycmd));
 
-  // fix style must be appropriate for temperature control, i.e. it needs
-  // to provide a working Fix::reset_target() and must not change the volume.
+  // fix style must be appropriate for the tempering ensemble
 
-  if ((!utils::strmatch(whichfix->style,"^nvt")) &&
-      (!utils::strmatch(whichfix->style,"^langevin")) &&
-      (!utils::strmatch(whichfix->style,"^gl[de]$")) &&
-      (!utils::strmatch(whichfix->style,"^rigid/nvt")) &&
-      (!utils::strmatch(whichfix->style,"^temp/")))
-    error->universe_all(FLERR,"Tempering temperature fix is not supported");
+  check_fix();
 
   // setup for long tempering run
 
@@ -169,23 +211,59 @@ void Temper::command(int narg, char **arg)
 
   world2temp = new int[nworlds];
   temp2world = new int[nworlds];
+  int badindex = 0;
   if (me == 0) {
     MPI_Allgather(&my_set_temp,1,MPI_INT,world2temp,1,MPI_INT,roots);
-    for (int i = 0; i < nworlds; i++) temp2world[world2temp[i]] = i;
+    for (int i = 0; i < nworlds; i++) temp2world[i] = -1;
+    for (int i = 0; i < nworlds; i++) {
+      if ((world2temp[i] < 0) || (world2temp[i] >= nworlds) || (temp2world[world2temp[i]] >= 0))
+        badindex = 1;
+      else temp2world[world2temp[i]] = i;
+    }
   }
+  MPI_Bcast(&badindex,1,MPI_INT,0,world);
+  if (badindex)
+    error->universe_all(FLERR,fmt::format("Temperature indices in {} command are not a "
+                                          "permutation of the partitions", mycmd));
   MPI_Bcast(temp2world,nworlds,MPI_INT,0,world);
 
+  if (nattempt) world_energy = new double[nworlds];
+
+  // in asynchronous mode root procs only keep track of the worlds
+  //   simulating the adjacent set temps
+
+  neighbor[0] = (my_set_temp > 0) ? temp2world[my_set_temp-1] : -1;
+  neighbor[1] = (my_set_temp < nworlds-1) ? temp2world[my_set_temp+1] : -1;
+  outer_side = last_partner = -1;
+  last_side = last_swap = 0;
+
+  // open binary swap log on root proc of each world
+  // header = magic string, # of worlds, my world, swap frequency, set temps
+
+  if (!swapfile.empty() && (me == 0)) {
+    auto logname = fmt::format("{}.{}", swapfile, iworld);
+    swaplog = fopen(logname.c_str(),"wb");
+    if (!swaplog)
+      error->one(FLERR,"Cannot open {} swap log file {}: {}", mycmd, logname, utils::getsyserror());
+    const char magic[] = "LammpsTemperSwap";
+    fwrite(magic,sizeof(char),sizeof(magic),swaplog);
+    fwrite(&nworlds,sizeof(int),1,swaplog);
+    fwrite(&iworld,sizeof(int),1,swaplog);
+    fwrite(&nevery,sizeof(int),1,swaplog);
+    fwrite(set_temp,sizeof(double),nworlds,swaplog);
+  }
+
   // if restarting tempering, reset temp target of Fix to current my_set_temp
 
-  if (narg == 7) {
+  if (restartflag) {
     double new_temp = set_temp[my_set_temp];
     whichfix->reset_target(new_temp);
   }
 
   // setup tempering runs
 
-  int i,which,partner,swap,partner_set_temp,partner_world;
-  double pe,pe_partner,boltz_factor,new_temp;
+  int i,which,partner,swap,partner_set_temp,partner_world,old_set_temp;
+  double pe,energy,new_temp;
 
   if (me_universe == 0 && universe->uscreen)
     fprintf(universe->uscreen,"Setting up tempering ...\n");
@@ -211,6 +289,10 @@ void Temper::command(int narg, char **arg)
   timer->init();
   timer->barrier_start();
 
+  int my_timeout = 0;
+  int any_timeout = 0;
+  MPI_Request timeout_request = MPI_REQUEST_NULL;
+
   for (int iswap = 0; iswap < nswaps; iswap++) {
 
     // run for nevery timesteps
@@ -219,14 +301,23 @@ void Temper::command(int narg, char **arg)
     update->integrate->run(nevery);
 
     // check for timeout across all procs
-
-    int my_timeout=0;
-    int any_timeout=0;
-    if (timer->is_timeout()) my_timeout=1;
-    MPI_Allreduce(&my_timeout, &any_timeout, 1, MPI_INT, MPI_SUM, universe->uworld);
-    if (any_timeout) {
-      timer->force_timeout();
-      break;
+    // in asynchronous mode the check overlaps with the next nevery steps
+    //   and thus stops the run one exchange later
+
+    my_timeout = timer->is_timeout() ? 1 : 0;
+    if (asyncflag) {
+      if (timeout_request != MPI_REQUEST_NULL) MPI_Wait(&timeout_request,MPI_STATUS_IGNORE);
+      if (any_timeout) {
+        timer->force_timeout();
+        break;
+      }
+      MPI_Iallreduce(&my_timeout,&any_timeout,1,MPI_INT,MPI_SUM,universe->uworld,&timeout_request);
+    } else {
+      MPI_Allreduce(&my_timeout,&any_timeout,1,MPI_INT,MPI_SUM,universe->uworld);
+      if (any_timeout) {
+        timer->force_timeout();
+        break;
+      }
     }
 
     // compute PE
@@ -234,6 +325,17 @@ void Temper::command(int narg, char **arg)
 
     pe = pe_compute->compute_scalar();
     pe_compute->addstep(update->ntimestep + nevery);
+    energy = exchange_energy(pe);
+    old_set_temp = my_set_temp;
+
+    // Gibbs sampling of set temps for all worlds at once
+
+    if (nattempt) {
+      exchange_gibbs(energy);
+      if (swaplog) write_swaplog(-1,old_set_temp,my_set_temp,energy);
+      if (me_universe == 0) print_status();
+      continue;
+    }
 
     // which = which of 2 kinds of swaps to do (0,1)
 
@@ -251,46 +353,22 @@ void Temper::command(int narg, char **arg)
       else partner_set_temp = my_set_temp - 1;
     }
 
-    // partner = proc ID to swap with
-    // if partner = -1, then I am not a proc that swaps
+    // swap with a partner, only root procs in each world participate
 
-    partner = -1;
-    if (me == 0 && partner_set_temp >= 0 && partner_set_temp < nworlds) {
-      partner_world = temp2world[partner_set_temp];
-      partner = world2root[partner_world];
-    }
+    if (asyncflag) swap = exchange_async(partner_set_temp,energy);
+    else {
 
-    // swap with a partner, only root procs in each world participate
-    // hi proc sends PE to low proc
-    // lo proc make Boltzmann decision on whether to swap
-    // lo proc communicates decision back to hi proc
-
-    swap = 0;
-    if (partner != -1) {
-      if (me_universe > partner)
-        MPI_Send(&pe,1,MPI_DOUBLE,partner,0,universe->uworld);
-      else
-        MPI_Recv(&pe_partner,1,MPI_DOUBLE,partner,0,universe->uworld,MPI_STATUS_IGNORE);
-
-      if (me_universe < partner) {
-        boltz_factor = (pe - pe_partner) *
-          (1.0/(boltz*set_temp[my_set_temp]) -
-           1.0/(boltz*set_temp[partner_set_temp]));
-        if (boltz_factor >= 0.0) swap = 1;
-        else if (ranboltz->uniform() < exp(boltz_factor)) swap = 1;
-      }
+      // partner = proc ID to swap with
+      // if partner = -1, then I am not a proc that swaps
 
-      if (me_universe < partner)
-        MPI_Send(&swap,1,MPI_INT,partner,0,universe->uworld);
-      else
-        MPI_Recv(&swap,1,MPI_INT,partner,0,universe->uworld,MPI_STATUS_IGNORE);
+      partner = -1;
+      if (me == 0 && partner_set_temp >= 0 && partner_set_temp < nworlds) {
+        partner_world = temp2world[partner_set_temp];
+        partner = world2root[partner_world];
+      }
 
-#if TEMPER_DEBUG
-      if (me_universe < partner)
-        fprintf(universe->uscreen,"SWAP %d & %d: yes = %d,Ts = %d %d, PEs = %g %g, Bz = %g %g\n",
-                me_universe,partner,swap,my_set_temp,partner_set_temp,
-                pe,pe_partner,boltz_factor,exp(boltz_factor));
-#endif
+      swap = 0;
+      if (partner != -1) swap = swap_partner(partner,partner_set_temp,energy);
     }
 
     // bcast swap result to other procs in my world
@@ -308,12 +386,16 @@ void Temper::command(int narg, char **arg)
       whichfix->reset_target(new_temp);
     }
 
-    // update my_set_temp and temp2world on every proc
-    // root procs update their value if swap took place
-    // allgather across root procs
-    // bcast within my world
+    // update my_set_temp on every proc
+    // in synchronous mode also update temp2world:
+    //   root procs update their value if swap took place
+    //   allgather across root procs
+    //   bcast within my world
 
     if (swap) my_set_temp = partner_set_temp;
+    if (swaplog) write_swaplog(partner_set_temp,old_set_temp,my_set_temp,energy);
+    if (asyncflag) continue;
+
     if (me == 0) {
       MPI_Allgather(&my_set_temp,1,MPI_INT,world2temp,1,MPI_INT,roots);
       for (i = 0; i < nworlds; i++) temp2world[world2temp[i]] = i;
@@ -325,6 +407,25 @@ void Temper::command(int narg, char **arg)
     if (me_universe == 0) print_status();
   }
 
+  // asynchronous mode: complete pending messages and
+  //   assemble final assignment of set temps for status output
+
+  if (asyncflag) {
+    if (timeout_request != MPI_REQUEST_NULL) MPI_Wait(&timeout_request,MPI_STATUS_IGNORE);
+    if (me == 0) {
+      update_neighbors();
+      MPI_Allgather(&my_set_temp,1,MPI_INT,world2temp,1,MPI_INT,roots);
+      for (i = 0; i < nworlds; i++) temp2world[world2temp[i]] = i;
+    }
+    MPI_Bcast(temp2world,nworlds,MPI_INT,0,world);
+    if (me_universe == 0) print_status();
+  }
+
+  if (swaplog) {
+    fclose(swaplog);
+    swaplog = nullptr;
+  }
+
   timer->barrier_stop();
 
   update->integrate->cleanup();
@@ -337,6 +438,199 @@ void Temper::command(int narg, char **arg)
   update->beginstep = update->endstep = 0;
 }
 
+/* ----------------------------------------------------------------------
+   fix style must be appropriate for temperature control, i.e. it needs
+   to provide a working Fix::reset_target() and must not change the volume.
+------------------------------------------------------------------------- */
+
+void Temper::check_fix()
+{
+  if ((!utils::strmatch(whichfix->style,"^nvt")) &&
+      (!utils::strmatch(whichfix->style,"^langevin")) &&
+      (!utils::strmatch(whichfix->style,"^gl[de]$")) &&
+      (!utils::strmatch(whichfix->style,"^rigid/nvt")) &&
+      (!utils::strmatch(whichfix->style,"^temp/")))
+    error->universe_all(FLERR,"Tempering temperature fix is not supported");
+}
+
+/* ----------------------------------------------------------------------
+   energy entering the Metropolis criterion, potential energy for NVT
+------------------------------------------------------------------------- */
+
+double Temper::exchange_energy(double pe)
+{
+  return pe;
+}
+
+/* ----------------------------------------------------------------------
+   attempt swap with root proc partner of world simulating partner_set_temp
+   hi proc sends energy to low proc
+   lo proc make Boltzmann decision on whether to swap
+   lo proc communicates decision back to hi proc
+------------------------------------------------------------------------- */
+
+int Temper::swap_partner(int partner, int partner_set_temp, double energy)
+{
+  int swap = 0;
+  double energy_partner,boltz_factor;
+
+  if (me_universe > partner)
+    MPI_Send(&energy,1,MPI_DOUBLE,partner,PAIRTAG,universe->uworld);
+  else
+    MPI_Recv(&energy_partner,1,MPI_DOUBLE,partner,PAIRTAG,universe->uworld,MPI_STATUS_IGNORE);
+
+  if (me_universe < partner) {
+    boltz_factor = (energy - energy_partner) *
+      (1.0/(boltz*set_temp[my_set_temp]) -
+       1.0/(boltz*set_temp[partner_set_temp]));
+    if (boltz_factor >= 0.0) swap = 1;
+    else if (ranboltz->uniform() < exp(boltz_factor)) swap = 1;
+  }
+
+  if (me_universe < partner)
+    MPI_Send(&swap,1,MPI_INT,partner,PAIRTAG,universe->uworld);
+  else
+    MPI_Recv(&swap,1,MPI_INT,partner,PAIRTAG,universe->uworld,MPI_STATUS_IGNORE);
+
+#if TEMPER_DEBUG
+  if (me_universe < partner)
+    fprintf(universe->uscreen,"SWAP %d & %d: yes = %d,Ts = %d %d, Es = %g %g, Bz = %g %g\n",
+            me_universe,partner,swap,my_set_temp,partner_set_temp,
+            energy,energy_partner,boltz_factor,exp(boltz_factor));
+#endif
+
+  return swap;
+}
+
+/* ----------------------------------------------------------------------
+   asynchronous exchange, only root procs participate
+   partner world is taken from the adjacent set temps, so no global
+     communication is needed. afterwards the world simulating the set temp
+     on the other side (outer neighbor) is told which world now simulates
+     my old set temp. those messages complete during the next nevery steps.
+------------------------------------------------------------------------- */
+
+int Temper::exchange_async(int partner_set_temp, double energy)
+{
+  if (me != 0) return 0;
+
+  // complete neighbor information from previous exchange
+
+  update_neighbors();
+
+  int swap = 0;
+  int side = -1;
+  int partner = -1;
+  if (partner_set_temp >= 0 && partner_set_temp < nworlds) {
+    side = (partner_set_temp > my_set_temp) ? 1 : 0;
+    partner = neighbor[side];
+    swap = swap_partner(world2root[partner],partner_set_temp,energy);
+  }
+
+  // the outer neighbor is paired with some other world or idle,
+  //   and it is my outer neighbor that is in turn its own outer neighbor
+
+  int outer_set_temp = 2*my_set_temp - partner_set_temp;
+  outer_side = -1;
+  if (outer_set_temp >= 0 && outer_set_temp < nworlds) {
+    outer_side = (outer_set_temp > my_set_temp) ? 1 : 0;
+    const int outer_root = world2root[neighbor[outer_side]];
+    outer_sendbuf = swap ? partner : iworld;
+    MPI_Irecv(&outer_recvbuf,1,MPI_INT,outer_root,OUTERTAG,universe->uworld,&outer_request[0]);
+    MPI_Isend(&outer_sendbuf,1,MPI_INT,outer_root,OUTERTAG,universe->uworld,&outer_request[1]);
+  }
+
+  last_side = side;
+  last_partner = partner;
+  last_swap = swap;
+  return swap;
+}
+
+/* ----------------------------------------------------------------------
+   complete neighbor information from previous asynchronous exchange
+   if the swap was accepted, the outer neighbor of my old set temp is
+     relayed to the partner, which now simulates it, and vice versa
+------------------------------------------------------------------------- */
+
+void Temper::update_neighbors()
+{
+  int outer = -1;
+  if (outer_side >= 0) {
+    MPI_Waitall(2,outer_request,MPI_STATUS_IGNORE);
+    outer = outer_recvbuf;
+  }
+
+  if (last_swap) {
+    int relay;
+    MPI_Sendrecv(&outer,1,MPI_INT,world2root[last_partner],RELAYTAG,
+                 &relay,1,MPI_INT,world2root[last_partner],RELAYTAG,
+                 universe->uworld,MPI_STATUS_IGNORE);
+    neighbor[last_side] = relay;
+    neighbor[1-last_side] = last_partner;
+  } else if (outer_side >= 0) neighbor[outer_side] = outer;
+
+  outer_side = last_partner = -1;
+  last_swap = 0;
+}
+
+/* ----------------------------------------------------------------------
+   Gibbs sampling: attempt nattempt swaps between random pairs of set temps
+     using the exchange energies of all worlds, done by first root proc
+   new assignment of set temps is bcast to all procs
+------------------------------------------------------------------------- */
+
+void Temper::exchange_gibbs(double energy)
+{
+  int old_set_temp = my_set_temp;
+
+  if (me == 0) {
+    int iroot;
+    MPI_Comm_rank(roots,&iroot);
+    MPI_Gather(&energy,1,MPI_DOUBLE,world_energy,1,MPI_DOUBLE,0,roots);
+
+    if (iroot == 0) {
+      for (int n = 0; n < nattempt; n++) {
+        int i = static_cast<int>(ranboltz->uniform()*nworlds);
+        int j = static_cast<int>(ranboltz->uniform()*(nworlds-1));
+        if (j >= i) j++;
+        const int wi = temp2world[i];
+        const int wj = temp2world[j];
+        double boltz_factor = (world_energy[wi] - world_energy[wj]) *
+          (1.0/(boltz*set_temp[i]) - 1.0/(boltz*set_temp[j]));
+        if ((boltz_factor >= 0.0) || (ranboltz->uniform() < exp(boltz_factor))) {
+          temp2world[i] = wj;
+          temp2world[j] = wi;
+        }
+      }
+    }
+    MPI_Bcast(temp2world,nworlds,MPI_INT,0,roots);
+  }
+  MPI_Bcast(temp2world,nworlds,MPI_INT,0,world);
+
+  for (int i = 0; i < nworlds; i++) world2temp[temp2world[i]] = i;
+  my_set_temp = world2temp[iworld];
+
+  if (my_set_temp != old_set_temp) {
+    scale_velocities(my_set_temp,old_set_temp);
+    whichfix->reset_target(set_temp[my_set_temp]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   append one record to binary swap log:
+   timestep, partner set temp (-1 for none or Gibbs sampling),
+   set temp before and after exchange, exchange energy
+------------------------------------------------------------------------- */
+
+void Temper::write_swaplog(int partner_set_temp, int old_set_temp, int new_set_temp, double energy)
+{
+  const bigint step = update->ntimestep;
+  const int buf[3] = {partner_set_temp, old_set_temp, new_set_temp};
+  fwrite(&step,sizeof(bigint),1,swaplog);
+  fwrite(buf,sizeof(int),3,swaplog);
+  fwrite(&energy,sizeof(double),1,swaplog);
+}
+
 /* ----------------------------------------------------------------------
    scale kinetic energy via velocities a la Sugita
 ------------------------------------------------------------------------- */
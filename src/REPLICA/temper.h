@@ -30,7 +30,8 @@ class Temper : public Command {
   ~Temper() override;
   void command(int, char **) override;
 
- private:
+ protected:
+  std::string mycmd;                    // name of command for messages
   int me, me_universe;                  // my proc ID in world and universe
   int iworld, nworlds;                  // world info
   double boltz;                         // copy from output->boltz
@@ -42,12 +43,36 @@ class Temper : public Command {
   int seed_boltz;                       // seed for Boltz factor comparison
   class Fix *whichfix;                  // temperature fix to use
 
+  int asyncflag;       // 1 = exchange only with neighbor replicas, no global sync
+  int nattempt;        // > 0 = # of Gibbs sampling swap attempts per exchange
+  FILE *swaplog;       // binary log of swap attempts, root proc of each world
+
   int my_set_temp;     // which set temp I am simulating
   double *set_temp;    // static list of replica set temperatures
   int *temp2world;     // temp2world[i] = world simulating set temp i
   int *world2temp;     // world2temp[i] = temp simulated by world i
   int *world2root;     // world2root[i] = root proc of world i
+  double *world_energy;    // exchange energy of each world for Gibbs sampling
+
+  // asynchronous mode, only on root procs
+  // neighbor[0/1] = world simulating set temp one below/above mine
+
+  int neighbor[2];
+  int outer_sendbuf, outer_recvbuf;    // buffers for notification of outer neighbor
+  int outer_side;                      // side of outer neighbor in last exchange, -1 if none
+  int last_side;                       // side of partner in last exchange
+  int last_partner;                    // world of last exchange partner, -1 if none
+  int last_swap;                       // 1 if last exchange was accepted
+  MPI_Request outer_request[2];
+
+  virtual void check_fix();
+  virtual double exchange_energy(double);
 
+  int swap_partner(int, int, double);
+  int exchange_async(int, double);
+  void exchange_gibbs(double);
+  void update_neighbors();
+  void write_swaplog(int, int, int, double);
   void scale_velocities(int, int);
   void print_status();
 };
@@ -177,8 +177,8 @@ void FixEHEX::init()
     int cnt_shake = 0;
     int id_shake;
     for (int i = 0; i < modify->nfix; i++) {
-      if (strcmp("rattle", modify->fix[i]->style) == 0 ||
-          strcmp("shake", modify->fix[i]->style) == 0) {
+      if (utils::strmatch(modify->fix[i]->style, "^rattle") ||
+          utils::strmatch(modify->fix[i]->style, "^shake")) {
         cnt_shake++;
         id_shake = i;
       }
@@ -26,6 +26,7 @@
 #include "force.h"
 #include "group.h"
 #include "math_const.h"
+#include "math_extra.h"
 #include "memory.h"
 #include "modify.h"
 #include "molecule.h"
@@ -151,7 +152,8 @@ FixShake::FixShake(LAMMPS *lmp, int narg, char **arg) :
 
     // break if known optional keyword
 
-    } else if ((strcmp(arg[next], "mol") == 0) || (strcmp(arg[next], "kbond") == 0)) {
+    } else if ((strcmp(arg[next], "mol") == 0) || (strcmp(arg[next], "kbond") == 0) ||
+               (strcmp(arg[next], "settle") == 0)) {
       break;
 
     // get numeric types for b, a, t, or m keywords.
@@ -195,6 +197,7 @@ FixShake::FixShake(LAMMPS *lmp, int narg, char **arg) :
 
   onemols = nullptr;
   kbond = 1.0e6*force->boltz;
+  settle_flag = 0;
 
   int iarg = next;
   while (iarg < narg) {
@@ -213,6 +216,10 @@ FixShake::FixShake(LAMMPS *lmp, int narg, char **arg) :
       kbond = utils::numeric(FLERR, arg[iarg+1], false, lmp);
       if (kbond < 0) error->all(FLERR,"Illegal {} kbond value {}. Must be >= 0.0", mystyle, kbond);
       iarg += 2;
+    } else if (strcmp(arg[iarg],"settle") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR,mystyle+" settle",error);
+      settle_flag = utils::logical(FLERR, arg[iarg+1], false, lmp);
+      iarg += 2;
     } else error->all(FLERR,"Unknown {} command option: {}", mystyle, arg[iarg]);
   }
 
@@ -677,6 +684,7 @@ void FixShake::post_force(int vflag)
     if (shake_flag[m] == 2) shake(i);
     else if (shake_flag[m] == 3) shake3(i);
     else if (shake_flag[m] == 4) shake4(i);
+    else if (settle_flag) settle(i);
     else shake3angle(i);
   }
 
@@ -725,6 +733,7 @@ void FixShake::post_force_respa(int vflag, int ilevel, int iloop)
     if (shake_flag[m] == 2) shake(i);
     else if (shake_flag[m] == 3) shake3(i);
     else if (shake_flag[m] == 4) shake4(i);
+    else if (settle_flag) settle(i);
     else shake3angle(i);
   }
 
@@ -1900,7 +1909,7 @@ void FixShake::shake(int ilist)
     double fpairlist[] = {lamda};
     double dellist[][3]  = {{r01[0], r01[1], r01[2]}};
     int pairlist[][2] = {{i0,i1}};
-    v_tally(count,atomlist,2.0,v,nlocal,1,pairlist,fpairlist,dellist);
+    shake_v_tally(count,atomlist,2.0,v,1,pairlist,fpairlist,dellist);
   }
 }
 
@@ -2074,7 +2083,7 @@ void FixShake::shake3(int ilist)
     double dellist[][3]  = {{r01[0], r01[1], r01[2]},
                             {r02[0], r02[1], r02[2]}};
     int pairlist[][2] = {{i0,i1}, {i0,i2}};
-    v_tally(count,atomlist,3.0,v,nlocal,2,pairlist,fpairlist,dellist);
+    shake_v_tally(count,atomlist,3.0,v,2,pairlist,fpairlist,dellist);
   }
 }
 
@@ -2326,7 +2335,7 @@ void FixShake::shake4(int ilist)
                             {r02[0], r02[1], r02[2]},
                             {r03[0], r03[1], r03[2]}};
     int pairlist[][2] = {{i0,i1}, {i0,i2}, {i0,i3}};
-    v_tally(count,atomlist,4.0,v,nlocal,3,pairlist,fpairlist,dellist);
+    shake_v_tally(count,atomlist,4.0,v,3,pairlist,fpairlist,dellist);
   }
 }
 
@@ -2569,10 +2578,230 @@ void FixShake::shake3angle(int ilist)
                             {r02[0], r02[1], r02[2]},
                             {r12[0], r12[1], r12[2]}};
     int pairlist[][2] = {{i0,i1}, {i0,i2}, {i1,i2}};
-    v_tally(count,atomlist,3.0,v,nlocal,3,pairlist,fpairlist,dellist);
+    shake_v_tally(count,atomlist,3.0,v,3,pairlist,fpairlist,dellist);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   calculate constraint forces for size 3 angle cluster with the
+   analytic SETTLE algorithm (Miyamoto and Kollman, J Comp Chem, 13, 952 (1992))
+   requires both bonds to have the same length and both outer atoms
+   to have the same mass, else falls back to iterative shake3angle()
+   the constrained positions are converted back to SHAKE multipliers
+------------------------------------------------------------------------- */
+
+void FixShake::settle(int ilist)
+{
+  int atomlist[3];
+  double v[6];
+  double mass0,mass1,mass2;
+
+  // local atom IDs and constraint distances
+
+  int m = list[ilist];
+  int i0 = closest_list[ilist][0];
+  int i1 = closest_list[ilist][1];
+  int i2 = closest_list[ilist][2];
+  double bond1 = bond_distance[shake_type[m][0]];
+  double bond2 = bond_distance[shake_type[m][1]];
+  double bond12 = angle_distance[shake_type[m][2]];
+
+  if (rmass) {
+    mass0 = rmass[i0];
+    mass1 = rmass[i1];
+    mass2 = rmass[i2];
+  } else {
+    mass0 = mass[type[i0]];
+    mass1 = mass[type[i1]];
+    mass2 = mass[type[i2]];
+  }
+
+  if ((bond1 != bond2) || (mass1 != mass2) || (bond12 >= 2.0*bond1)) {
+    shake3angle(ilist);
+    return;
+  }
+
+  // canonical triangle: ra = distance of central atom from center of mass,
+  // rb = distance of outer atoms from center of mass along symmetry axis,
+  // rc = half distance between outer atoms
+
+  double masstotal = mass0 + mass1 + mass2;
+  double rc = 0.5*bond12;
+  double height = sqrt(bond1*bond1 - rc*rc);
+  double ra = 2.0*mass1*height / masstotal;
+  double rb = height - ra;
+
+  // r01,r02,r12 = distance vec between atoms
+
+  double r01[3],r02[3],r12[3];
+  MathExtra::sub3(x[i0],x[i1],r01);
+  MathExtra::sub3(x[i0],x[i2],r02);
+  MathExtra::sub3(x[i1],x[i2],r12);
+
+  // b0,c0 = old positions of outer atoms relative to central atom
+  // a1,b1,c1 = unconstrained positions relative to their center of mass
+
+  double b0[3],c0[3],a1[3],b1[3],c1[3],xcm[3];
+  MathExtra::sub3(x[i1],x[i0],b0);
+  MathExtra::sub3(x[i2],x[i0],c0);
+  for (int k = 0; k < 3; k++) {
+    xcm[k] = (mass0*xshake[i0][k] + mass1*xshake[i1][k] + mass2*xshake[i2][k]) / masstotal;
+    a1[k] = xshake[i0][k] - xcm[k];
+    b1[k] = xshake[i1][k] - xcm[k];
+    c1[k] = xshake[i2][k] - xcm[k];
+  }
+
+  // orthonormal frame: Z normal to old plane, X perpendicular to Z and a1
+
+  double ex[3],ey[3],ez[3];
+  MathExtra::cross3(b0,c0,ez);
+  MathExtra::cross3(a1,ez,ex);
+  MathExtra::cross3(ez,ex,ey);
+  double lenx = MathExtra::len3(ex);
+  double leny = MathExtra::len3(ey);
+  double lenz = MathExtra::len3(ez);
+  if (lenx == 0.0 || leny == 0.0 || lenz == 0.0) {
+    shake3angle(ilist);
+    return;
+  }
+  MathExtra::scale3(1.0/lenx,ex);
+  MathExtra::scale3(1.0/leny,ey);
+  MathExtra::scale3(1.0/lenz,ez);
+
+  double xb0 = MathExtra::dot3(ex,b0);
+  double yb0 = MathExtra::dot3(ey,b0);
+  double xc0 = MathExtra::dot3(ex,c0);
+  double yc0 = MathExtra::dot3(ey,c0);
+  double za1 = MathExtra::dot3(ez,a1);
+  double xb1 = MathExtra::dot3(ex,b1);
+  double yb1 = MathExtra::dot3(ey,b1);
+  double zb1 = MathExtra::dot3(ez,b1);
+  double xc1 = MathExtra::dot3(ex,c1);
+  double yc1 = MathExtra::dot3(ey,c1);
+  double zc1 = MathExtra::dot3(ez,c1);
+
+  // out-of-plane tilt (phi, psi) and in-plane rotation (theta) of the triangle
+
+  double sinphi = za1 / ra;
+  double cosphisq = 1.0 - sinphi*sinphi;
+  if (cosphisq <= 0.0) {
+    shake3angle(ilist);
+    return;
+  }
+  double cosphi = sqrt(cosphisq);
+  double sinpsi = (zb1 - zc1) / (2.0*rc*cosphi);
+  double cospsisq = 1.0 - sinpsi*sinpsi;
+  if (cospsisq <= 0.0) {
+    shake3angle(ilist);
+    return;
+  }
+  double cospsi = sqrt(cospsisq);
+
+  double ya2 = ra*cosphi;
+  double xb2 = -rc*cospsi;
+  double yb2 = -rb*cosphi - rc*sinpsi*sinphi;
+  double yc2 = -rb*cosphi + rc*sinpsi*sinphi;
+
+  double alpha = xb2*(xb0 - xc0) + yb0*yb2 + yc0*yc2;
+  double beta = xb2*(yc0 - yb0) + xb0*yb2 + xc0*yc2;
+  double gamma = xb0*yb1 - xb1*yb0 + xc0*yc1 - xc1*yc0;
+  double alpha2beta2 = alpha*alpha + beta*beta;
+  double rootsq = alpha2beta2 - gamma*gamma;
+  if (alpha2beta2 == 0.0 || rootsq < 0.0) {
+    shake3angle(ilist);
+    return;
+  }
+  double sintheta = (alpha*gamma - beta*sqrt(rootsq)) / alpha2beta2;
+  double costheta = sqrt(1.0 - sintheta*sintheta);
+
+  // constrained positions in the frame and mass weighted displacements in the lab frame
+  // the third displacement follows from momentum conservation and is not needed
+
+  double a3[3] = {-ya2*sintheta, ya2*costheta, za1};
+  double b3[3] = {xb2*costheta - yb2*sintheta, xb2*sintheta + yb2*costheta, zb1};
+
+  double d0[3],d1[3];
+  for (int k = 0; k < 3; k++) {
+    d0[k] = mass0*(ex[k]*a3[0] + ey[k]*a3[1] + ez[k]*a3[2] - a1[k]);
+    d1[k] = mass1*(ex[k]*b3[0] + ey[k]*b3[1] + ez[k]*b3[2] - b1[k]);
+  }
+
+  // SHAKE multipliers of the displacements:
+  // mass0*d0 = lamda01*r01 + lamda02*r02, mass1*d1 = -lamda01*r01 + lamda12*r12
+
+  double r01sq = MathExtra::lensq3(r01);
+  double r02sq = MathExtra::lensq3(r02);
+  double r12sq = MathExtra::lensq3(r12);
+  double r0102 = MathExtra::dot3(r01,r02);
+  double determ = r01sq*r02sq - r0102*r0102;
+  if (determ == 0.0 || r12sq == 0.0) {
+    shake3angle(ilist);
+    return;
+  }
+  double d0r01 = MathExtra::dot3(d0,r01);
+  double d0r02 = MathExtra::dot3(d0,r02);
+  double lamda01 = (d0r01*r02sq - d0r02*r0102) / determ;
+  double lamda02 = (d0r02*r01sq - d0r01*r0102) / determ;
+  double lamda12 = (MathExtra::dot3(d1,r12) + lamda01*MathExtra::dot3(r01,r12)) / r12sq;
+
+  // update forces if atom is owned by this processor
+
+  lamda01 = lamda01/dtfsq;
+  lamda02 = lamda02/dtfsq;
+  lamda12 = lamda12/dtfsq;
+
+  if (i0 < nlocal) {
+    f[i0][0] += lamda01*r01[0] + lamda02*r02[0];
+    f[i0][1] += lamda01*r01[1] + lamda02*r02[1];
+    f[i0][2] += lamda01*r01[2] + lamda02*r02[2];
+  }
+
+  if (i1 < nlocal) {
+    f[i1][0] -= lamda01*r01[0] - lamda12*r12[0];
+    f[i1][1] -= lamda01*r01[1] - lamda12*r12[1];
+    f[i1][2] -= lamda01*r01[2] - lamda12*r12[2];
+  }
+
+  if (i2 < nlocal) {
+    f[i2][0] -= lamda02*r02[0] + lamda12*r12[0];
+    f[i2][1] -= lamda02*r02[1] + lamda12*r12[1];
+    f[i2][2] -= lamda02*r02[2] + lamda12*r12[2];
+  }
+
+  if (evflag) {
+    int count = 0;
+    if (i0 < nlocal) atomlist[count++] = i0;
+    if (i1 < nlocal) atomlist[count++] = i1;
+    if (i2 < nlocal) atomlist[count++] = i2;
+
+    v[0] = lamda01*r01[0]*r01[0]+lamda02*r02[0]*r02[0]+lamda12*r12[0]*r12[0];
+    v[1] = lamda01*r01[1]*r01[1]+lamda02*r02[1]*r02[1]+lamda12*r12[1]*r12[1];
+    v[2] = lamda01*r01[2]*r01[2]+lamda02*r02[2]*r02[2]+lamda12*r12[2]*r12[2];
+    v[3] = lamda01*r01[0]*r01[1]+lamda02*r02[0]*r02[1]+lamda12*r12[0]*r12[1];
+    v[4] = lamda01*r01[0]*r01[2]+lamda02*r02[0]*r02[2]+lamda12*r12[0]*r12[2];
+    v[5] = lamda01*r01[1]*r01[2]+lamda02*r02[1]*r02[2]+lamda12*r12[1]*r12[2];
+
+    double fpairlist[] = {lamda01, lamda02, lamda12};
+    double dellist[][3]  = {{r01[0], r01[1], r01[2]},
+                            {r02[0], r02[1], r02[2]},
+                            {r12[0], r12[1], r12[2]}};
+    int pairlist[][2] = {{i0,i1}, {i0,i2}, {i1,i2}};
+    shake_v_tally(count,atomlist,3.0,v,3,pairlist,fpairlist,dellist);
   }
 }
 
+/* ----------------------------------------------------------------------
+   tally virial of one cluster, hook for derived classes that
+   accumulate the constraint virial in private buffers
+------------------------------------------------------------------------- */
+
+void FixShake::shake_v_tally(int n, int *atomlist, double total, double *v,
+                             int npair, int pairlist[][2], double *fpairlist,
+                             double dellist[][3])
+{
+  v_tally(n,atomlist,total,v,nlocal,npair,pairlist,fpairlist,dellist);
+}
+
 /* ----------------------------------------------------------------------
    apply bond force for minimization between atom indices i1 and i2
 ------------------------------------------------------------------------- */
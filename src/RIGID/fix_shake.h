@@ -83,6 +83,7 @@ class FixShake : public Fix {
   int molecular;                             // copy of atom->molecular
   double *bond_distance, *angle_distance;    // constraint distances
   double kbond;                              // force constant for restraint
+  int settle_flag;                           // 1 = use SETTLE for angle clusters
   double ebond;                              // energy of bond restraints
 
   class FixRespa *fix_respa;    // rRESPA fix needed by SHAKE
@@ -141,6 +142,8 @@ class FixShake : public Fix {
   void shake3(int);
   void shake4(int);
   void shake3angle(int);
+  void settle(int);
+  virtual void shake_v_tally(int, int *, double, double *, int, int[][2], double *, double[][3]);
   void bond_force(int, int, double);
   virtual void stats();
   int bondtype_findset(int, tagint, tagint, int);
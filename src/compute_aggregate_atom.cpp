@@ -28,17 +28,17 @@
 #include "neigh_list.h"
 #include "neighbor.h"
 #include "pair.h"
+#include "union_find.h"
 #include "update.h"
 
 #include <cmath>
 
 using namespace LAMMPS_NS;
 
-static constexpr int MAXLOOP = 100;
 /* ---------------------------------------------------------------------- */
 
 ComputeAggregateAtom::ComputeAggregateAtom(LAMMPS *lmp, int narg, char **arg) :
-    Compute(lmp, narg, arg), aggregateID(nullptr)
+    Compute(lmp, narg, arg), aggregateID(nullptr), uf(nullptr)
 {
   if (narg != 4) error->all(FLERR, "Illegal compute aggregate/atom command");
 
@@ -54,6 +54,7 @@ ComputeAggregateAtom::ComputeAggregateAtom(LAMMPS *lmp, int narg, char **arg) :
   comm_reverse = 1;
 
   nmax = 0;
+  uf = new UnionFind(lmp);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -61,6 +62,7 @@ ComputeAggregateAtom::ComputeAggregateAtom(LAMMPS *lmp, int narg, char **arg) :
 ComputeAggregateAtom::~ComputeAggregateAtom()
 {
   memory->destroy(aggregateID);
+  delete uf;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -121,10 +123,7 @@ void ComputeAggregateAtom::compute_peratom()
 
   // if group is dynamic, ensure ghost atom masks are current
 
-  if (group->dynamic[igroup]) {
-    commflag = 0;
-    comm->forward_comm(this);
-  }
+  if (group->dynamic[igroup]) comm->forward_comm(this);
 
   // each atom starts in its own aggregate,
 
@@ -140,90 +139,54 @@ void ComputeAggregateAtom::compute_peratom()
   int **firstneigh = list->firstneigh;
   double **x = atom->x;
 
-  for (i = 0; i < nlocal + atom->nghost; i++)
+  for (i = 0; i < nlocal; i++)
     if (mask[i] & groupbit)
       aggregateID[i] = tag[i];
     else
       aggregateID[i] = 0;
 
-  // loop until no more changes on any proc:
-  // acquire aggregateIDs of ghost atoms
-  // loop over my atoms, and check atoms bound to it
-  // if both atoms are in aggregate, assign lowest aggregateID to both
+  // loop over my atoms, and join the aggregates of atoms bound to it
   // then loop over my atoms, checking distance to neighbors
-  // if both atoms are in cluster, assign lowest clusterID to both
-  // iterate until no changes in my atoms
-  // then check if any proc made changes
-
-  commflag = 1;
-
-  int change, done, anychange;
-
-  int counter = 0;
-  // stop after MAXLOOP iterations
-  while (counter < MAXLOOP) {
-    comm->forward_comm(this);
-    ++counter;
-
-    // reverse communication when bonds are not stored on every processor
-
-    if (force->newton_bond) comm->reverse_comm(this);
-
-    change = 0;
-    while (true) {
-      done = 1;
-      for (i = 0; i < nlocal; i++) {
-        if (!(mask[i] & groupbit)) continue;
-
-        for (j = 0; j < num_bond[i]; j++) {
-          if (bond_type[i][j] == 0) continue;
-          k = atom->map(bond_atom[i][j]);
-          if (k < 0) continue;
-          if (!(mask[k] & groupbit)) continue;
-          if (aggregateID[i] == aggregateID[k]) continue;
-
-          aggregateID[i] = aggregateID[k] = MIN(aggregateID[i], aggregateID[k]);
-          done = 0;
-        }
-      }
-
-      for (int ii = 0; ii < inum; ii++) {
-        i = ilist[ii];
-        if (!(mask[i] & groupbit)) continue;
-
-        const double xtmp = x[i][0];
-        const double ytmp = x[i][1];
-        const double ztmp = x[i][2];
-        int *jlist = firstneigh[i];
-        const int jnum = numneigh[i];
-
-        for (int jj = 0; jj < jnum; jj++) {
-          j = jlist[jj];
-          j &= NEIGHMASK;
-          if (!(mask[j] & groupbit)) continue;
-          if (aggregateID[i] == aggregateID[j]) continue;
-
-          const double delx = xtmp - x[j][0];
-          const double dely = ytmp - x[j][1];
-          const double delz = ztmp - x[j][2];
-          const double rsq = delx * delx + dely * dely + delz * delz;
-          if (rsq < cutsq) {
-            aggregateID[i] = aggregateID[j] = MIN(aggregateID[i], aggregateID[j]);
-            done = 0;
-          }
-        }
-      }
-      if (!done) change = 1;
-      if (done) break;
+  // if both atoms are in group, join their aggregates
+  // then merge aggregates across procs and assign lowest aggregateID to all atoms
+  // with newton_bond on, only one of the two procs may see a bond
+
+  uf->reset(aggregateID);
+  for (i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit)) continue;
+
+    for (j = 0; j < num_bond[i]; j++) {
+      if (bond_type[i][j] == 0) continue;
+      k = atom->map(bond_atom[i][j]);
+      if (k < 0) continue;
+      if (!(mask[k] & groupbit)) continue;
+      uf->join(i, k);
     }
+  }
 
-    // stop if all procs are done
-
-    MPI_Allreduce(&change, &anychange, 1, MPI_INT, MPI_MAX, world);
-    if (!anychange) break;
+  for (int ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    if (!(mask[i] & groupbit)) continue;
+
+    const double xtmp = x[i][0];
+    const double ytmp = x[i][1];
+    const double ztmp = x[i][2];
+    int *jlist = firstneigh[i];
+    const int jnum = numneigh[i];
+
+    for (int jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      j &= NEIGHMASK;
+      if (!(mask[j] & groupbit)) continue;
+
+      const double delx = xtmp - x[j][0];
+      const double dely = ytmp - x[j][1];
+      const double delz = ztmp - x[j][2];
+      const double rsq = delx * delx + dely * dely + delz * delz;
+      if (rsq < cutsq) uf->join(i, j);
+    }
   }
-  if ((comm->me == 0) && (counter >= MAXLOOP))
-    error->warning(FLERR, "Compute aggregate/atom did not converge after {} iterations", MAXLOOP);
+  uf->merge(force->newton_bond ? this : nullptr);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -233,18 +196,12 @@ int ComputeAggregateAtom::pack_forward_comm(int n, int *list, double *buf, int /
 {
   int i, j, m;
 
+  int *mask = atom->mask;
+
   m = 0;
-  if (commflag) {
-    for (i = 0; i < n; i++) {
-      j = list[i];
-      buf[m++] = aggregateID[j];
-    }
-  } else {
-    int *mask = atom->mask;
-    for (i = 0; i < n; i++) {
-      j = list[i];
-      buf[m++] = ubuf(mask[j]).d;
-    }
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    buf[m++] = ubuf(mask[j]).d;
   }
 
   return m;
@@ -256,49 +213,25 @@ void ComputeAggregateAtom::unpack_forward_comm(int n, int first, double *buf)
 {
   int i, m, last;
 
+  int *mask = atom->mask;
+
   m = 0;
   last = first + n;
-  if (commflag)
-    for (i = first; i < last; i++) {
-      double x = buf[m++];
-
-      // only overwrite ghost IDs with values lower than current ones
-
-      aggregateID[i] = MIN(x, aggregateID[i]);
-    }
-  else {
-    int *mask = atom->mask;
-    for (i = first; i < last; i++) mask[i] = (int) ubuf(buf[m++]).i;
-  }
+  for (i = first; i < last; i++) mask[i] = (int) ubuf(buf[m++]).i;
 }
 
 /* ---------------------------------------------------------------------- */
 
 int ComputeAggregateAtom::pack_reverse_comm(int n, int first, double *buf)
 {
-  int i, m, last;
-
-  m = 0;
-  last = first + n;
-  for (i = first; i < last; i++) { buf[m++] = aggregateID[i]; }
-  return m;
+  return uf->pack_reverse_comm(n, first, buf);
 }
 
 /* ---------------------------------------------------------------------- */
 
 void ComputeAggregateAtom::unpack_reverse_comm(int n, int *list, double *buf)
 {
-  int i, j, m;
-
-  m = 0;
-  for (i = 0; i < n; i++) {
-    j = list[i];
-    double x = buf[m++];
-
-    // only overwrite local IDs with values lower than current ones
-
-    aggregateID[j] = MIN(x, aggregateID[j]);
-  }
+  uf->unpack_reverse_comm(n, list, buf);
 }
 
 /* ----------------------------------------------------------------------
@@ -308,5 +241,6 @@ void ComputeAggregateAtom::unpack_reverse_comm(int n, int *list, double *buf)
 double ComputeAggregateAtom::memory_usage()
 {
   double bytes = (double) nmax * sizeof(double);
+  bytes += uf->memory_usage();
   return bytes;
 }
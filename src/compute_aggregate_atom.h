@@ -38,10 +38,11 @@ class ComputeAggregateAtom : public Compute {
   double memory_usage() override;
 
  private:
-  int nmax, commflag;
+  int nmax;
   double cutsq;
   class NeighList *list;
   double *aggregateID;
+  class UnionFind *uf;
 };
 
 }    // namespace LAMMPS_NS
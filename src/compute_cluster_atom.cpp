@@ -22,17 +22,17 @@
 #include "neigh_list.h"
 #include "neighbor.h"
 #include "pair.h"
+#include "union_find.h"
 #include "update.h"
 
 #include <cmath>
 
 using namespace LAMMPS_NS;
 
-static constexpr int MAXLOOP = 100;
 /* ---------------------------------------------------------------------- */
 
 ComputeClusterAtom::ComputeClusterAtom(LAMMPS *lmp, int narg, char **arg) :
-    Compute(lmp, narg, arg), clusterID(nullptr)
+    Compute(lmp, narg, arg), clusterID(nullptr), uf(nullptr)
 {
   if (narg != 4) error->all(FLERR, "Illegal compute cluster/atom command");
 
@@ -41,9 +41,9 @@ ComputeClusterAtom::ComputeClusterAtom(LAMMPS *lmp, int narg, char **arg) :
 
   peratom_flag = 1;
   size_peratom_cols = 0;
-  comm_forward = 1;
 
   nmax = 0;
+  uf = new UnionFind(lmp);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -51,6 +51,7 @@ ComputeClusterAtom::ComputeClusterAtom(LAMMPS *lmp, int narg, char **arg) :
 ComputeClusterAtom::~ComputeClusterAtom()
 {
   memory->destroy(clusterID);
+  delete uf;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -126,89 +127,36 @@ void ComputeClusterAtom::compute_peratom()
       clusterID[i] = 0;
   }
 
-  // loop until no more changes on any proc:
-  // acquire clusterIDs of ghost atoms
   // loop over my atoms, checking distance to neighbors
-  // if both atoms are in cluster, assign lowest clusterID to both
-  // iterate until no changes in my atoms
-  // then check if any proc made changes
+  // if both atoms are in group, join their clusters
+  // then merge clusters across procs and assign lowest clusterID to all atoms
 
   double **x = atom->x;
 
-  int change, done, anychange;
-
-  int counter = 0;
-  // stop after MAXLOOP iterations
-  while (counter < MAXLOOP) {
-    comm->forward_comm(this);
-    ++counter;
-    change = 0;
-    while (true) {
-      done = 1;
-      for (ii = 0; ii < inum; ii++) {
-        i = ilist[ii];
-        if (!(mask[i] & groupbit)) continue;
-
-        xtmp = x[i][0];
-        ytmp = x[i][1];
-        ztmp = x[i][2];
-        jlist = firstneigh[i];
-        jnum = numneigh[i];
-
-        for (jj = 0; jj < jnum; jj++) {
-          j = jlist[jj];
-          j &= NEIGHMASK;
-          if (!(mask[j] & groupbit)) continue;
-          if (clusterID[i] == clusterID[j]) continue;
-
-          delx = xtmp - x[j][0];
-          dely = ytmp - x[j][1];
-          delz = ztmp - x[j][2];
-          rsq = delx * delx + dely * dely + delz * delz;
-          if (rsq < cutsq) {
-            clusterID[i] = clusterID[j] = MIN(clusterID[i], clusterID[j]);
-            done = 0;
-          }
-        }
-      }
-      if (!done) change = 1;
-      if (done) break;
+  uf->reset(clusterID);
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    if (!(mask[i] & groupbit)) continue;
+
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      j &= NEIGHMASK;
+      if (!(mask[j] & groupbit)) continue;
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx * delx + dely * dely + delz * delz;
+      if (rsq < cutsq) uf->join(i, j);
     }
-
-    // stop if all procs are done
-
-    MPI_Allreduce(&change, &anychange, 1, MPI_INT, MPI_MAX, world);
-    if (!anychange) break;
-  }
-  if ((comm->me == 0) && (counter >= MAXLOOP))
-    error->warning(FLERR, "Compute cluster/atom did not converge after {} iterations", MAXLOOP);
-}
-
-/* ---------------------------------------------------------------------- */
-
-int ComputeClusterAtom::pack_forward_comm(int n, int *list, double *buf, int /*pbc_flag*/,
-                                          int * /*pbc*/)
-{
-  int i, j, m;
-
-  m = 0;
-  for (i = 0; i < n; i++) {
-    j = list[i];
-    buf[m++] = clusterID[j];
   }
-
-  return m;
-}
-
-/* ---------------------------------------------------------------------- */
-
-void ComputeClusterAtom::unpack_forward_comm(int n, int first, double *buf)
-{
-  int i, m, last;
-
-  m = 0;
-  last = first + n;
-  for (i = first; i < last; i++) clusterID[i] = buf[m++];
+  uf->merge();
 }
 
 /* ----------------------------------------------------------------------
@@ -218,5 +166,6 @@ void ComputeClusterAtom::unpack_forward_comm(int n, int first, double *buf)
 double ComputeClusterAtom::memory_usage()
 {
   double bytes = (double) nmax * sizeof(double);
+  bytes += uf->memory_usage();
   return bytes;
 }
@@ -31,8 +31,6 @@ class ComputeClusterAtom : public Compute {
   void init() override;
   void init_list(int, class NeighList *) override;
   void compute_peratom() override;
-  int pack_forward_comm(int, int *, double *, int, int *) override;
-  void unpack_forward_comm(int, int, double *) override;
   double memory_usage() override;
 
  private:
@@ -40,6 +38,7 @@ class ComputeClusterAtom : public Compute {
   double cutsq;
   class NeighList *list;
   double *clusterID;
+  class UnionFind *uf;
 };
 
 }    // namespace LAMMPS_NS
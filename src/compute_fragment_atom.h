@@ -35,9 +35,9 @@ class ComputeFragmentAtom : public Compute {
   double memory_usage() override;
 
  private:
-  int nmax, commflag, singleflag;
-  int *stack, *clist, *markflag;
+  int nmax, singleflag;
   double *fragmentID;
+  class UnionFind *uf;
 };
 
 }    // namespace LAMMPS_NS
@@ -44,6 +44,7 @@ KSpace::KSpace(LAMMPS *lmp) : Pointers(lmp)
     dipoleflag = spinflag = 0;
   compute_flag = 1;
   group_group_enable = 0;
+  potential_enable = 0;
   stagger_flag = 0;
 
   order = 5;
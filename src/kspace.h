@@ -116,6 +116,7 @@ class KSpace : protected Pointers {
   int nx_msm_max, ny_msm_max, nz_msm_max;
 
   int group_group_enable;    // 1 if style supports group/group calculation
+  int potential_enable;      // 1 if style supports compute_potential()
 
   int centroidstressflag;    // centroid stress compared to two-body stress
                              // CENTROID_SAME = same as two-body stress
@@ -161,6 +162,7 @@ class KSpace : protected Pointers {
   virtual void reset_grid() {};
   virtual void compute(int, int) = 0;
   virtual void compute_group_group(int, int, int) {};
+  virtual void compute_potential(double *, double *) {};
 
   virtual void pack_forward_grid(int, void *, int, int *) {};
   virtual void unpack_forward_grid(int, void *, int, int *) {};
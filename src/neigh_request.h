@@ -147,6 +147,7 @@ class NeighRequest : protected Pointers {
   void enable_intel();
 
   int get_size() const { return size; }
+  int get_full() const { return full; }
   void *get_requestor() const { return requestor; }
 };
 
@@ -28,6 +28,7 @@
 #include "math_const.h"
 #include "math_special.h"
 #include "memory.h"
+#include "neigh_list.h"
 #include "neighbor.h"
 #include "suffix.h"
 #include "update.h"
@@ -61,7 +62,7 @@ Pair::Pair(LAMMPS *lmp) :
     dfdisptable(nullptr), edisptable(nullptr), dedisptable(nullptr), pvector(nullptr),
     svector(nullptr), list(nullptr), listhalf(nullptr), listfull(nullptr),
     list_tally_compute(nullptr), elements(nullptr), elem1param(nullptr), elem2param(nullptr),
-    elem3param(nullptr), map(nullptr)
+    elem3param(nullptr), map(nullptr), elocal_flag(nullptr), elocal_list(nullptr)
 {
   instance_me = instance_total++;
 
@@ -71,7 +72,10 @@ Pair::Pair(LAMMPS *lmp) :
 
   single_enable = 1;
   born_matrix_enable = 0;
+  fused_enable = 0;
+  tabulate_enable = 0;
   single_hessian_enable = 0;
+  energy_local_enable = 0;
   restartinfo = 1;
   respa_enable = 0;
   one_coeff = 0;
@@ -103,11 +107,13 @@ Pair::Pair(LAMMPS *lmp) :
   tabinner = sqrt(2.0);
   tabinner_disp = sqrt(2.0);
   trim_flag = 1;
+  ntabulate = 0;
 
   allocated = 0;
   suffix_flag = Suffix::NONE;
 
   maxeatom = maxvatom = maxcvatom = 0;
+  elocal_nmax = 0;
 
   num_tally_compute = 0;
   did_tally_flag = 0;
@@ -145,6 +151,8 @@ Pair::~Pair()
   memory->destroy(eatom);
   memory->destroy(vatom);
   memory->destroy(cvatom);
+  memory->destroy(elocal_flag);
+  memory->destroy(elocal_list);
 }
 
 // clang-format off
@@ -192,6 +200,12 @@ void Pair::modify_params(int narg, char **arg)
       if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "pair_modify tabinner/disp", error);
       tabinner_disp = utils::numeric(FLERR,arg[iarg+1],false,lmp);
       iarg += 2;
+    } else if (strcmp(arg[iarg],"tabulate") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "pair_modify tabulate", error);
+      ntabulate = utils::inumeric(FLERR,arg[iarg+1],false,lmp);
+      if ((ntabulate < 0) || (ntabulate == 1))
+        error->all(FLERR,"Illegal pair_modify tabulate value: {}", ntabulate);
+      iarg += 2;
     } else if (strcmp(arg[iarg],"tail") == 0) {
       if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "pair_modify tail", error);
       tail_flag = utils::logical(FLERR,arg[iarg+1],false,lmp);
@@ -227,6 +241,8 @@ void Pair::init()
     error->warning(FLERR,"Using pair tail corrections with pair_modify compute no");
   if (!compute_flag && offset_flag && comm->me == 0)
     error->warning(FLERR,"Using pair potential shift with pair_modify compute no");
+  if (ntabulate && !tabulate_enable)
+    error->all(FLERR,"Pair style does not support pair_modify tabulate");
 
   // for manybody potentials
   // check if bonded exclusions could invalidate the neighbor list
@@ -297,6 +313,11 @@ void Pair::init()
                      mixed_count, num_mixed_pairs, mixing_rule_names[mix_flag]);
   }
 
+  // pairwise styles provide local energies through single()
+  // manybody styles must implement energy_atom() and set the flag themselves
+
+  if (!manybody_flag) energy_local_enable = (single_enable && !kokkosable) ? 1 : 0;
+
   // for monitoring, if Pair::ev_tally() was called.
   did_tally_flag = 0;
 }
@@ -1989,6 +2010,121 @@ void Pair::init_bitmap(double inner, double outer, int ntablebits,
   masklo = rsq_lookup.i & ~(nmask);
 }
 
+/* ----------------------------------------------------------------------
+   sum of per-atom energies of all owned atoms which are one of the
+     n listed (owned or ghost) atoms or have one of them as a neighbor
+   energy changes from modifying only the listed atoms (e.g. their type)
+     are the difference of two calls, summed over all procs
+   if ghostflag is set, affected ghost atoms are included as well and
+     every atom ID is counted once, preferring the owned copy,
+     so the energy change is complete on this proc
+   elist = full neighbor list with neighbors of ghost atoms
+------------------------------------------------------------------------- */
+
+double Pair::energy_local(NeighList *elist, int n, int *ilist, int ghostflag)
+{
+  const int nlocal = atom->nlocal;
+
+  if (atom->nmax > elocal_nmax) {
+    memory->destroy(elocal_flag);
+    memory->destroy(elocal_list);
+    elocal_nmax = atom->nmax;
+    memory->create(elocal_flag,elocal_nmax,"pair:elocal_flag");
+    memory->create(elocal_list,elocal_nmax,"pair:elocal_list");
+    for (int i = 0; i < elocal_nmax; i++) elocal_flag[i] = 0;
+  }
+
+  // only neighbors within the force cutoff can be affected
+  // with ghostflag, elocal_flag is set for the lowest index copy of an atom ID
+  //   which is the owned atom, if present
+
+  double **x = atom->x;
+  const tagint * const tag = atom->tag;
+  const double cutforcesq = cutforce*cutforce;
+  int nlist = 0;
+  for (int ii = 0; ii < n; ii++) {
+    const int i = ilist[ii];
+    if (ghostflag) {
+      const int m = atom->map(tag[i]);
+      if (!elocal_flag[m]) {
+        elocal_flag[m] = 1;
+        elocal_list[nlist++] = (m < nlocal) ? m : i;
+      }
+    } else if (i < nlocal) {
+      if (!elocal_flag[i]) {
+        elocal_flag[i] = 1;
+        elocal_list[nlist++] = i;
+      }
+    }
+    if ((i >= nlocal) && !elist->ghost)
+      error->one(FLERR,"Pair local energy requires ghost neighbors");
+
+    const int * const jlist = elist->firstneigh[i];
+    const int jnum = elist->numneigh[i];
+    for (int jj = 0; jj < jnum; jj++) {
+      const int j = jlist[jj] & NEIGHMASK;
+      const double delx = x[i][0] - x[j][0];
+      const double dely = x[i][1] - x[j][1];
+      const double delz = x[i][2] - x[j][2];
+      if (delx*delx + dely*dely + delz*delz >= cutforcesq) continue;
+      if (ghostflag) {
+        const int m = atom->map(tag[j]);
+        if (!elocal_flag[m]) {
+          elocal_flag[m] = 1;
+          elocal_list[nlist++] = (m < nlocal) ? m : j;
+        }
+      } else if ((j < nlocal) && !elocal_flag[j]) {
+        elocal_flag[j] = 1;
+        elocal_list[nlist++] = j;
+      }
+    }
+  }
+
+  double energy = 0.0;
+  for (int ii = 0; ii < nlist; ii++) {
+    const int i = elocal_list[ii];
+    energy += energy_atom(elist,i);
+    elocal_flag[(i < nlocal) ? i : atom->map(tag[i])] = 0;
+  }
+  return energy;
+}
+
+/* ----------------------------------------------------------------------
+   energy of atom I, half of each pairwise term from single()
+------------------------------------------------------------------------- */
+
+double Pair::energy_atom(NeighList *elist, int i)
+{
+  double delx,dely,delz,rsq,factor_lj,factor_coul,fforce;
+
+  double **x = atom->x;
+  int *type = atom->type;
+  double *special_lj = force->special_lj;
+  double *special_coul = force->special_coul;
+
+  const int itype = type[i];
+  const int * const jlist = elist->firstneigh[i];
+  const int jnum = elist->numneigh[i];
+  double energy = 0.0;
+
+  for (int jj = 0; jj < jnum; jj++) {
+    int j = jlist[jj];
+    factor_lj = special_lj[sbmask(j)];
+    factor_coul = special_coul[sbmask(j)];
+    j &= NEIGHMASK;
+
+    delx = x[i][0] - x[j][0];
+    dely = x[i][1] - x[j][1];
+    delz = x[i][2] - x[j][2];
+    rsq = delx*delx + dely*dely + delz*delz;
+
+    const int jtype = type[j];
+    if (rsq < cutsq[itype][jtype])
+      energy += 0.5*single(i,j,itype,jtype,rsq,factor_coul,factor_lj,fforce);
+  }
+  return energy;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void Pair::hessian_twobody(double fforce, double dfac, double delr[3], double phiTensor[6]) {
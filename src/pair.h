@@ -53,7 +53,10 @@ class Pair : protected Pointers {
 
   int single_enable;              // 1 if single() routine exists
   int born_matrix_enable;         // 1 if born_matrix() routine exists
+  int fused_enable;               // 1 if compute_pair() can replace compute()
+  int tabulate_enable;            // 1 if radial functions can be tabulated
   int single_hessian_enable;      // 1 if single_hessian() routine exists
+  int energy_local_enable;        // 1 if energy_atom() reproduces compute() energies
   int restartinfo;                // 1 if pair style writes restart info
   int respa_enable;               // 1 if inner/middle/outer rRESPA routines
   int one_coeff;                  // 1 if allows only one coeff * * call
@@ -83,6 +86,7 @@ class Pair : protected Pointers {
   double etail, ptail;    // energy/pressure tail corrections
   double etail_ij, ptail_ij;
   int trim_flag;    // pair_modify flag for trimming neigh list
+  int ntabulate;    // pair_modify # of points for radial function tables, 0 = off
 
   int evflag;    // energy,virial settings
   int eflag_either, eflag_global, eflag_atom;
@@ -163,6 +167,25 @@ class Pair : protected Pointers {
     return 0.0;
   }
 
+  // per-pair kernel used by pair hybrid for fused evaluation over a shared list
+  // must reproduce what compute() does for one I,J pair inside the cutoff
+  // returns van der Waals energy, sets F/r in fpair and Coulomb energy in ecoul
+
+  virtual double compute_pair(int i, int j, int itype, int jtype, double rsq, double factor_coul,
+                              double factor_lj, double &fpair, double &ecoul)
+  {
+    ecoul = 0.0;
+    return single(i, j, itype, jtype, rsq, factor_coul, factor_lj, fpair);
+  }
+
+  // energy of the owned atoms affected by a change of the listed atoms
+  //   or of all affected atoms with ghost atoms counted once per atom ID
+  // requires a full neighbor list that includes neighbors of ghost atoms
+  // energy_atom() must return a per-atom share that sums to the pair energy
+
+  double energy_local(class NeighList *, int, int *, int);
+  virtual double energy_atom(class NeighList *, int);
+
   void hessian_twobody(double fforce, double dfac, double delr[3], double phiTensor[6]);
 
   virtual double single_hessian(int, int, int, int, double, double[3], double, double,
@@ -278,6 +301,9 @@ class Pair : protected Pointers {
   int vflag_fdotr;
   int maxeatom, maxvatom, maxcvatom;
 
+  int *elocal_flag, *elocal_list;    // scratch for energy_local()
+  int elocal_nmax;
+
   int copymode;    // if set, do not deallocate during destruction
                    // required when classes are used as functors by Kokkos
 
@@ -17,9 +17,11 @@
 
 #include "atom.h"
 #include "comm.h"
+#include "compute.h"
 #include "error.h"
 #include "force.h"
 #include "memory.h"
+#include "neigh_list.h"
 #include "neigh_request.h"
 #include "neighbor.h"
 #include "pair.h"
@@ -28,6 +30,7 @@
 #include "update.h"
 
 #include <cstring>
+#include <vector>
 
 using namespace LAMMPS_NS;
 
@@ -35,10 +38,20 @@ using namespace LAMMPS_NS;
 
 PairHybrid::PairHybrid(LAMMPS *lmp) :
     Pair(lmp), styles(nullptr), cutmax_style(nullptr), keywords(nullptr), multiple(nullptr),
-    nmap(nullptr), map(nullptr), special_lj(nullptr), special_coul(nullptr), compute_tally(nullptr)
+    nmap(nullptr), map(nullptr), special_lj(nullptr), special_coul(nullptr), compute_tally(nullptr),
+    fused(nullptr)
 {
   nstyles = 0;
 
+  fused_flag = 0;
+  nfused = 0;
+  fused_lead = fused_host = -1;
+  fused_full = 0;
+
+  // pair_modify tabulate is checked for each sub-style in init_style()
+
+  tabulate_enable = 1;
+
   outerflag = 0;
   respaflag = 0;
 }
@@ -63,6 +76,7 @@ PairHybrid::~PairHybrid()
   delete[] special_lj;
   delete[] special_coul;
   delete[] compute_tally;
+  delete[] fused;
 
   delete[] svector;
 
@@ -85,6 +99,8 @@ PairHybrid::~PairHybrid()
     call sub-style with adjusted vflag to prevent it calling
       virial_fdotr_compute()
     hybrid calls virial_fdotr_compute() on final accumulated f
+  sub-styles selected for fused evaluation are skipped here and
+    computed together by compute_fused()
 ------------------------------------------------------------------------- */
 
 void PairHybrid::compute(int eflag, int vflag)
@@ -95,8 +111,10 @@ void PairHybrid::compute(int eflag, int vflag)
   //   incoming vflag = VIRIAL_FDOTR
   // if so, reset vflag as if global component were VIRIAL_PAIR
   // necessary since one or more sub-styles cannot compute virial as F dot r
+  // same for fused sub-styles on a full list, which only update owned atoms,
+  //   so F dot r would use the owned image of a pair across a periodic boundary
 
-  if (no_virial_fdotr_compute && (vflag & VIRIAL_FDOTR))
+  if ((no_virial_fdotr_compute || fused_full) && (vflag & VIRIAL_FDOTR))
     vflag = VIRIAL_PAIR | (vflag & ~VIRIAL_FDOTR);
 
   ev_init(eflag,vflag);
@@ -122,6 +140,8 @@ void PairHybrid::compute(int eflag, int vflag)
 
   for (m = 0; m < nstyles; m++) {
 
+    if (nfused && fused[m]) continue;
+
     set_special(m);
 
     if (!respaflag || (respaflag && respa->hybrid_compute[m])) {
@@ -190,9 +210,131 @@ void PairHybrid::compute(int eflag, int vflag)
 
   delete[] saved_special;
 
+  if (nfused) compute_fused();
+
   if (vflag_fdotr) virial_fdotr_compute();
 }
 
+/* ----------------------------------------------------------------------
+   evaluate all fused sub-styles in a single pass over their shared list
+   sub-styles provide the pair kernel via compute_pair()
+   hybrid does the force update and the tallying once per I,J pair
+   global energies are also accumulated per sub-style for compute pair
+------------------------------------------------------------------------- */
+
+void PairHybrid::compute_fused()
+{
+  int i,j,ii,jj,k,m,inum,jnum,itype,jtype,any;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq,factor_lj,factor_coul;
+  double evdwl,ecoul,fpair,eone,cone,fone,efactor;
+  int *ilist,*jlist,*numneigh,**firstneigh;
+
+  double **x = atom->x;
+  double **f = atom->f;
+  int *type = atom->type;
+  int nlocal = atom->nlocal;
+  int newton_pair = force->newton_pair;
+  double *fspecial_lj = force->special_lj;
+  double *fspecial_coul = force->special_coul;
+
+  for (m = 0; m < nstyles; m++)
+    if (fused[m]) styles[m]->eng_vdwl = styles[m]->eng_coul = 0.0;
+
+  NeighList *flist = styles[fused_lead]->list;
+  inum = flist->inum;
+  ilist = flist->ilist;
+  numneigh = flist->numneigh;
+  firstneigh = flist->firstneigh;
+
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    itype = type[i];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      factor_lj = fspecial_lj[sbmask(j)];
+      factor_coul = fspecial_coul[sbmask(j)];
+      j &= NEIGHMASK;
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      jtype = type[j];
+
+      // sum all fused sub-styles assigned to I,J within their cutoff
+
+      any = 0;
+      evdwl = ecoul = fpair = 0.0;
+      if (fused_full) efactor = 0.5;
+      else efactor = (newton_pair || j < nlocal) ? 1.0 : 0.5;
+
+      for (k = 0; k < nmap[itype][jtype]; k++) {
+        m = map[itype][jtype][k];
+        if (!fused[m] || rsq >= styles[m]->cutsq[itype][jtype]) continue;
+        eone = styles[m]->compute_pair(i,j,itype,jtype,rsq,factor_coul,factor_lj,fone,cone);
+        fpair += fone;
+        evdwl += eone;
+        ecoul += cone;
+        if (eflag_global) {
+          styles[m]->eng_vdwl += efactor*eone;
+          styles[m]->eng_coul += efactor*cone;
+        }
+        any = 1;
+      }
+      if (!any) continue;
+
+      // a full list has each pair twice, so only update atom I
+
+      f[i][0] += delx*fpair;
+      f[i][1] += dely*fpair;
+      f[i][2] += delz*fpair;
+
+      // tally computes get each pair once as from a half list with newton off
+
+      if (fused_full) {
+        if (evflag) ev_tally_full(i,evdwl,ecoul,fpair,delx,dely,delz);
+        if (num_tally_compute > 0 && (j >= nlocal || i < j)) {
+          did_tally_flag = 1;
+          for (k = 0; k < num_tally_compute; ++k)
+            list_tally_compute[k]->pair_tally_callback(i,j,nlocal,0,evdwl,ecoul,fpair,
+                                                       delx,dely,delz);
+        }
+      } else {
+        if (newton_pair || j < nlocal) {
+          f[j][0] -= delx*fpair;
+          f[j][1] -= dely*fpair;
+          f[j][2] -= delz*fpair;
+        }
+        if (evflag) ev_tally(i,j,nlocal,newton_pair,evdwl,ecoul,fpair,delx,dely,delz);
+      }
+
+      // centroid virial of a pair interaction is the same as its virial
+
+      if (cvflag_atom) {
+        double v[6];
+        v[0] = 0.5*delx*delx*fpair;
+        v[1] = 0.5*dely*dely*fpair;
+        v[2] = 0.5*delz*delz*fpair;
+        v[3] = 0.5*delx*dely*fpair;
+        v[4] = 0.5*delx*delz*fpair;
+        v[5] = 0.5*dely*delz*fpair;
+        for (k = 0; k < 6; k++) cvatom[i][k] += v[k];
+        for (k = 6; k < 9; k++) cvatom[i][k] += v[k-3];
+        if (!fused_full && (newton_pair || j < nlocal)) {
+          for (k = 0; k < 6; k++) cvatom[j][k] += v[k];
+          for (k = 6; k < 9; k++) cvatom[j][k] += v[k-3];
+        }
+      }
+    }
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 void PairHybrid::finish()
@@ -206,6 +348,16 @@ void PairHybrid::add_tally_callback(Compute *ptr)
 {
   for (int m = 0; m < nstyles; m++)
     if (compute_tally[m]) styles[m]->add_tally_callback(ptr);
+
+  // pairs of fused sub-styles are tallied by hybrid itself
+
+  if (nfused) {
+    for (int m = 0; m < nstyles; m++)
+      if (fused[m] && compute_tally[m]) {
+        Pair::add_tally_callback(ptr);
+        break;
+      }
+  }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -214,6 +366,7 @@ void PairHybrid::del_tally_callback(Compute *ptr)
 {
   for (int m = 0; m < nstyles; m++)
     if (compute_tally[m]) styles[m]->del_tally_callback(ptr);
+  Pair::del_tally_callback(ptr);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -292,6 +445,10 @@ void PairHybrid::settings(int narg, char **arg)
     delete[] compute_tally;
   }
 
+  delete[] fused;
+  fused = nullptr;
+  nfused = 0;
+
   if (allocated) {
     memory->destroy(setflag);
     memory->destroy(cutsq);
@@ -639,10 +796,21 @@ void PairHybrid::init_style()
   for (istyle = 0; istyle < nstyles; istyle++)
     if (styles[istyle]->beyond_contact) beyond_contact = 1;
 
+  // sub-styles do not call Pair::init(), so check pair_modify tabulate here
+
+  for (istyle = 0; istyle < nstyles; istyle++)
+    if (styles[istyle]->ntabulate && !styles[istyle]->tabulate_enable)
+      error->all(FLERR,"Pair hybrid sub-style {} does not support pair_modify tabulate",
+                 keywords[istyle]);
+
   // each sub-style makes its neighbor list request(s)
 
   for (istyle = 0; istyle < nstyles; istyle++) styles[istyle]->init_style();
 
+  // select sub-styles for fused evaluation
+
+  init_fused();
+
   // create skip lists inside each pair neigh request
   // any kind of list can have its skip flag set in this loop
 
@@ -655,11 +823,7 @@ void PairHybrid::init_style()
 
     // allocate iskip and ijskip
     // initialize so as to skip all pair types
-    // set ijskip = 0 if type pair matches any entry in sub-style map
-    // set ijskip = 0 if mixing will assign type pair to this sub-style
-    //   will occur if type pair is currently unassigned
-    //   and both I,I and J,J are assigned to single sub-style
-    //   and sub-style for both I,I and J,J match istyle
+    // set ijskip = 0 for type pairs computed by this sub-style
     // set iskip = 1 only if all ijskip for itype are 1
 
     int *iskip = new int[ntypes+1];
@@ -670,16 +834,18 @@ void PairHybrid::init_style()
       for (jtype = 1; jtype <= ntypes; jtype++)
         ijskip[itype][jtype] = 1;
 
-    for (itype = 1; itype <= ntypes; itype++)
-      for (jtype = itype; jtype <= ntypes; jtype++) {
-        for (m = 0; m < nmap[itype][jtype]; m++)
-          if (map[itype][jtype][m] == istyle)
-            ijskip[itype][jtype] = ijskip[jtype][itype] = 0;
-        if (nmap[itype][jtype] == 0 &&
-            nmap[itype][itype] == 1 && map[itype][itype][0] == istyle &&
-            nmap[jtype][jtype] == 1 && map[jtype][jtype][0] == istyle)
-          ijskip[itype][jtype] = ijskip[jtype][itype] = 0;
+    // requests of fused sub-styles are made identical to the host list
+    // or to each other, so Neighbor builds a single list and copies it
+
+    if (nfused && (istyle < nstyles) && fused[istyle]) {
+      if (fused_host >= 0) {
+        unskip_types(fused_host,ijskip);
+        if (fused_full) request->enable_full();
+      } else {
+        for (m = 0; m < nstyles; m++)
+          if (fused[m]) unskip_types(m,ijskip);
       }
+    } else unskip_types(istyle,ijskip);
 
     for (itype = 1; itype <= ntypes; itype++) {
       iskip[itype] = 1;
@@ -706,6 +872,147 @@ void PairHybrid::init_style()
   }
 }
 
+/* ----------------------------------------------------------------------
+   set ijskip = 0 for all type pairs computed by sub-style istyle
+   this includes type pairs that mixing will assign to this sub-style
+     will occur if type pair is currently unassigned
+     and both I,I and J,J are assigned to single sub-style
+     and sub-style for both I,I and J,J match istyle
+------------------------------------------------------------------------- */
+
+void PairHybrid::unskip_types(int istyle, int **ijskip)
+{
+  int itype,jtype,m;
+  const int ntypes = atom->ntypes;
+
+  for (itype = 1; itype <= ntypes; itype++)
+    for (jtype = itype; jtype <= ntypes; jtype++) {
+      for (m = 0; m < nmap[itype][jtype]; m++)
+        if (map[itype][jtype][m] == istyle)
+          ijskip[itype][jtype] = ijskip[jtype][itype] = 0;
+      if (nmap[itype][jtype] == 0 &&
+          nmap[itype][itype] == 1 && map[itype][itype][0] == istyle &&
+          nmap[jtype][jtype] == 1 && map[jtype][jtype][0] == istyle)
+        ijskip[itype][jtype] = ijskip[jtype][itype] = 0;
+    }
+}
+
+/* ----------------------------------------------------------------------
+   select sub-styles for fused evaluation when pair_modify fused is set
+   a sub-style is fused if it provides a compute_pair() kernel, makes a
+     single neighbor list request, and has no accelerator suffix,
+     no per sub-style special bonds and its compute flag set
+   if the list of another sub-style contains all type pairs of the
+     fused sub-styles, it becomes the host list that they share,
+     else the fused sub-styles share a half list among themselves
+------------------------------------------------------------------------- */
+
+void PairHybrid::init_fused()
+{
+  int istyle,itype,jtype;
+  const int ntypes = atom->ntypes;
+
+  delete[] fused;
+  fused = new int[nstyles];
+  for (istyle = 0; istyle < nstyles; istyle++) fused[istyle] = 0;
+  nfused = 0;
+  fused_lead = fused_host = -1;
+  fused_full = 0;
+
+  if (!fused_flag) return;
+
+  if (lmp->kokkos || utils::strmatch(force->pair_style,"^hybrid/scaled") ||
+      utils::strmatch(force->pair_style,"^hybrid/molecular"))
+    error->all(FLERR,"Pair_modify fused is not supported by pair style {}", force->pair_style);
+  if (utils::strmatch(update->integrate_style,"^respa"))
+    error->all(FLERR,"Pair_modify fused is not compatible with run style respa");
+
+  // count neighbor list requests of each sub-style
+
+  std::vector<int> nrequest(nstyles,0);
+  std::vector<NeighRequest *> myrequest(nstyles,nullptr);
+  for (auto &request : neighbor->get_pair_requests()) {
+    for (istyle = 0; istyle < nstyles; istyle++)
+      if (styles[istyle] == request->get_requestor()) {
+        ++nrequest[istyle];
+        myrequest[istyle] = request;
+      }
+  }
+
+  for (istyle = 0; istyle < nstyles; istyle++) {
+    if (styles[istyle]->fused_enable && styles[istyle]->compute_flag &&
+        (styles[istyle]->suffix_flag == Suffix::NONE) && (nrequest[istyle] == 1) &&
+        !special_lj[istyle] && !special_coul[istyle]) {
+      fused[istyle] = 1;
+      if (fused_lead < 0) fused_lead = istyle;
+      nfused++;
+    }
+  }
+  if (nfused == 0) return;
+
+  // search for a host list which contains all type pairs of the fused sub-styles
+
+  int **fusedskip,**hostskip;
+  memory->create(fusedskip,ntypes+1,ntypes+1,"pair_hybrid:fusedskip");
+  memory->create(hostskip,ntypes+1,ntypes+1,"pair_hybrid:hostskip");
+
+  for (itype = 1; itype <= ntypes; itype++)
+    for (jtype = 1; jtype <= ntypes; jtype++)
+      fusedskip[itype][jtype] = 1;
+  for (istyle = 0; istyle < nstyles; istyle++)
+    if (fused[istyle]) unskip_types(istyle,fusedskip);
+
+  for (istyle = 0; istyle < nstyles; istyle++) {
+    if (fused[istyle] || (nrequest[istyle] != 1) || myrequest[istyle]->get_size()) continue;
+
+    for (itype = 1; itype <= ntypes; itype++)
+      for (jtype = 1; jtype <= ntypes; jtype++)
+        hostskip[itype][jtype] = 1;
+    unskip_types(istyle,hostskip);
+
+    int covered = 1;
+    for (itype = 1; itype <= ntypes; itype++)
+      for (jtype = 1; jtype <= ntypes; jtype++)
+        if (!fusedskip[itype][jtype] && hostskip[itype][jtype]) covered = 0;
+
+    if (covered) {
+      fused_host = istyle;
+      fused_full = myrequest[istyle]->get_full();
+      break;
+    }
+  }
+
+  memory->destroy(fusedskip);
+  memory->destroy(hostskip);
+}
+
+/* ----------------------------------------------------------------------
+   set the cutoff of the requests of fused sub-styles to the host list
+   cutoff or to the largest cutoff of all fused sub-styles, so that
+   the requests stay identical and Neighbor turns them into copies
+------------------------------------------------------------------------- */
+
+void PairHybrid::trim_fused()
+{
+  double cut = 0.0;
+  int trim = 1;
+
+  if (fused_host >= 0) {
+    trim = styles[fused_host]->trim_flag;
+    cut = cutmax_style[fused_host];
+  }
+  for (int m = 0; m < nstyles; m++) {
+    if (!fused[m]) continue;
+    cut = MAX(cut,cutmax_style[m]);
+    if (!styles[m]->trim_flag) trim = 0;
+  }
+  if (!trim) return;
+
+  for (auto &request : neighbor->get_pair_requests())
+    for (int m = 0; m < nstyles; m++)
+      if (fused[m] && (styles[m] == request->get_requestor())) request->set_cutoff(cut);
+}
+
 /* ----------------------------------------------------------------------
    init for one type pair i,j and corresponding j,i
 ------------------------------------------------------------------------- */
@@ -753,7 +1060,10 @@ double PairHybrid::init_one(int i, int j)
     for (istyle = 0; istyle < nstyles; istyle++)
       if (styles[istyle] == styles[map[i][j][k]]) break;
 
-    if (styles[istyle]->trim_flag) {
+    if (nfused && fused[istyle]) {
+      cutmax_style[istyle] = MAX(cutmax_style[istyle],cut);
+
+    } else if (styles[istyle]->trim_flag) {
 
       if (cut > cutmax_style[istyle]) {
         cutmax_style[istyle] = cut;
@@ -768,6 +1078,8 @@ double PairHybrid::init_one(int i, int j)
     }
   }
 
+  if (nfused) trim_fused();
+
   return cutmax;
 }
 
@@ -826,6 +1138,9 @@ void PairHybrid::read_restart(FILE *fp)
   delete[] special_lj;
   delete[] special_coul;
   delete[] compute_tally;
+  delete[] fused;
+  fused = nullptr;
+  nfused = 0;
 
   styles = new Pair*[nstyles];
   delete[] cutmax_style;
@@ -982,6 +1297,14 @@ void PairHybrid::modify_params(int narg, char **arg)
 {
   if (narg == 0) error->all(FLERR,"Illegal pair_modify command");
 
+  // fused keyword applies to pair hybrid itself only
+
+  if (strcmp(arg[0],"fused") == 0) {
+    if (narg != 2) error->all(FLERR,"Illegal pair_modify fused command");
+    fused_flag = utils::logical(FLERR,arg[1],false,lmp);
+    return;
+  }
+
   // if 1st keyword is pair, apply other keywords to one sub-style
 
   if (strcmp(arg[0],"pair") == 0) {
@@ -87,8 +87,19 @@ class PairHybrid : public Pair {
   double **special_coul;    // list of per style Coulomb exclusion factors
   int *compute_tally;       // list of on/off flags for tally computes
 
+  int fused_flag;     // 1 if pair_modify fused yes
+  int *fused;         // 1 if sub-style is evaluated in the fused pass
+  int nfused;         // # of sub-styles evaluated in the fused pass
+  int fused_lead;     // sub-style whose neighbor list the fused pass uses
+  int fused_host;     // sub-style whose list is shared by fused sub-styles, -1 if none
+  int fused_full;     // 1 if the shared list is a full list
+
   void allocate();
   void flags();
+  void unskip_types(int, int **);
+  void init_fused();
+  void trim_fused();
+  void compute_fused();
 
   virtual void init_svector();
   virtual void copy_svector(int, int);
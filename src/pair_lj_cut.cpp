@@ -40,6 +40,7 @@ PairLJCut::PairLJCut(LAMMPS *lmp) : Pair(lmp)
 {
   respa_enable = 1;
   born_matrix_enable = 1;
+  fused_enable = 1;
   writedata = 1;
 }
 
@@ -39,6 +39,7 @@ using namespace PairZBLConstants;
 
 PairZBL::PairZBL(LAMMPS *lmp) : Pair(lmp)
 {
+  fused_enable = 1;
   writedata = 1;
 }
 
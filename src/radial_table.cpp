@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "radial_table.h"
+
+#include "comm.h"
+#include "error.h"
+#include "memory.h"
+
+#include <cmath>
+
+using namespace LAMMPS_NS;
+
+// relative error of a table above which a warning is printed
+
+static constexpr double WARN_ERROR = 1.0e-5;
+
+/* ---------------------------------------------------------------------- */
+
+RadialTable::RadialTable(LAMMPS *lmp, int _nfunc, int _nparams) :
+    Pointers(lmp), nfunc(_nfunc), nparams(_nparams), npoints(0), tables(nullptr),
+    coeff(nullptr), ncoeff(0)
+{
+  names.resize(nfunc);
+  functions.resize(nfunc);
+  tables = new Table[nfunc * nparams];
+  for (int i = 0; i < nfunc * nparams; i++) {
+    tables[i].rmin = tables[i].rmax = tables[i].ralign = tables[i].rlo = 0.0;
+    tables[i].invdelta = tables[i].umax = 0.0;
+    tables[i].coeff = nullptr;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+RadialTable::~RadialTable()
+{
+  delete[] tables;
+  memory->destroy(coeff);
+}
+
+/* ----------------------------------------------------------------------
+   register function id with a name used in the log output
+------------------------------------------------------------------------- */
+
+void RadialTable::set_function(int id, const std::string &name, Function fn)
+{
+  names[id] = name;
+  functions[id] = std::move(fn);
+}
+
+/* ----------------------------------------------------------------------
+   set range rmin <= r < rmax of the table of function id for parameter set m
+   an empty range disables the table, so lookups always fail
+   ralign is placed on a grid point, e.g. where the function has a kink
+------------------------------------------------------------------------- */
+
+void RadialTable::set_range(int id, int m, double rmin, double rmax, double ralign)
+{
+  Table &t = tables[id * nparams + m];
+  t.rmin = rmin;
+  t.rmax = rmax;
+  t.ralign = ralign;
+}
+
+/* ----------------------------------------------------------------------
+   tabulate all functions with about n grid points per table
+   compute the interpolation error in between grid points and report it
+------------------------------------------------------------------------- */
+
+void RadialTable::build(int n)
+{
+  if (n < 2) error->all(FLERR, "Number of points for pair_modify tabulate must be > 1");
+  npoints = n;
+
+  // set up the grid of each table, so that rmax is a grid point and
+  // the grid spacing is adjusted to also have ralign on a grid point.
+  // the grid may start slightly above rmin, but never below
+
+  std::vector<int> nint(nfunc * nparams, 0);
+  ncoeff = 0;
+  for (int i = 0; i < nfunc * nparams; i++) {
+    Table &t = tables[i];
+    t.invdelta = t.umax = 0.0;
+    if (t.rmax <= t.rmin) continue;
+    double delta = (t.rmax - t.rmin) / (npoints - 1);
+    if ((t.ralign > t.rmin) && (t.ralign < t.rmax)) {
+      int nalign = MAX(1, static_cast<int>(std::lround((t.rmax - t.ralign) / delta)));
+      delta = (t.rmax - t.ralign) / nalign;
+    }
+    nint[i] = MAX(1, static_cast<int>(std::floor((t.rmax - t.rmin) / delta + 1.0e-8)));
+    t.invdelta = 1.0 / delta;
+    t.rlo = t.rmax - nint[i] * delta;
+    t.umax = nint[i];
+    ncoeff += 4 * nint[i];
+  }
+
+  memory->destroy(coeff);
+  memory->create(coeff, ncoeff, "pair:radial_table");
+
+  // Hermite interpolation between grid points from values and derivatives
+  // error estimate from comparison at 3 points inside each interval
+
+  std::vector<double> errval(nfunc, 0.0), errder(nfunc, 0.0);
+  double *c = coeff;
+
+  for (int id = 0; id < nfunc; id++) {
+    const Function &fn = functions[id];
+    for (int m = 0; m < nparams; m++) {
+      Table &t = tables[id * nparams + m];
+      t.coeff = c;
+      const int nt = nint[id * nparams + m];
+      if (nt == 0) continue;
+
+      const double delta = 1.0 / t.invdelta;
+      const double r0 = t.rlo;
+
+      double f0, df0, f1, df1;
+      double fmax = 0.0, dfmax = 0.0;
+      fn(m, r0, f0, df0);
+      for (int k = 0; k < nt; k++) {
+        fn(m, r0 + (k + 1) * delta, f1, df1);
+        c[0] = f0;
+        c[1] = delta * df0;
+        c[2] = 3.0 * (f1 - f0) - delta * (2.0 * df0 + df1);
+        c[3] = 2.0 * (f0 - f1) + delta * (df0 + df1);
+        fmax = MAX(fmax, fabs(f0));
+        dfmax = MAX(dfmax, fabs(df0));
+        f0 = f1;
+        df0 = df1;
+        c += 4;
+      }
+      fmax = MAX(fmax, fabs(f0));
+      dfmax = MAX(dfmax, fabs(df0));
+      if (fmax == 0.0) fmax = 1.0;
+      if (dfmax == 0.0) dfmax = 1.0;
+
+      double f, df, ftab, dftab;
+      for (int k = 0; k < nt; k++) {
+        for (int s = 1; s < 4; s++) {
+          const double r = r0 + (k + 0.25 * s) * delta;
+          fn(m, r, f, df);
+          lookup(id, m, r, ftab, dftab);
+          errval[id] = MAX(errval[id], fabs(ftab - f) / fmax);
+          errder[id] = MAX(errder[id], fabs(dftab - df) / dfmax);
+        }
+      }
+    }
+  }
+
+  if (comm->me == 0) {
+    std::string mesg = fmt::format("Tabulated radial functions with {} points:\n", npoints);
+    for (int id = 0; id < nfunc; id++)
+      mesg += fmt::format("  {:<8} max. relative error {:.3g} (value) {:.3g} (derivative)\n",
+                          names[id], errval[id], errder[id]);
+    utils::logmesg(lmp, mesg);
+
+    for (int id = 0; id < nfunc; id++)
+      if ((errval[id] > WARN_ERROR) || (errder[id] > WARN_ERROR))
+        error->warning(FLERR, "Relative error of tabulated function {} is larger than {}",
+                       names[id], WARN_ERROR);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double RadialTable::memory_usage() const
+{
+  double bytes = (double) nfunc * nparams * sizeof(Table);
+  bytes += (double) ncoeff * sizeof(double);
+  return bytes;
+}
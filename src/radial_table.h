@@ -0,0 +1,95 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_RADIAL_TABLE_H
+#define LMP_RADIAL_TABLE_H
+
+#include "pointers.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace LAMMPS_NS {
+
+// cubic Hermite spline tables of radial functions f(r) of manybody pair
+// styles, one table per function and parameter set, see pair_modify tabulate
+
+class RadialTable : protected Pointers {
+ public:
+  // evaluate function for parameter set m at r, return value and derivative
+  typedef std::function<void(int m, double r, double &f, double &df)> Function;
+
+  RadialTable(class LAMMPS *, int nfunc, int nparams);
+  ~RadialTable() override;
+
+  void set_function(int, const std::string &, Function);
+  void set_range(int, int, double, double, double = 0.0);
+  void build(int);
+
+  int get_npoints() const { return npoints; }
+  double memory_usage() const;
+
+  // value of function id for parameter set m at r
+  // return 0 if r is outside the tabulated range
+
+  inline int value(int id, int m, double r, double &f) const
+  {
+    const Table &t = tables[id * nparams + m];
+    double u = (r - t.rlo) * t.invdelta;
+    if ((u < 0.0) || (u >= t.umax)) return 0;
+    const int k = static_cast<int>(u);
+    u -= k;
+    const double *c = t.coeff + 4 * k;
+    f = ((c[3] * u + c[2]) * u + c[1]) * u + c[0];
+    return 1;
+  }
+
+  // value and derivative of function id for parameter set m at r
+  // return 0 if r is outside the tabulated range
+
+  inline int lookup(int id, int m, double r, double &f, double &df) const
+  {
+    const Table &t = tables[id * nparams + m];
+    double u = (r - t.rlo) * t.invdelta;
+    if ((u < 0.0) || (u >= t.umax)) return 0;
+    const int k = static_cast<int>(u);
+    u -= k;
+    const double *c = t.coeff + 4 * k;
+    f = ((c[3] * u + c[2]) * u + c[1]) * u + c[0];
+    df = ((3.0 * c[3] * u + 2.0 * c[2]) * u + c[1]) * t.invdelta;
+    return 1;
+  }
+
+ protected:
+  struct Table {
+    double rmin, rmax;  // requested range of r
+    double ralign;      // r that should coincide with a grid point, 0.0 if none
+    double rlo;         // first grid point
+    double invdelta;    // inverse grid spacing
+    double umax;        // number of intervals
+    double *coeff;      // 4 polynomial coefficients per interval
+  };
+
+  int nfunc, nparams;    // number of functions and parameter sets
+  int npoints;           // requested number of grid points per table
+  Table *tables;         // nfunc x nparams tables
+  double *coeff;         // storage for all polynomial coefficients
+  bigint ncoeff;         // length of coeff
+
+  std::vector<std::string> names;
+  std::vector<Function> functions;
+};
+}    // namespace LAMMPS_NS
+
+#endif
@@ -0,0 +1,416 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "union_find.h"
+
+#include "atom.h"
+#include "comm.h"
+#include "memory.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+UnionFind::UnionFind(LAMMPS *lmp) :
+    Pointers(lmp), nlocal(0), nkey(0), maxlocal(0), maxall(0), parent(nullptr), id(nullptr),
+    key(nullptr), label(nullptr)
+{
+}
+
+/* ---------------------------------------------------------------------- */
+
+UnionFind::~UnionFind()
+{
+  memory->destroy(parent);
+  memory->destroy(label);
+}
+
+/* ----------------------------------------------------------------------
+   start a new search with every owned atom in its own component
+   ids = per-atom IDs, must be > 0 for atoms that are part of a component
+   keys = optional nkey values per atom, the smallest one is propagated
+------------------------------------------------------------------------- */
+
+void UnionFind::reset(double *ids, int n, double **keys)
+{
+  nlocal = atom->nlocal;
+  id = ids;
+  key = keys;
+
+  if (nlocal > maxlocal) {
+    memory->destroy(parent);
+    maxlocal = atom->nmax;
+    memory->create(parent, maxlocal, "union_find:parent");
+  }
+  if ((n != nkey) || (atom->nmax > maxall)) {
+    memory->destroy(label);
+    nkey = n;
+    maxall = atom->nmax;
+    memory->create(label, maxall, nkey + 2, "union_find:label");
+  }
+
+  for (int i = 0; i < nlocal; i++) parent[i] = i;
+  cross.clear();
+}
+
+/* ----------------------------------------------------------------------
+   join the components of two owned or ghost atoms
+   ghost atoms that are images of owned atoms are joined right away,
+   all other ghost atoms are resolved in merge()
+------------------------------------------------------------------------- */
+
+void UnionFind::join(int i, int j)
+{
+  const int oi = owned(i);
+  const int oj = owned(j);
+
+  if (oi < 0) {
+    if (oj >= 0) cross.emplace_back(oj, i);
+    return;
+  }
+  if (oj < 0) {
+    cross.emplace_back(oi, j);
+    return;
+  }
+
+  // the root always has the lowest ID of its component
+
+  const int ri = find(oi);
+  const int rj = find(oj);
+  if (ri == rj) return;
+  if (id[ri] < id[rj])
+    parent[rj] = ri;
+  else
+    parent[ri] = rj;
+}
+
+/* ----------------------------------------------------------------------
+   set IDs and keys of owned atoms to the lowest values of their component
+
+   components are first labeled locally. each link between an owned and a
+   ghost atom from join() then links two local components on different
+   procs. only this compacted graph of local components is merged across
+   procs, along a binomial tree in log2(P) steps, see merge_tree().
+   links must be known to the procs of both atoms, e.g. from full neighbor
+   lists or special lists. otherwise the caller must pass itself as revcomm
+   and forward its reverse communication to pack/unpack_reverse_comm()
+------------------------------------------------------------------------- */
+
+void UnionFind::merge(Compute *revcomm)
+{
+  int i, k, r;
+  const int nlabel = nkey + 1;
+  tagint *tag = atom->tag;
+
+  // label each owned atom with ID and smallest key of its local component
+
+  for (i = 0; i < nlocal; i++) {
+    label[i][0] = id[i];
+    for (k = 0; k < nkey; k++) label[i][k + 1] = key[i][k];
+  }
+
+  for (i = 0; i < nlocal; i++) {
+    if (id[i] == 0.0) continue;
+    r = find(i);
+    if (r != i) lower(label[r], label[i]);
+  }
+
+  // ghost atoms acquire the label of their local component
+  // and its name, which is the tag of its root atom
+
+  for (i = 0; i < nlocal; i++) {
+    label[i][nlabel] = 0.0;
+    if (id[i] == 0.0) continue;
+    r = find(i);
+    if (r != i)
+      for (k = 0; k < nlabel; k++) label[i][k] = label[r][k];
+    label[i][nlabel] = tag[r];
+  }
+  comm->forward_comm_array(nlabel + 1, label);
+
+  // graph of the local components linked to components of other procs
+
+  node.clear();
+  nodename.clear();
+  nodeparent.clear();
+  nodelabel.clear();
+
+  for (const auto &c : cross) {
+    if ((id[c.first] == 0.0) || (label[c.second][0] == 0.0)) continue;
+    r = find(c.first);
+    unite_nodes(add_node(tag[r], label[r]),
+                add_node((tagint) label[c.second][nlabel], label[c.second]));
+  }
+
+  merge_tree();
+
+  for (i = 0; i < nlocal; i++) {
+    if ((id[i] == 0.0) || (find(i) != i)) continue;
+    auto n = node.find(tag[i]);
+    if (n != node.end()) lower(label[i], &nodelabel[find_node(n->second) * nlabel]);
+  }
+
+  // for links only known on one side, also send the labels of the merged
+  // components back to the owners of the ghost atoms
+
+  if (revcomm) {
+    for (i = 0; i < nlocal; i++) {
+      if (id[i] == 0.0) continue;
+      r = find(i);
+      for (k = 0; k < nlabel; k++) label[i][k] = label[r][k];
+    }
+    for (const auto &c : cross) {
+      if ((id[c.first] == 0.0) || (label[c.second][0] == 0.0)) continue;
+      const int n = node[(tagint) label[c.second][nlabel]];
+      lower(label[c.second], &nodelabel[find_node(n) * nlabel]);
+    }
+    comm->reverse_comm(revcomm);
+    for (i = 0; i < nlocal; i++) {
+      if (id[i] == 0.0) continue;
+      lower(label[find(i)], label[i]);
+    }
+  }
+
+  // final IDs and keys of owned atoms
+
+  for (i = 0; i < nlocal; i++) {
+    if (id[i] == 0.0) continue;
+    r = find(i);
+    id[i] = label[r][0];
+    for (k = 0; k < nkey; k++) key[i][k] = label[r][k + 1];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   merge the graphs of local components of all procs along a binomial tree
+   each proc unites the nodes of its children with its own, sends all of
+   them with their sets up to its parent, receives their final labels and
+   passes them on to its children. this takes 2*log2(P) steps and only
+   moves components that are linked across procs
+------------------------------------------------------------------------- */
+
+void UnionFind::merge_tree()
+{
+  const int me = comm->me;
+  const int nprocs = comm->nprocs;
+  const int nlabel = nkey + 1;
+  const int nrec = nlabel + 2;    // name, set and label of a node
+
+  std::vector<double> buf;
+  std::vector<int> children;
+  std::vector<std::vector<int>> childnodes;
+  MPI_Status status;
+  int m, n, k, r, count;
+
+  // receive the nodes of the children and unite those of the same set
+
+  int mask = 1;
+  for (; mask < nprocs; mask <<= 1) {
+    if (me & mask) break;
+    const int child = me + mask;
+    if (child >= nprocs) continue;
+
+    MPI_Probe(child, 0, world, &status);
+    MPI_Get_count(&status, MPI_DOUBLE, &count);
+    buf.resize(count);
+    MPI_Recv(buf.data(), count, MPI_DOUBLE, child, 0, world, MPI_STATUS_IGNORE);
+
+    const int nnode = count / nrec;
+    std::vector<int> first(nnode, -1);
+    std::vector<int> index(nnode);
+    for (m = 0; m < nnode; m++) {
+      const double *rec = &buf[m * nrec];
+      const int s = (int) rec[1];
+      index[m] = add_node((tagint) rec[0], rec + 2);
+      if (first[s] < 0)
+        first[s] = index[m];
+      else
+        unite_nodes(first[s], index[m]);
+    }
+    children.push_back(child);
+    childnodes.push_back(std::move(index));
+  }
+
+  // send all nodes to the parent and get their final labels back
+
+  if (me) {
+    const int nnode = nodename.size();
+    buf.resize((size_t) nnode * nrec);
+    for (n = 0; n < nnode; n++) {
+      r = find_node(n);
+      buf[n * nrec] = nodename[n];
+      buf[n * nrec + 1] = r;
+      for (k = 0; k < nlabel; k++) buf[n * nrec + 2 + k] = nodelabel[r * nlabel + k];
+    }
+    MPI_Send(buf.data(), nnode * nrec, MPI_DOUBLE, me - mask, 0, world);
+
+    buf.resize((size_t) nnode * nlabel);
+    MPI_Recv(buf.data(), nnode * nlabel, MPI_DOUBLE, me - mask, 0, world, MPI_STATUS_IGNORE);
+    for (n = 0; n < nnode; n++) {
+      r = find_node(n);
+      for (k = 0; k < nlabel; k++) nodelabel[r * nlabel + k] = buf[n * nlabel + k];
+    }
+  }
+
+  // return the final labels of their nodes to the children
+
+  for (size_t c = 0; c < children.size(); c++) {
+    const auto &index = childnodes[c];
+    const int nnode = index.size();
+    buf.resize((size_t) nnode * nlabel);
+    for (m = 0; m < nnode; m++) {
+      r = find_node(index[m]);
+      for (k = 0; k < nlabel; k++) buf[m * nlabel + k] = nodelabel[r * nlabel + k];
+    }
+    MPI_Send(buf.data(), nnode * nlabel, MPI_DOUBLE, children[c], 0, world);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   reverse communication of the labels of ghost atoms for merge()
+------------------------------------------------------------------------- */
+
+int UnionFind::pack_reverse_comm(int n, int first, double *buf)
+{
+  int m = 0;
+  for (int i = first; i < first + n; i++)
+    for (int k = 0; k <= nkey; k++) buf[m++] = label[i][k];
+  return m;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void UnionFind::unpack_reverse_comm(int n, int *list, double *buf)
+{
+  int m = 0;
+  for (int i = 0; i < n; i++) {
+    const int j = list[i];
+    if ((label[j][0] != 0.0) && (buf[m] != 0.0)) lower(label[j], buf + m);
+    m += nkey + 1;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   local index of owned atom I or its owned image, -1 if owned by other proc
+------------------------------------------------------------------------- */
+
+int UnionFind::owned(int i)
+{
+  if (i < nlocal) return i;
+  const int k = atom->map(atom->tag[i]);
+  if ((k >= 0) && (k < nlocal)) return k;
+  return -1;
+}
+
+/* ----------------------------------------------------------------------
+   root of the component of owned atom I with path halving
+------------------------------------------------------------------------- */
+
+int UnionFind::find(int i)
+{
+  while (parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
+/* ----------------------------------------------------------------------
+   node of the component with name NAME, added with label LAB if new,
+   otherwise the label of its set is lowered to LAB
+------------------------------------------------------------------------- */
+
+int UnionFind::add_node(tagint name, const double *lab)
+{
+  auto n = node.find(name);
+  if (n != node.end()) {
+    lower(&nodelabel[find_node(n->second) * (nkey + 1)], lab);
+    return n->second;
+  }
+
+  const int j = nodename.size();
+  node[name] = j;
+  nodename.push_back(name);
+  nodeparent.push_back(j);
+  nodelabel.insert(nodelabel.end(), lab, lab + nkey + 1);
+  return j;
+}
+
+/* ----------------------------------------------------------------------
+   root of the set of node I with path halving
+------------------------------------------------------------------------- */
+
+int UnionFind::find_node(int i)
+{
+  while (nodeparent[i] != i) {
+    nodeparent[i] = nodeparent[nodeparent[i]];
+    i = nodeparent[i];
+  }
+  return i;
+}
+
+/* ----------------------------------------------------------------------
+   unite the sets of nodes I and J, the root keeps the lowest label
+------------------------------------------------------------------------- */
+
+void UnionFind::unite_nodes(int i, int j)
+{
+  const int ri = find_node(i);
+  const int rj = find_node(j);
+  if (ri == rj) return;
+  nodeparent[rj] = ri;
+  lower(&nodelabel[ri * (nkey + 1)], &nodelabel[rj * (nkey + 1)]);
+}
+
+/* ----------------------------------------------------------------------
+   lower ID and key of label A to those of label B, return 1 if A changed
+------------------------------------------------------------------------- */
+
+int UnionFind::lower(double *a, const double *b) const
+{
+  int change = 0;
+  if (b[0] < a[0]) {
+    a[0] = b[0];
+    change = 1;
+  }
+  if (nkey && less(b + 1, a + 1)) {
+    for (int k = 0; k < nkey; k++) a[k + 1] = b[k + 1];
+    change = 1;
+  }
+  return change;
+}
+
+/* ----------------------------------------------------------------------
+   lexicographic comparison of two keys
+------------------------------------------------------------------------- */
+
+bool UnionFind::less(const double *a, const double *b) const
+{
+  for (int k = 0; k < nkey; k++) {
+    if (a[k] < b[k]) return true;
+    if (a[k] > b[k]) return false;
+  }
+  return false;
+}
+
+/* ---------------------------------------------------------------------- */
+
+double UnionFind::memory_usage() const
+{
+  double bytes = (double) maxlocal * sizeof(int);
+  bytes += (double) maxall * (nkey + 2) * sizeof(double);
+  bytes += (double) cross.capacity() * sizeof(std::pair<int, int>);
+  bytes += (double) nodename.capacity() * (sizeof(tagint) + sizeof(int));
+  bytes += (double) nodelabel.capacity() * sizeof(double);
+  return bytes;
+}
@@ -0,0 +1,73 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_UNION_FIND_H
+#define LMP_UNION_FIND_H
+
+#include "pointers.h"
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace LAMMPS_NS {
+
+// parallel connected components of a graph of atoms, e.g. clusters,
+// fragments or molecules. each proc joins pairs of owned and ghost atoms,
+// merge() sets the ID of all owned atoms of a component to the lowest ID
+// of the component and optionally also its lexicographically smallest key.
+// local components linked across procs are merged along a binomial tree.
+// callers whose links are only stored on one proc pass themselves to merge()
+// and forward their reverse communication of nkey+1 values per atom
+
+class UnionFind : protected Pointers {
+ public:
+  UnionFind(class LAMMPS *);
+  ~UnionFind() override;
+
+  void reset(double *, int = 0, double ** = nullptr);
+  void join(int, int);
+  void merge(class Compute * = nullptr);
+  int pack_reverse_comm(int, int, double *);
+  void unpack_reverse_comm(int, int *, double *);
+  double memory_usage() const;
+
+ protected:
+  int nlocal, nkey;
+  int maxlocal, maxall;
+  int *parent;       // union-find forest of owned atoms
+  double *id;        // per-atom IDs of the caller, 0 = not part of any component
+  double **key;      // optional per-atom keys of the caller, nkey values each
+  double **label;    // ID, keys and name of the component of owned and ghost atoms
+
+  std::vector<std::pair<int, int>> cross;    // pairs of owned and ghost atoms of other procs
+
+  // graph of local components linked across procs, named by the tag of their root atom
+
+  std::unordered_map<tagint, int> node;    // node index of each named component
+  std::vector<tagint> nodename;            // name of each node
+  std::vector<int> nodeparent;             // union-find forest of nodes
+  std::vector<double> nodelabel;           // ID and keys of each node, nkey+1 values
+
+  int owned(int);
+  int find(int);
+  int add_node(tagint, const double *);
+  int find_node(int);
+  void unite_nodes(int, int);
+  void merge_tree();
+  int lower(double *, const double *) const;
+  bool less(const double *, const double *) const;
+};
+}    // namespace LAMMPS_NS
+
+#endif
@@ -0,0 +1,214 @@
+// unit tests for the parallel merge of clusters, fragments and molecules
+
+#define LAMMPS_LIB_MPI 1
+#include "atom.h"
+#include "input.h"
+#include "lammps.h"
+#include "library.h"
+#include "platform.h"
+
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "../testing/test_mpi_main.h"
+
+// the system is set up in parallel, written to a data file and then read
+// by a serial reference instance on each proc
+
+static const char datafile[] = "test_mpi_clusters.data";
+
+namespace LAMMPS_NS {
+
+class MPIClustersTest : public ::testing::Test {
+public:
+    void command(const std::string &line) { lmp->input->one(line); }
+    void refcommand(const std::string &line) { ref->input->one(line); }
+
+protected:
+    const char *testbinary = "LAMMPSTest";
+    LAMMPS *lmp;
+    LAMMPS *ref;
+
+    void SetUp() override
+    {
+        LAMMPS::argv args = {testbinary, "-log", "none", "-echo", "screen", "-nocite"};
+        if (!verbose) ::testing::internal::CaptureStdout();
+        lmp = new LAMMPS(args, MPI_COMM_WORLD);
+        ref = new LAMMPS(args, MPI_COMM_SELF);
+        if (!verbose) ::testing::internal::GetCapturedStdout();
+    }
+
+    void TearDown() override
+    {
+        if (!verbose) ::testing::internal::CaptureStdout();
+        delete lmp;
+        delete ref;
+        lmp = nullptr;
+        ref = nullptr;
+        if (!verbose) ::testing::internal::GetCapturedStdout();
+        MPI_Barrier(MPI_COMM_WORLD);
+        if (comm_rank() == 0) platform::unlink(datafile);
+    }
+
+    static int comm_rank()
+    {
+        int me;
+        MPI_Comm_rank(MPI_COMM_WORLD, &me);
+        return me;
+    }
+
+    // write the parallel system and read it into the reference instance
+    // after running the given setup commands
+
+    void copy_system(const std::vector<std::string> &setup)
+    {
+        command(std::string("write_data ") + datafile);
+        MPI_Barrier(MPI_COMM_WORLD);
+        for (const auto &s : setup)
+            refcommand(s);
+        refcommand("atom_modify map array");
+        refcommand(std::string("read_data ") + datafile);
+    }
+
+    // gather a per-atom vector ordered by atom ID
+
+    static std::vector<double> gather(LAMMPS *lmp, const char *name)
+    {
+        std::vector<double> data(lmp->atom->natoms);
+        lammps_gather(lmp, (char *)name, 1, 1, data.data());
+        return data;
+    }
+
+    // a simple cubic lattice where about 60% of the sites are removed
+    // along a deterministic pattern. neighboring sites are bonded
+
+    void create_bonded_system(const std::string &newton_bond)
+    {
+        command("units lj");
+        command("atom_style bond");
+        command("atom_modify map array");
+        command("newton on " + newton_bond);
+        command("lattice sc 1.0");
+        command("region box block 0 16 0 8 0 8");
+        command("create_box 2 box bond/types 1 extra/bond/per/atom 6 "
+                "extra/special/per/atom 40");
+        command("create_atoms 1 box");
+        command("mass * 1.0");
+        command("variable t2 atom ((round(x)*round(x)*7+round(y)*round(y)*round(y)*3+"
+                "round(z)*13+round(x)*round(y)*round(z)*5)%97)<60");
+        command("group t2 variable t2");
+        command("set group t2 type 2");
+        command("group solid type 1");
+        command("pair_style zero 1.5");
+        command("pair_coeff * *");
+        command("bond_style zero");
+        command("bond_coeff 1 1.0");
+        command("special_bonds lj/coul 0.0 1.0 1.0");
+        command("create_bonds many solid solid 1 0.9 1.1");
+        command("special_bonds lj/coul 1.0 1.0 1.0");
+        copy_system({"units lj", "atom_style bond", "newton on " + newton_bond,
+                     "pair_style zero 1.5", "bond_style zero",
+                     "special_bonds lj/coul 1.0 1.0 1.0"});
+        refcommand("group solid type 1");
+    }
+
+    void check_bonded_system(const std::string &newton_bond)
+    {
+        if (!verbose) ::testing::internal::CaptureStdout();
+        create_bonded_system(newton_bond);
+        const std::vector<std::string> computes = {"compute clus solid cluster/atom 1.1",
+                                                   "compute frag solid fragment/atom",
+                                                   "compute aggr solid aggregate/atom 1.1"};
+        for (const auto &c : computes) {
+            command(c);
+            refcommand(c);
+        }
+        command("run 0 post no");
+        refcommand("run 0 post no");
+        if (!verbose) ::testing::internal::GetCapturedStdout();
+
+        ASSERT_EQ(lmp->atom->natoms, ref->atom->natoms);
+        auto clus = gather(lmp, "c_clus");
+        auto frag = gather(lmp, "c_frag");
+        auto aggr = gather(lmp, "c_aggr");
+        EXPECT_THAT(clus, ::testing::ContainerEq(gather(ref, "c_clus")));
+        EXPECT_THAT(frag, ::testing::ContainerEq(gather(ref, "c_frag")));
+        EXPECT_THAT(aggr, ::testing::ContainerEq(gather(ref, "c_aggr")));
+
+        // bonds are created between the same pairs that make up the clusters,
+        // so all three agree except for isolated atoms without a fragment
+
+        std::vector<double> ids;
+        for (bigint i = 0; i < lmp->atom->natoms; ++i) {
+            EXPECT_EQ(clus[i], aggr[i]);
+            if (frag[i] != 0.0) EXPECT_EQ(clus[i], frag[i]);
+            if ((clus[i] != 0.0) && (clus[i] == (double)(i + 1))) ids.push_back(clus[i]);
+        }
+        EXPECT_GT(ids.size(), 10);
+    }
+};
+
+TEST_F(MPIClustersTest, newton_bond_on)
+{
+    check_bonded_system("on");
+}
+
+TEST_F(MPIClustersTest, newton_bond_off)
+{
+    check_bonded_system("off");
+}
+
+TEST_F(MPIClustersTest, reaxff_species)
+{
+    if (!LAMMPS::is_installed_pkg("REAXFF")) GTEST_SKIP();
+
+    // a diamond lattice with most of the atoms deleted at random falls apart
+    // into molecules of various sizes
+
+    if (!verbose) ::testing::internal::CaptureStdout();
+    command("units real");
+    command("atom_style charge");
+    command("atom_modify map array");
+    command("lattice diamond 3.77");
+    command("region box block 0 4 0 4 0 4");
+    command("create_box 1 box");
+    command("create_atoms 1 box");
+    command("mass 1 12.0");
+    command("delete_atoms random fraction 0.7 no all NULL 8715 compress yes");
+    copy_system({"units real", "atom_style charge"});
+
+    const std::vector<std::string> setup = {"pair_style reaxff NULL checkqeq no",
+                                            "pair_coeff * * ffield.reax.mattsson C"};
+    for (const auto &s : setup) {
+        command(s);
+        refcommand(s);
+    }
+    const auto refout = "species.ref" + std::to_string(comm_rank()) + ".out";
+    command("fix spec all reaxff/species 1 1 1 species.out");
+    refcommand("fix spec all reaxff/species 1 1 1 " + refout);
+    command("run 1 post no");
+    refcommand("run 1 post no");
+    if (!verbose) ::testing::internal::GetCapturedStdout();
+
+    ASSERT_EQ(lmp->atom->natoms, ref->atom->natoms);
+    auto spec = gather(lmp, "f_spec");
+    EXPECT_THAT(spec, ::testing::ContainerEq(gather(ref, "f_spec")));
+
+    int nmol = 0;
+    for (bigint i = 0; i < lmp->atom->natoms; ++i)
+        if (spec[i] == (double)(i + 1)) ++nmol;
+    EXPECT_GT(nmol, 1);
+    EXPECT_LT(nmol, lmp->atom->natoms);
+
+    // the fixes must be deleted to close their files
+
+    command("unfix spec");
+    refcommand("unfix spec");
+    platform::unlink(refout);
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (comm_rank() == 0) platform::unlink("species.out");
+}
+} // namespace LAMMPS_NS
@@ -38,6 +38,7 @@ public:
     std::vector<std::pair<std::string, std::string>> prerequisites;
     std::vector<std::string> pre_commands;
     std::vector<std::string> post_commands;
+    std::vector<std::string> restart_commands;
     std::vector<std::string> tags;
     std::string input_file;
     std::string pair_style;
@@ -83,6 +84,7 @@ public:
         prerequisites.clear();
         pre_commands.clear();
         post_commands.clear();
+        restart_commands.clear();
         pair_coeff.clear();
         bond_coeff.clear();
         angle_coeff.clear();
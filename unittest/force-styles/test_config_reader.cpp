@@ -39,6 +39,7 @@ TestConfigReader::TestConfigReader(TestConfig &config) : config(config)
     consumers["prerequisites"]  = &TestConfigReader::prerequisites;
     consumers["pre_commands"]   = &TestConfigReader::pre_commands;
     consumers["post_commands"]  = &TestConfigReader::post_commands;
+    consumers["restart_commands"] = &TestConfigReader::restart_commands;
     consumers["input_file"]     = &TestConfigReader::input_file;
     consumers["extract"]        = &TestConfigReader::extract;
     consumers["natoms"]         = &TestConfigReader::natoms;
@@ -115,6 +116,17 @@ void TestConfigReader::post_commands(const yaml_event_t &event)
     }
 }
 
+void TestConfigReader::restart_commands(const yaml_event_t &event)
+{
+    config.restart_commands.clear();
+    std::stringstream data((char *)event.data.scalar.value);
+    std::string line;
+
+    while (std::getline(data, line, '\n')) {
+        config.restart_commands.push_back(line);
+    }
+}
+
 void TestConfigReader::lammps_version(const yaml_event_t &event)
 {
     config.lammps_version = (char *)event.data.scalar.value;
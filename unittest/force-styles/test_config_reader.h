@@ -29,6 +29,7 @@ public:
     void prerequisites(const yaml_event_t &event);
     void pre_commands(const yaml_event_t &event);
     void post_commands(const yaml_event_t &event);
+    void restart_commands(const yaml_event_t &event);
     void lammps_version(const yaml_event_t &event);
     void date_generated(const yaml_event_t &event);
     void epsilon(const yaml_event_t &event);
@@ -176,6 +176,15 @@ void write_yaml_header(YamlWriter *writer, TestConfig *cfg, const char *version)
     }
     writer->emit_block("post_commands", block);
 
+    // restart_commands
+    if (!cfg->restart_commands.empty()) {
+        block.clear();
+        for (auto &command : cfg->restart_commands) {
+            block += command + "\n";
+        }
+        writer->emit_block("restart_commands", block);
+    }
+
     // input_file
     writer->emit("input_file", cfg->input_file);
 }
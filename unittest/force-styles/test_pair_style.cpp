@@ -155,7 +155,7 @@ LAMMPS *init_lammps(LAMMPS::argv &args, const TestConfig &cfg, const bool newton
     return lmp;
 }
 
-void run_lammps(LAMMPS *lmp)
+void run_lammps(LAMMPS *lmp, const TestConfig &cfg)
 {
     // utility lambda to improve readability
     auto command = [&](const std::string &line) {
@@ -163,8 +163,13 @@ void run_lammps(LAMMPS *lmp)
     };
 
     command("fix 1 all nve");
-    command("compute pe all pe/atom pair");
-    command("compute sum all reduce sum c_pe");
+    // use the global pair energy for pair styles without per-atom energy support
+    if (cfg.skip_tests.count("peratom")) {
+        command("compute sum all pe pair");
+    } else {
+        command("compute pe all pe/atom pair");
+        command("compute sum all reduce sum c_pe");
+    }
     command("thermo_style custom step temp pe press c_sum");
     command("thermo 2");
     command("run 4 post no");
@@ -184,6 +189,10 @@ void restart_lammps(LAMMPS *lmp, const TestConfig &cfg, bool nofdotr = false, bo
         command("newton off");
     command("read_restart " + cfg.basename + ".restart");
 
+    for (const auto &restart_command : cfg.restart_commands) {
+        command(restart_command);
+    }
+
     if (!lmp->force->pair) {
         command("pair_style " + cfg.pair_style);
     }
@@ -305,7 +314,7 @@ void generate_yaml_file(const char *outfile, const TestConfig &config)
     writer.emit_block("init_forces", block);
 
     // do a few steps of MD
-    run_lammps(lmp);
+    run_lammps(lmp, config);
 
     // run_vdwl
     writer.emit("run_vdwl", lmp->force->pair->eng_vdwl);
@@ -379,7 +388,7 @@ TEST(PairStyle, plain)
     if (print_stats) std::cerr << "init_energy stats, newton on: " << stats << std::endl;
 
     if (!verbose) ::testing::internal::CaptureStdout();
-    run_lammps(lmp);
+    run_lammps(lmp, test_config);
     if (!verbose) ::testing::internal::GetCapturedStdout();
 
     EXPECT_FORCES("run_forces (newton on)", lmp->atom, test_config.run_forces, 5 * epsilon);
@@ -416,7 +425,7 @@ TEST(PairStyle, plain)
         if (print_stats) std::cerr << "init_energy stats, newton off:" << stats << std::endl;
 
         if (!verbose) ::testing::internal::CaptureStdout();
-        run_lammps(lmp);
+        run_lammps(lmp, test_config);
         if (!verbose) ::testing::internal::GetCapturedStdout();
 
         EXPECT_FORCES("run_forces (newton off)", lmp->atom, test_config.run_forces, 5 * epsilon);
@@ -482,7 +491,7 @@ TEST(PairStyle, plain)
         cleanup_lammps(lmp, test_config);
         lmp = init_lammps(args, test_config, false);
         lmp->input->one("run_style respa 2 1 inner 1 4.8 5.5 outer 2");
-        run_lammps(lmp);
+        run_lammps(lmp, test_config);
         if (!verbose) ::testing::internal::GetCapturedStdout();
 
         // need to relax error by a large amount with tabulation, since
@@ -559,7 +568,7 @@ TEST(PairStyle, omp)
     if (print_stats) std::cerr << "init_energy stats, newton on: " << stats << std::endl;
 
     if (!verbose) ::testing::internal::CaptureStdout();
-    run_lammps(lmp);
+    run_lammps(lmp, test_config);
     if (!verbose) ::testing::internal::GetCapturedStdout();
 
     EXPECT_FORCES("run_forces (newton on)", lmp->atom, test_config.run_forces, 5 * epsilon);
@@ -593,7 +602,7 @@ TEST(PairStyle, omp)
         if (print_stats) std::cerr << "init_energy stats, newton off:" << stats << std::endl;
 
         if (!verbose) ::testing::internal::CaptureStdout();
-        run_lammps(lmp);
+        run_lammps(lmp, test_config);
         if (!verbose) ::testing::internal::GetCapturedStdout();
 
         EXPECT_FORCES("run_forces (newton off)", lmp->atom, test_config.run_forces, 5 * epsilon);
@@ -695,7 +704,7 @@ TEST(PairStyle, kokkos_omp)
     if (print_stats) std::cerr << "init_energy stats, newton on: " << stats << std::endl;
 
     if (!verbose) ::testing::internal::CaptureStdout();
-    run_lammps(lmp);
+    run_lammps(lmp, test_config);
     if (!verbose) ::testing::internal::GetCapturedStdout();
 
     EXPECT_FORCES("run_forces (newton on)", lmp->atom, test_config.run_forces, 5 * epsilon);
@@ -728,7 +737,7 @@ TEST(PairStyle, kokkos_omp)
         if (print_stats) std::cerr << "init_energy stats, newton off:" << stats << std::endl;
 
         if (!verbose) ::testing::internal::CaptureStdout();
-        run_lammps(lmp);
+        run_lammps(lmp, test_config);
         if (!verbose) ::testing::internal::GetCapturedStdout();
 
         EXPECT_FORCES("run_forces (newton off)", lmp->atom, test_config.run_forces, 5 * epsilon);
@@ -836,7 +845,7 @@ TEST(PairStyle, gpu)
     if (print_stats) std::cerr << "init_energy stats, newton off:" << stats << std::endl;
 
     if (!verbose) ::testing::internal::CaptureStdout();
-    run_lammps(lmp);
+    run_lammps(lmp, test_config);
     if (!verbose) ::testing::internal::GetCapturedStdout();
 
     EXPECT_FORCES("run_forces (newton off)", lmp->atom, test_config.run_forces, 5 * epsilon);
@@ -917,7 +926,7 @@ TEST(PairStyle, intel)
     if (print_stats) std::cerr << "init_energy stats:" << stats << std::endl;
 
     if (!verbose) ::testing::internal::CaptureStdout();
-    run_lammps(lmp);
+    run_lammps(lmp, test_config);
     if (!verbose) ::testing::internal::GetCapturedStdout();
 
     EXPECT_FORCES("run_forces", lmp->atom, test_config.run_forces, 5 * epsilon);
@@ -988,7 +997,7 @@ TEST(PairStyle, opt)
     if (print_stats) std::cerr << "init_energy stats:" << stats << std::endl;
 
     if (!verbose) ::testing::internal::CaptureStdout();
-    run_lammps(lmp);
+    run_lammps(lmp, test_config);
     if (!verbose) ::testing::internal::GetCapturedStdout();
 
     EXPECT_FORCES("run_forces", lmp->atom, test_config.run_forces, 5 * epsilon);